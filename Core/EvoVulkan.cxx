@@ -2,9 +2,14 @@
 
 #include "src/EvoVulkan/VulkanKernel.cpp"
 #include "src/EvoVulkan/DescriptorManager.cpp"
+#include "src/EvoVulkan/BindlessTextures.cpp"
+#include "src/EvoVulkan/DescriptorBuffer.cpp"
+#include "src/EvoVulkan/FrameDescriptorAllocator.cpp"
+#include "src/EvoVulkan/DescriptorWriter.cpp"
 
 #include "src/EvoVulkan/Types/MultisampleTarget.cpp"
 #include "src/EvoVulkan/Types/Device.cpp"
+#include "src/EvoVulkan/Types/SamplerCache.cpp"
 #include "src/EvoVulkan/Types/ImageView.cpp"
 #include "src/EvoVulkan/Types/Pipeline.cpp"
 #include "src/EvoVulkan/Types/FamilyQueues.cpp"
@@ -13,6 +18,8 @@
 #include "src/EvoVulkan/Types/Synchronization.cpp"
 #include "src/EvoVulkan/Types/CmdPool.cpp"
 #include "src/EvoVulkan/Types/CmdBuffer.cpp"
+#include "src/EvoVulkan/Types/CmdRecorder.cpp"
+#include "src/EvoVulkan/Types/UploadContext.cpp"
 #include "src/EvoVulkan/Types/VulkanBuffer.cpp"
 #include "src/EvoVulkan/Types/DepthStencil.cpp"
 #include "src/EvoVulkan/Types/Texture.cpp"
@@ -26,11 +33,21 @@
 #include "src/EvoVulkan/Tools/DeviceTools.cpp"
 #include "src/EvoVulkan/Tools/Singleton.cpp"
 #include "src/EvoVulkan/Tools/FileSystem.cpp"
+#include "src/EvoVulkan/Tools/AsyncFileReader.cpp"
+#include "src/EvoVulkan/Tools/ThreadPool.cpp"
+#include "src/EvoVulkan/Tools/LZ4.cpp"
+#include "src/EvoVulkan/Tools/MipChain.cpp"
+#include "src/EvoVulkan/Tools/TextureCompressor.cpp"
+#include "src/EvoVulkan/Tools/TextureFile.cpp"
 
 #include "src/EvoVulkan/Memory/Allocator.cpp"
+#include "src/EvoVulkan/Memory/StagingRing.cpp"
 
 #include "src/EvoVulkan/Complexes/Framebuffer.cpp"
 #include "src/EvoVulkan/Complexes/Shader.cpp"
+#include "src/EvoVulkan/Complexes/MipGenerator.cpp"
+#include "src/EvoVulkan/Complexes/BlockEncoder.cpp"
+#include "src/EvoVulkan/Complexes/TextureStreamer.cpp"
 #include "src/EvoVulkan/Complexes/Mesh.cpp"
 #include "src/EvoVulkan/Complexes/FrameBufferAttachment.cpp"
 #include "src/EvoVulkan/Complexes/FrameBufferLayer.cpp"
\ No newline at end of file
@@ -0,0 +1,85 @@
+//
+// Created by Monika on 18.10.2026.
+//
+
+#ifndef EVOVULKAN_BINDLESSTEXTURES_H
+#define EVOVULKAN_BINDLESSTEXTURES_H
+
+#include <EvoVulkan/Tools/NonCopyable.h>
+
+namespace EvoVulkan::Types {
+    class Device;
+}
+
+namespace EvoVulkan::Core {
+    /**
+     * Global array of combined image samplers (descriptor indexing), each texture gets a stable index
+     * at creation, so materials don't need their own descriptor sets. The set is bound once per pipeline
+     * layout by Bind(), shaders index the array by push constant:
+     *
+     *  layout(set = BINDLESS_SET, binding = 0) uniform sampler2D textures[];
+     *  texture(textures[nonuniformEXT(index)], uv);
+     *
+     * Binding is partially bound and update-after-bind, so textures are added and removed
+     * while the set is bound by frames in flight. Index of removed texture is reused
+     * only after framesInFlight calls of NextFrame().
+     */
+    class DLL_EVK_EXPORT BindlessTextures : public Tools::NonCopyable {
+    public:
+        static constexpr uint32_t InvalidIndex = UINT32_MAX;
+
+    private:
+        BindlessTextures() = default;
+
+    public:
+        ~BindlessTextures() override;
+
+        /// @param capacity is clamped by Device::GetMaxBindlessTextures()
+        static BindlessTextures* Create(const Types::Device* pDevice, uint32_t capacity, uint32_t framesInFlight);
+
+    public:
+        /// @return index of the texture in the array, InvalidIndex if the array is full
+        uint32_t Add(const VkDescriptorImageInfo& imageInfo);
+        /// replaces descriptor of the index while the set is bound, objects of the old one have to live for frames in flight
+        void Update(uint32_t index, const VkDescriptorImageInfo& imageInfo);
+        void Remove(uint32_t index);
+
+        /// called by VulkanKernel::PrepareFrame(), indices of removed textures become free after frames in flight
+        void NextFrame();
+        /// already removed indices keep their delay
+        void SetFramesInFlight(uint32_t count);
+
+        void Bind(VkCommandBuffer cmd, VkPipelineLayout pipelineLayout, uint32_t set,
+            VkPipelineBindPoint bindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS) const;
+
+        EVK_NODISCARD VkDescriptorSetLayout GetLayout() const { return m_layout; }
+        EVK_NODISCARD VkDescriptorSet GetDescriptorSet() const { return m_descriptorSet; }
+        EVK_NODISCARD uint32_t GetCapacity() const { return m_capacity; }
+        EVK_NODISCARD uint32_t GetCount() const;
+
+    private:
+        void Write(uint32_t index, const VkDescriptorImageInfo& imageInfo);
+
+    private:
+        const Types::Device*                      m_device         = nullptr;
+
+        VkDescriptorSetLayout                     m_layout         = VK_NULL_HANDLE;
+        VkDescriptorPool                          m_pool           = VK_NULL_HANDLE;
+        VkDescriptorSet                           m_descriptorSet  = VK_NULL_HANDLE;
+
+        uint32_t                                  m_capacity       = 0;
+        /// indices up to it were given at least once
+        uint32_t                                  m_used           = 0;
+        uint32_t                                  m_framesInFlight = 0;
+        uint64_t                                  m_frame          = 0;
+
+        std::vector<uint32_t>                     m_free           = { };
+        /// removed indices and frames after which they can be reused
+        std::deque<std::pair<uint64_t, uint32_t>> m_retired        = { };
+
+        mutable std::mutex                        m_mutex;
+
+    };
+}
+
+#endif //EVOVULKAN_BINDLESSTEXTURES_H
@@ -0,0 +1,99 @@
+//
+// Created by Monika on 18.10.2026.
+//
+
+#ifndef EVOVULKAN_BLOCKENCODER_H
+#define EVOVULKAN_BLOCKENCODER_H
+
+#include <EvoVulkan/Types/CmdBuffer.h>
+#include <EvoVulkan/Tools/TextureCompressor.h>
+
+namespace EvoVulkan::Memory {
+    class Allocator;
+}
+
+namespace EvoVulkan::Types {
+    class VmaBuffer;
+    class UploadContext;
+}
+
+namespace EvoVulkan::Complexes {
+    /**
+     * Compresses images into BCn on GPU by compute kernels of cmp_core (Depends/cmp_core/shaders),
+     * HLSL sources are compiled by glslc into SPIR-V. Every workgroup encodes four 4x4 blocks
+     * into storage buffer which is copied into block compressed image.
+     *
+     * BC1, BC2, BC3, BC4 and BC5 are supported. BC7 kernel of cmp_core needs mode search passes
+     * which are not implemented in the bundled version, so BC7 is compressed by Tools::TextureCompressor.
+     *
+     * @note Source is read as is, to get sRGB blocks pass UNORM view of sRGB data.
+     */
+    class DLL_EVK_EXPORT BlockEncoder : public Tools::NonCopyable {
+        /// layout of cbCS of the kernels
+        struct Constants {
+            uint32_t m_width;
+            uint32_t m_blocksX;
+            uint32_t m_format;
+            uint32_t m_mode;
+            uint32_t m_startBlock;
+            uint32_t m_blocksCount;
+            float    m_alphaWeight;
+            float    m_quality;
+            uint32_t m_height;
+        };
+
+        /// resources of one encoding, released when the command buffer is complete
+        struct Encoding {
+            VkDescriptorPool  m_pool      = VK_NULL_HANDLE;
+            VkDescriptorSet   m_set       = VK_NULL_HANDLE;
+            Types::VmaBuffer* m_constants = nullptr;
+            Types::VmaBuffer* m_output    = nullptr;
+        };
+
+    private:
+        BlockEncoder() = default;
+
+    public:
+        ~BlockEncoder() override;
+
+        /// @param kernels folder with cmp_core kernels, compiled as Shader::LoadModule()
+        static BlockEncoder* Create(Types::Device* pDevice, Memory::Allocator* pAllocator, const std::string& kernels);
+
+    public:
+        EVK_NODISCARD bool IsSupported(Tools::BlockCompression compression) const;
+
+        /**
+         * Encodes source into level of the block compressed image.
+         *
+         * @param source sampled view in VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, previous writes have to be submitted before
+         * @param destination image in VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, level has size of the source, it doesn't have to be multiple of 4
+         * @param pContext if it's not nullptr, pCmd belongs to its batch and resources are released with it,
+         * otherwise pCmd is submitted and waited by CmdBuffer::End()
+         */
+        bool Encode(Types::CmdBuffer* pCmd, VkImageView source, uint32_t width, uint32_t height,
+            Tools::BlockCompression compression, float quality,
+            VkImage destination, uint32_t mipLevel, Types::UploadContext* pContext);
+
+    private:
+        bool CreateEncoding(VkImageView source, const Constants& constants, VkDeviceSize outputSize, Encoding& encoding);
+        void ReleaseEncoding(const Encoding& encoding);
+
+    private:
+        Types::Device*                m_device         = nullptr;
+        Memory::Allocator*            m_allocator      = nullptr;
+        /// g_InBuff of the kernels, isn't read by single pass ones
+        Types::VmaBuffer*             m_input          = nullptr;
+
+        VkDescriptorSetLayout         m_setLayout      = VK_NULL_HANDLE;
+        VkPipelineLayout              m_pipelineLayout = VK_NULL_HANDLE;
+        std::array<VkShaderModule, 6> m_modules        = { };
+        std::array<VkPipeline, 6>     m_pipelines      = { };
+
+        std::vector<VkDescriptorPool> m_pools          = { };
+
+        mutable std::mutex            m_mutex;
+
+    };
+}
+
+#endif //EVOVULKAN_BLOCKENCODER_H
@@ -38,7 +38,10 @@ namespace EvoVulkan::Complexes {
     public:
         ~FrameBuffer() override;
 
-        /// depth will be auto added to end array of attachments
+        /**
+         * Depth will be auto added to end array of attachments.
+         * @param framesInFlight count of command buffers and semaphores, one per frame slot of the kernel
+         */
         static FrameBuffer* Create(
                 Types::Device* device,
                 EvoVulkan::Memory::Allocator* allocator,
@@ -52,11 +55,19 @@ namespace EvoVulkan::Complexes {
                 float_t scale,
                 uint8_t samplesCount,
                 VkImageAspectFlags depthAspect,
-                VkFormat depthFormat);
+                VkFormat depthFormat,
+                uint32_t framesInFlight = 2);
 
     public:
         bool ReCreate(uint32_t width, uint32_t height);
 
+        /**
+         * Selects command buffer and semaphore of the frame slot (VulkanKernel::GetCurrentFrame()),
+         * they can be re-recorded only after the kernel has waited the slot. Own semaphores in the lists
+         * of wait and signal semaphores are replaced, semaphores of other frame buffers have to be set again.
+         */
+        void SetFrame(uint32_t frame);
+
         void BeginCmd();
         void End() const;
         void SetViewportAndScissor() const;
@@ -89,11 +100,13 @@ namespace EvoVulkan::Complexes {
         EVK_NODISCARD EVK_INLINE const FrameBufferLayers& GetLayers() const noexcept { return m_layers; }
         EVK_NODISCARD EVK_INLINE uint32_t GetLayersCount() const noexcept { return m_layersCount; }
         EVK_NODISCARD EVK_INLINE VkRect2D GetRenderPassArea() const noexcept { return { VkOffset2D(), { m_width, m_height } }; }
-        EVK_NODISCARD EVK_INLINE VkCommandBuffer GetCmd() const noexcept { return *m_cmdBuff; }
-        EVK_NODISCARD EVK_INLINE VkCommandBuffer* GetCmdRef() const noexcept { return m_cmdBuff->GetCmdRef(); }
+        EVK_NODISCARD EVK_INLINE VkCommandBuffer GetCmd() const noexcept { return *m_cmdBuffs[m_frame]; }
+        EVK_NODISCARD EVK_INLINE VkCommandBuffer* GetCmdRef() const noexcept { return m_cmdBuffs[m_frame]->GetCmdRef(); }
         EVK_NODISCARD EVK_INLINE Types::Device* GetDevice() const noexcept { return m_device; }
-        EVK_NODISCARD EVK_INLINE VkSemaphore GetSemaphore() const noexcept { return m_semaphore; }
-        EVK_NODISCARD EVK_INLINE VkSemaphore* GetSemaphoreRef() noexcept { return &m_semaphore; }
+        EVK_NODISCARD EVK_INLINE VkSemaphore GetSemaphore() const noexcept { return m_semaphores[m_frame]; }
+        EVK_NODISCARD EVK_INLINE VkSemaphore* GetSemaphoreRef() noexcept { return &m_semaphores[m_frame]; }
+        EVK_NODISCARD EVK_INLINE uint32_t GetFrame() const noexcept { return m_frame; }
+        EVK_NODISCARD EVK_INLINE uint32_t GetFramesInFlight() const noexcept { return static_cast<uint32_t>(m_cmdBuffs.size()); }
         EVK_NODISCARD EVK_INLINE Memory::Allocator* GetAllocator() noexcept { return m_allocator; }
         EVK_NODISCARD EVK_INLINE Types::CmdPool* GetCmdPool() noexcept { return m_cmdPool; }
         EVK_NODISCARD EVK_INLINE VkExtent2D GetExtent2D() noexcept { return VkExtent2D { m_width, m_height }; }
@@ -106,6 +119,8 @@ namespace EvoVulkan::Complexes {
         EVK_NODISCARD std::vector<VkSemaphore>& GetSignalSemaphores() { return m_signalSemaphores; }
 
         EVK_NODISCARD VkRenderPassBeginInfo BeginRenderPass(VkClearValue* clearValues, uint32_t countCls, uint32_t layer) const;
+        /// for secondary buffers executed in the render pass of the layer
+        EVK_NODISCARD VkCommandBufferInheritanceInfo GetInheritanceInfo(uint32_t layer) const;
 
     private:
         void DeInitialize();
@@ -126,7 +141,10 @@ namespace EvoVulkan::Complexes {
         uint32_t                  m_layersCount        = 0;
         std::vector<VkFormat>     m_attachFormats      = { };
 
-        VkSemaphore               m_semaphore          = VK_NULL_HANDLE;
+        /// command buffers and semaphores of the frame slots, m_frame is the current one
+        std::vector<VkSemaphore>  m_semaphores         = { };
+        std::vector<Types::CmdBuffer*> m_cmdBuffs      = { };
+        uint32_t                  m_frame              = 0;
 
         uint32_t                  m_width              = 0;
         uint32_t                  m_height             = 0;
@@ -144,7 +162,6 @@ namespace EvoVulkan::Complexes {
         Types::Swapchain*         m_swapchain          = nullptr;
         Types::CmdPool*           m_cmdPool            = nullptr;
         Core::DescriptorManager*  m_descriptorManager  = nullptr;
-        Types::CmdBuffer*         m_cmdBuff            = nullptr;
 
         VkRect2D                  m_scissor            = { };
         VkViewport                m_viewport           = { };
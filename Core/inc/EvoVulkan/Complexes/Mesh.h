@@ -88,9 +88,22 @@ namespace EvoVulkan::Complexes {
         Core::DescriptorManager* m_descriptorManager = nullptr;
 
         Shader const*            m_attachShader      = nullptr;
+
+    private:
+        /// set 0 with uniforms of the mesh
+        void BindDescriptorSet(const VkCommandBuffer& cmd);
+
     public:
+        /// with descriptor buffer only offsets are set, the buffer is bound once by Core::DescriptorBuffer::Bind()
         void Draw(const VkCommandBuffer& cmd);
 
+        /**
+         * Bindless mode: global set of Core::BindlessTextures is bound once by BindlessTextures::Bind(),
+         * only set 0 of the mesh (uniforms) is bound per draw, textures are indexed by push constant at offset 0.
+         * @param stages stages of the first push constant range of the shader
+         */
+        void DrawBindless(const VkCommandBuffer& cmd, uint32_t textureIndex, VkShaderStageFlags stages);
+
         Mesh(const Types::Device* device, Types::Buffer const *vertices, Types::Buffer const *indices, const uint32_t& countIndices, Core::DescriptorManager* manager);
 
         bool Bake(Shader const* shader);
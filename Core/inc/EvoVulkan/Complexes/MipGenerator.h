@@ -0,0 +1,114 @@
+//
+// Created by Monika on 18.10.2026.
+//
+
+#ifndef EVOVULKAN_MIPGENERATOR_H
+#define EVOVULKAN_MIPGENERATOR_H
+
+#include <EvoVulkan/Types/Image.h>
+#include <EvoVulkan/Types/CmdBuffer.h>
+
+namespace EvoVulkan::Memory {
+    class Allocator;
+}
+
+namespace EvoVulkan::Types {
+    class VmaBuffer;
+    class UploadContext;
+}
+
+namespace EvoVulkan::Complexes {
+    enum class MipFilter : uint8_t {
+        Box = 0, Kaiser = 1
+    };
+
+    /**
+     * Generates mip chain of 2D image by compute shader (Resources/Shaders/mipmaps.comp),
+     * every dispatch writes up to 12 levels. Works with formats which can't be blitted,
+     * sRGB images are filtered in linear space.
+     *
+     * @note Image has to be created with GetImageUsage() and GetImageFlags() of its format.
+     * @note Shader reduces levels after the first one of a dispatch by 2x2 box inside of 64x64 tiles,
+     * so Kaiser filter and levels of odd size (filtered by 3-tap weighted footprint) take one dispatch per level.
+     */
+    class DLL_EVK_EXPORT MipGenerator : public Tools::NonCopyable {
+        struct PushConstants {
+            int32_t m_width;
+            int32_t m_height;
+            int32_t m_levels;
+            int32_t m_tilesX;
+            int32_t m_filter;
+            int32_t m_srgb;
+        };
+
+        /// resources of one dispatch, released when the command buffer is complete
+        struct Dispatch {
+            VkDescriptorPool         m_pool  = VK_NULL_HANDLE;
+            VkDescriptorSet          m_set   = VK_NULL_HANDLE;
+            std::vector<VkImageView> m_views = { };
+        };
+
+    public:
+        static constexpr uint32_t MaxLevelsPerDispatch = 12;
+
+    private:
+        MipGenerator() = default;
+
+    public:
+        ~MipGenerator() override;
+
+        /// @param cache folder with shaders, compiled as Shader::LoadModule()
+        static MipGenerator* Create(Types::Device* pDevice, Memory::Allocator* pAllocator, const std::string& cache, const std::string& path = "mipmaps.comp");
+
+    public:
+        EVK_NODISCARD bool IsSupported(VkFormat format) const;
+        EVK_NODISCARD static VkFormat GetStorageFormat(VkFormat format);
+        EVK_NODISCARD static bool IsSRGB(VkFormat format);
+        EVK_NODISCARD static VkImageUsageFlags GetImageUsage(VkFormat format);
+        EVK_NODISCARD static VkImageCreateFlags GetImageFlags(VkFormat format);
+        EVK_NODISCARD MipFilter GetFilter() const { return m_filter; }
+
+        void SetFilter(MipFilter filter) { m_filter = filter; }
+
+        /**
+         * All levels of the image have to be in VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+         * after generation they are in VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL.
+         *
+         * @param pContext if it's not nullptr, pCmd belongs to its batch and resources are released with it,
+         * otherwise pCmd is submitted and waited by CmdBuffer::End()
+         */
+        bool Generate(Types::CmdBuffer* pCmd, Types::Image& image, uint32_t width, uint32_t height, uint32_t mipLevels, Types::UploadContext* pContext);
+
+    private:
+        /// level can be reduced by 2x2 box, each side is even or one texel
+        EVK_NODISCARD static bool IsEvenLevel(uint32_t width, uint32_t height, uint32_t level);
+
+        bool CreateDispatch(const Types::Image& image, uint32_t baseLevel, uint32_t levels, Dispatch& dispatch);
+        void ReleaseDispatch(const Dispatch& dispatch);
+
+        void Barrier(VkCommandBuffer cmd, VkImage image, uint32_t mipLevels,
+            VkImageLayout oldLayout, VkImageLayout newLayout,
+            VkAccessFlags srcAccess, VkAccessFlags dstAccess,
+            VkPipelineStageFlags srcStage, VkPipelineStageFlags dstStage) const;
+
+    private:
+        Types::Device*                m_device             = nullptr;
+        Types::VmaBuffer*             m_global             = nullptr;
+
+        VkShaderModule                m_module             = VK_NULL_HANDLE;
+        VkDescriptorSetLayout         m_setLayout          = VK_NULL_HANDLE;
+        VkPipelineLayout              m_pipelineLayout     = VK_NULL_HANDLE;
+        VkPipeline                    m_pipeline           = VK_NULL_HANDLE;
+        VkSampler                     m_sampler            = VK_NULL_HANDLE;
+
+        std::vector<VkDescriptorPool> m_pools              = { };
+
+        MipFilter                     m_filter             = MipFilter::Box;
+        bool                          m_writeWithoutFormat = false;
+
+        mutable std::mutex            m_mutex;
+
+    };
+}
+
+#endif //EVOVULKAN_MIPGENERATOR_H
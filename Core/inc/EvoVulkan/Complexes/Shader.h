@@ -50,6 +50,12 @@ namespace EvoVulkan::Complexes {
         operator VkPipeline() const { return m_pipeline; }
 
     public:
+        /**
+         * Compiles GLSL source from the cache folder if it's changed and loads SPIR-V.
+         * @param options additional compiler arguments, e.g. to compile HLSL source
+         */
+        static VkShaderModule LoadModule(const Types::Device* pDevice, const std::string& cache, const std::string& path, const std::string& options = std::string());
+
         bool Load(
             const std::string& cache,
             const std::vector<SourceShader>& modules,
@@ -57,6 +63,12 @@ namespace EvoVulkan::Complexes {
             const std::vector<VkPushConstantRange>& pushConstants
         );
 
+        /**
+         * Adds global set of Core::BindlessTextures to the pipeline layout after the set of the shader,
+         * so it's bound at set = 1 by BindlessTextures::Bind(). Has to be called before Load().
+         */
+        void SetBindlessLayout(VkDescriptorSetLayout layout) { m_bindlessLayout = layout; }
+
         bool SetVertexDescriptions(
                 const std::vector<VkVertexInputBindingDescription>& binding,
                 const std::vector<VkVertexInputAttributeDescription>& attribute);
@@ -99,6 +111,8 @@ namespace EvoVulkan::Complexes {
 
         VkDescriptorSetLayout                         m_descriptorSetLayout = VK_NULL_HANDLE;
         std::vector<VkDescriptorSetLayoutBinding>     m_layoutBindings      = { };
+        /** \brief bindless layout is reference. */
+        VkDescriptorSetLayout                         m_bindlessLayout      = VK_NULL_HANDLE;
 
         bool                                          m_hasVertices         = false;
 
@@ -0,0 +1,121 @@
+//
+// Created by Monika on 18.10.2026.
+//
+
+#ifndef EVOVULKAN_TEXTURESTREAMER_H
+#define EVOVULKAN_TEXTURESTREAMER_H
+
+#include <EvoVulkan/Types/Image.h>
+#include <EvoVulkan/Types/DescriptorSet.h>
+#include <EvoVulkan/Types/UploadContext.h>
+
+namespace EvoVulkan::Memory {
+    class Allocator;
+}
+
+namespace EvoVulkan::Core {
+    class DescriptorManager;
+}
+
+namespace EvoVulkan::Types {
+    class Texture;
+}
+
+namespace EvoVulkan::Complexes {
+    /**
+     * Streams mip levels of textures loaded by Texture::LoadStreamed() from their containers (Tools::TextureFile).
+     *
+     * Image of streamed texture contains only resident levels, the most detailed one is its first level,
+     * so eviction really frees memory. When residency is changed, image is recreated: resident levels
+     * are copied from the old image on GPU, missing ones are uploaded from the file. View and descriptor
+     * of the texture are replaced (see TextureResidency::m_version), bindless slot is rewritten in place,
+     * old objects are destroyed after frames in flight and the batch which reads them.
+     *
+     * Small levels (tail) are uploaded at load, so the texture can be used right away.
+     * Every Update() uploads the cheapest missing levels up to the frame budget, and evicts the most
+     * detailed levels while usage of device local heaps (vmaGetHeapBudgets) is above the threshold.
+     */
+    class DLL_EVK_EXPORT TextureStreamer : public Tools::NonCopyable {
+        /// objects replaced by residency change, they can still be used by frames in flight
+        struct Retired {
+            uint64_t                 m_frame         = 0;
+            Types::UploadTicket      m_ticket        = 0;
+            Types::Image             m_image         = Types::Image();
+            VkImageView              m_view          = VK_NULL_HANDLE;
+            Types::DescriptorSet     m_descriptorSet = { };
+            Core::DescriptorManager* m_manager       = nullptr;
+        };
+
+    private:
+        TextureStreamer() = default;
+
+    public:
+        ~TextureStreamer() override;
+
+        /**
+         * @param frameBudget bytes uploaded by one Update(), level bigger than it is uploaded alone
+         * @param framesInFlight replaced images are destroyed after this count of Update() calls
+         */
+        static TextureStreamer* Create(
+            Types::Device* pDevice,
+            Memory::Allocator* pAllocator,
+            Types::UploadContext* pUploadContext,
+            VkDeviceSize frameBudget,
+            uint32_t framesInFlight = 3);
+
+    public:
+        /**
+         * Has to be called once per frame before recording of commands which use streamed textures:
+         * evicts or streams levels in, submits the batch and destroys retired objects.
+         */
+        void Update();
+
+        /// levels whose size isn't bigger are uploaded at load and never evicted
+        void SetTailSize(uint32_t size) { m_tailSize = EVK_MAX(size, 1u); }
+        void SetFrameBudget(VkDeviceSize budget) { m_frameBudget = budget; }
+        /// part of the device local budget, levels are evicted above it and aren't streamed in
+        void SetPressureThreshold(float_t threshold) { m_pressureThreshold = threshold; }
+
+        EVK_NODISCARD Types::UploadContext* GetUploadContext() const { return m_uploadContext; }
+        EVK_NODISCARD VkDeviceSize GetFrameBudget() const { return m_frameBudget; }
+        EVK_NODISCARD uint32_t GetTailSize() const { return m_tailSize; }
+        EVK_NODISCARD size_t GetTexturesCount() const { return m_textures.size(); }
+        /// bytes uploaded and evicted by the last Update()
+        EVK_NODISCARD VkDeviceSize GetUploadedBytes() const { return m_uploadedBytes; }
+        EVK_NODISCARD VkDeviceSize GetEvictedBytes() const { return m_evictedBytes; }
+
+        /// registers texture and uploads its tail, is called by Texture::LoadStreamed()
+        bool Add(Types::Texture* pTexture);
+        void Remove(Types::Texture* pTexture);
+
+    private:
+        /// recreates image of the texture with levels from the given one to the last
+        bool SetResidentLevel(Types::Texture* pTexture, uint32_t level);
+        void Retire(Types::Image&& image, VkImageView view, Types::DescriptorSet descriptorSet, Core::DescriptorManager* pManager);
+        void CollectRetired(bool force);
+
+        void Evict(VkDeviceSize usage, VkDeviceSize limit);
+        void StreamIn(VkDeviceSize usage, VkDeviceSize limit);
+
+    private:
+        Types::Device*               m_device            = nullptr;
+        Memory::Allocator*           m_allocator         = nullptr;
+        Types::UploadContext*        m_uploadContext     = nullptr;
+
+        std::vector<Types::Texture*> m_textures          = { };
+        std::deque<Retired>          m_retired           = { };
+
+        VkDeviceSize                 m_frameBudget       = 0;
+        VkDeviceSize                 m_uploadedBytes     = 0;
+        VkDeviceSize                 m_evictedBytes      = 0;
+        float_t                      m_pressureThreshold = 0.9f;
+        uint32_t                     m_tailSize          = 128;
+        uint32_t                     m_framesInFlight    = 0;
+        uint64_t                     m_frame             = 0;
+        /// commands were recorded since the last submission
+        bool                         m_recorded          = false;
+
+    };
+}
+
+#endif //EVOVULKAN_TEXTURESTREAMER_H
@@ -0,0 +1,89 @@
+//
+// Created by Monika on 18.10.2026.
+//
+
+#ifndef EVOVULKAN_DESCRIPTORBUFFER_H
+#define EVOVULKAN_DESCRIPTORBUFFER_H
+
+#include <EvoVulkan/Types/DescriptorSet.h>
+
+namespace EvoVulkan::Types {
+    class Device;
+}
+
+namespace EvoVulkan::Core {
+    /**
+     * Descriptor buffer backend of DescriptorManager (VK_EXT_descriptor_buffer).
+     *
+     * Descriptors are written by vkGetDescriptorEXT straight into persistently mapped host visible buffer,
+     * so there are no descriptor pools, vkAllocateDescriptorSets and vkUpdateDescriptorSets.
+     * Set is a range of the buffer: allocation is a bump of the head, freed ranges are reused
+     * by sets of the same size. The buffer is bound once per command buffer by Bind(),
+     * then sets are bound by SetOffsets() (vkCmdSetDescriptorBufferOffsetsEXT) before draws.
+     *
+     * Set layouts have to be created by Device::CreateDescriptorSetLayout(), pipelines
+     * with VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT (Complexes::Shader does it).
+     * Buffers which are written into sets need VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT,
+     * Memory::Allocator adds it to uniform, storage and texel buffers while the backend is enabled.
+     * Allocate() and Free() are thread safe.
+     */
+    class DLL_EVK_EXPORT DescriptorBuffer : public Tools::NonCopyable {
+    private:
+        DescriptorBuffer() = default;
+
+    public:
+        ~DescriptorBuffer() override;
+
+        static DescriptorBuffer* Create(const Types::Device* pDevice, VkDeviceSize size);
+
+    public:
+        EVK_NODISCARD Types::DescriptorSet Allocate(VkDescriptorSetLayout layout);
+        bool Free(Types::DescriptorSet& descriptorSet);
+
+        void WriteImage(const Types::DescriptorSet& descriptorSet, uint32_t binding, uint32_t arrayElement,
+            VkDescriptorType type, const VkDescriptorImageInfo& imageInfo);
+        /// buffer of the info has to be created with VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT (Memory::Allocator::GetBufferUsage())
+        void WriteBuffer(const Types::DescriptorSet& descriptorSet, uint32_t binding, uint32_t arrayElement,
+            VkDescriptorType type, const VkDescriptorBufferInfo& bufferInfo);
+
+        /// binds the buffer once per command buffer (and after binding of other descriptor buffers)
+        void Bind(VkCommandBuffer cmd) const;
+        /// binds consecutive sets starting from the first one, the buffer has to be bound by Bind()
+        void SetOffsets(VkCommandBuffer cmd, VkPipelineBindPoint bindPoint, VkPipelineLayout pipelineLayout, uint32_t firstSet,
+            std::span<const Types::DescriptorSet> descriptorSets) const;
+
+        EVK_NODISCARD VkDeviceSize GetSize() const { return m_size; }
+        /// bytes which are used by allocated sets
+        EVK_NODISCARD VkDeviceSize GetUsedSize() const;
+
+    private:
+        EVK_NODISCARD size_t GetDescriptorSize(VkDescriptorType type) const;
+        void Write(const Types::DescriptorSet& descriptorSet, uint32_t binding, uint32_t arrayElement,
+            VkDescriptorType type, const void* pData);
+
+    private:
+        const Types::Device*                                         m_device      = nullptr;
+
+        VkBuffer                                                     m_buffer      = VK_NULL_HANDLE;
+        VkDeviceMemory                                               m_memory      = VK_NULL_HANDLE;
+        VkDeviceAddress                                              m_address     = 0;
+        VkBufferUsageFlags                                           m_usage       = 0;
+        uint8_t*                                                     m_mapped      = nullptr;
+
+        VkDeviceSize                                                 m_size        = 0;
+        VkDeviceSize                                                 m_head        = 0;
+        VkDeviceSize                                                 m_usedSize    = 0;
+        VkDeviceSize                                                 m_alignment   = 1;
+
+        /// freed ranges by their sizes
+        std::unordered_map<VkDeviceSize, std::vector<VkDeviceSize>>  m_free        = { };
+        /// sizes of sets of each layout
+        std::unordered_map<VkDescriptorSetLayout, VkDeviceSize>      m_layoutSizes = { };
+
+        /// guards allocation, writes go to different ranges and don't need it
+        mutable std::mutex                                           m_mutex;
+
+    };
+}
+
+#endif //EVOVULKAN_DESCRIPTORBUFFER_H
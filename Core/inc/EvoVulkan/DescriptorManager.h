@@ -6,6 +6,8 @@
 #define EVOVULKAN_DESCRIPTORMANAGER_H
 
 #include <EvoVulkan/Types/DescriptorSet.h>
+#include <EvoVulkan/BindlessTextures.h>
+#include <EvoVulkan/DescriptorBuffer.h>
 
 namespace EvoVulkan::Types {
     class Device;
@@ -13,13 +15,76 @@ namespace EvoVulkan::Types {
 }
 
 namespace EvoVulkan::Core {
+    /**
+     * Allocation and free of descriptor sets are thread safe, set can be freed by any thread.
+     * Each thread allocates from its own cached pool of the layout, the lock of the cache is taken only by this thread,
+     * so it's uncontended. Pools are sharded by layouts, the shard is locked only when the cache runs dry
+     * and when a set of other thread's pool is freed.
+     * Reset(), TrimEmptyPools() and Free() lock all shards and return cached pools, sets mustn't be used during them.
+     */
     class DLL_EVK_EXPORT DescriptorManager : public Tools::NonCopyable {
         using RequestTypes = std::vector<uint64_t>;
+
+        static constexpr uint32_t MinSetsPerPool = 16;
+        static constexpr uint32_t MaxSetsPerPool = 1024;
+        static constexpr VkDeviceSize DescriptorBufferSize = 4 * 1024 * 1024;
+
+        /// layout and sorted unique request types, sets of the same key are allocated from the same pools
+        struct PoolKey {
+            VkDescriptorSetLayout m_layout       = VK_NULL_HANDLE;
+            RequestTypes          m_requestTypes = { };
+
+            bool operator==(const PoolKey& other) const {
+                return m_layout == other.m_layout && m_requestTypes == other.m_requestTypes;
+            }
+        };
+
+        struct PoolKeyHash {
+            size_t operator()(const PoolKey& key) const noexcept;
+        };
+
+        struct PoolBucket {
+            /// pools which aren't full, the last one is used first
+            std::vector<Types::DescriptorPool*> m_available  = { };
+            uint32_t                            m_poolsCount = 0;
+            uint32_t                            m_emptyPools = 0;
+            /// sets of the next pool, pools grow geometrically up to MaxSetsPerPool
+            uint32_t                            m_nextSets   = MinSetsPerPool;
+        };
+
+        using PoolBuckets = std::unordered_map<PoolKey, PoolBucket, PoolKeyHash>;
+
+        /// one pool of each key taken from the shards by a thread, other threads don't allocate from them
+        struct ThreadCache {
+            std::unordered_map<PoolKey, Types::DescriptorPool*, PoolKeyHash> m_pools;
+            std::unordered_set<Types::DescriptorPool*>                       m_owned;
+            /// locked by shard after its mutex, pools are used by the owner and by frees of other threads
+            std::mutex                                                       m_mutex;
+        };
+
+        struct PoolInfo {
+            PoolBucket*  m_bucket = nullptr;
+            /// pool isn't in the free list of the bucket while it's cached by a thread
+            ThreadCache* m_owner  = nullptr;
+        };
+
+        /// pools of a layout are always in the same shard, so allocation and free lock only it
+        struct Shard {
+            /// pools and their buckets, bucket is found by the pool of freed set
+            std::unordered_map<Types::DescriptorPool*, PoolInfo> m_pools;
+            PoolBuckets                                           m_buckets;
+            mutable std::mutex                                    m_mutex;
+        };
+
+        static constexpr uint32_t ShardsBits = 4;
+        static constexpr uint32_t ShardsCount = 1u << ShardsBits;
+
     private:
         DescriptorManager() = default;
         ~DescriptorManager() override = default;
 
     public:
+        /// uses descriptor buffer instead of pools if it's enabled by the device (EvoDeviceCreateInfo::descriptorBuffer)
         static DescriptorManager* Create(const EvoVulkan::Types::Device* device);
 
         void Free();
@@ -28,13 +93,68 @@ namespace EvoVulkan::Core {
         Types::DescriptorSet AllocateDescriptorSet(VkDescriptorSetLayout layout, const RequestTypes& requestTypes, bool reallocate = false);
         bool FreeDescriptorSet(Types::DescriptorSet* descriptorSet);
 
+        /**
+         * Enables bindless mode, textures created with this manager get index in the global array
+         * (Texture::GetBindlessIndex()), their descriptor sets are still available.
+         * Not available with descriptor buffer. Removed indices are reused after frames in flight of the kernel.
+         */
+        bool EnableBindless(uint32_t capacity);
+        EVK_NODISCARD BindlessTextures* GetBindlessTextures() const { return m_bindless; }
+
+        /// nullptr if sets are allocated from descriptor pools
+        EVK_NODISCARD DescriptorBuffer* GetDescriptorBuffer() const { return m_descriptorBuffer; }
+
+        /// destroys all empty pools, e.g. after unloading of a scene
+        void TrimEmptyPools();
+
+        /// empty pools which are kept by each layout, so freeing and allocating of one set doesn't recreate a pool
+        void SetEmptyPoolsLimit(uint32_t limit) { m_emptyPoolsLimit = limit; }
+
+        /// set by VulkanKernel::PostInit(), bindless textures delay reuse of indices by it
+        void SetFramesInFlight(uint32_t count);
+
+        EVK_NODISCARD size_t GetPoolsCount() const;
+        EVK_NODISCARD uint64_t GetCreatedPoolsCount() const { return m_createdPools; }
+        EVK_NODISCARD uint64_t GetDestroyedPoolsCount() const { return m_destroyedPools; }
+
     private:
-        Types::DescriptorPool* FindDescriptorPool(VkDescriptorSetLayout layout, const RequestTypes& requestTypes);
-        Types::DescriptorPool* AllocateDescriptorPool(VkDescriptorSetLayout layout, const RequestTypes& requestTypes);
+        static PoolKey MakePoolKey(VkDescriptorSetLayout layout, const RequestTypes& requestTypes);
+        /// layout and request types for logs of failed allocations
+        static std::string PoolKeyToString(const PoolKey& key);
+
+        Shard& GetShard(VkDescriptorSetLayout layout);
+        PoolBuckets::value_type& GetBucket(Shard& shard, const PoolKey& key);
+        /// nullptr if the thread hasn't used the manager yet and create is false
+        ThreadCache* GetThreadCache(bool create);
+
+        /// shard has to be locked
+        Types::DescriptorSet AllocateDescriptorSet(Shard& shard, const PoolKey& key, bool reallocate);
+        /// shard and cache have to be locked, replaces the full pool of the cache by a pool of the shard
+        Types::DescriptorSet RefillThreadCache(Shard& shard, ThreadCache& cache, const PoolKey& key);
+        void ReleaseCachedPool(Shard& shard, ThreadCache& cache, Types::DescriptorPool* pPool);
+        /// shard has to be locked, returns pools of the shard cached by all threads
+        void ReleaseThreadCaches(Shard& shard);
+        Types::DescriptorPool* AllocateDescriptorPool(Shard& shard, const PoolKey& key, PoolBucket& bucket);
+        void DestroyDescriptorPool(Shard& shard, Types::DescriptorPool* pPool, PoolBucket& bucket);
 
     private:
         const EvoVulkan::Types::Device* m_device = nullptr;
-        std::set<Types::DescriptorPool*> m_pools;
+
+        std::array<Shard, ShardsCount> m_shards;
+
+        /// caches are kept until the manager is freed, threads find them by id of the manager
+        std::vector<std::unique_ptr<ThreadCache>> m_caches;
+        std::mutex m_cachesMutex;
+        uint64_t m_id = 0;
+
+        BindlessTextures* m_bindless = nullptr;
+        DescriptorBuffer* m_descriptorBuffer = nullptr;
+
+        uint32_t m_framesInFlight = 1;
+
+        std::atomic<uint32_t> m_emptyPoolsLimit = 1;
+        std::atomic<uint64_t> m_createdPools = 0;
+        std::atomic<uint64_t> m_destroyedPools = 0;
 
     };
 }
@@ -0,0 +1,62 @@
+//
+// Created by Monika on 18.10.2026.
+//
+
+#ifndef EVOVULKAN_DESCRIPTORWRITER_H
+#define EVOVULKAN_DESCRIPTORWRITER_H
+
+#include <EvoVulkan/Types/DescriptorSet.h>
+
+namespace EvoVulkan::Types {
+    class Device;
+}
+
+namespace EvoVulkan::Core {
+    /**
+     * Collects descriptor writes of many sets and flushes them by one vkUpdateDescriptorSets.
+     * Sets of descriptor buffer are written immediately, there is nothing to batch.
+     *
+     * Sets of layouts which are written repeatedly are updated by UpdateWithTemplate() from packed struct,
+     * see Device::GetDescriptorUpdateTemplate():
+     *
+     *  struct { VkDescriptorBufferInfo ubo; VkDescriptorImageInfo albedo; } data = { ... };
+     *  writer.UpdateWithTemplate(set, &data);
+     */
+    class DLL_EVK_EXPORT DescriptorWriter : public Tools::NonCopyable {
+    public:
+        explicit DescriptorWriter(const Types::Device* pDevice)
+            : m_device(pDevice)
+        { }
+
+        ~DescriptorWriter() override;
+
+    public:
+        DescriptorWriter& WriteImage(const Types::DescriptorSet& descriptorSet, uint32_t binding, VkDescriptorType type,
+            const VkDescriptorImageInfo& imageInfo, uint32_t arrayElement = 0);
+        DescriptorWriter& WriteBuffer(const Types::DescriptorSet& descriptorSet, uint32_t binding, VkDescriptorType type,
+            const VkDescriptorBufferInfo& bufferInfo, uint32_t arrayElement = 0);
+
+        /// updates all collected writes by one call
+        void Flush();
+        void Clear();
+
+        /// immediate update of the whole set, layout has to be created by Device::CreateDescriptorSetLayout()
+        bool UpdateWithTemplate(const Types::DescriptorSet& descriptorSet, const void* pData) const;
+        /// for transient sets of Core::FrameDescriptorAllocator
+        bool UpdateWithTemplate(VkDescriptorSet descriptorSet, VkDescriptorSetLayout layout, const void* pData) const;
+
+        EVK_NODISCARD size_t GetWritesCount() const { return m_writes.size(); }
+
+    private:
+        const Types::Device*                m_device      = nullptr;
+
+        /// infos are referenced by indices, pointers are set on flush since vectors grow
+        std::vector<VkWriteDescriptorSet>   m_writes      = { };
+        std::vector<size_t>                 m_infoIndices = { };
+        std::vector<VkDescriptorImageInfo>  m_imageInfos  = { };
+        std::vector<VkDescriptorBufferInfo> m_bufferInfos = { };
+
+    };
+}
+
+#endif //EVOVULKAN_DESCRIPTORWRITER_H
@@ -0,0 +1,69 @@
+//
+// Created by Monika on 18.10.2026.
+//
+
+#ifndef EVOVULKAN_FRAMEDESCRIPTORALLOCATOR_H
+#define EVOVULKAN_FRAMEDESCRIPTORALLOCATOR_H
+
+#include <EvoVulkan/Tools/NonCopyable.h>
+
+namespace EvoVulkan::Types {
+    class Device;
+}
+
+namespace EvoVulkan::Core {
+    /**
+     * Linear allocator of transient descriptor sets (post-processing inputs, per-pass data).
+     *
+     * Each frame slot has its own pools without VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT,
+     * sets are never freed one by one: all sets of the slot are released at once by vkResetDescriptorPool
+     * in BeginFrame(), when the fence of the slot is signaled. Pools are kept between frames,
+     * so after warming up allocation doesn't create pools.
+     *
+     * Sets are valid only until the same frame slot begins again.
+     */
+    class DLL_EVK_EXPORT FrameDescriptorAllocator : public Tools::NonCopyable {
+        struct FramePools {
+            std::vector<VkDescriptorPool> m_pools   = { };
+            /// pool which is used by allocation, pools before it are full
+            uint32_t                      m_current = 0;
+            uint32_t                      m_sets    = 0;
+        };
+
+    private:
+        FrameDescriptorAllocator() = default;
+
+    public:
+        ~FrameDescriptorAllocator() override;
+
+        static FrameDescriptorAllocator* Create(const Types::Device* pDevice, uint32_t framesInFlight, uint32_t setsPerPool = 256);
+
+    public:
+        /// resets pools of the frame slot, its fence has to be signaled
+        void BeginFrame(uint32_t frame);
+
+        /// @return set which is valid until the current frame slot begins again, VK_NULL_HANDLE on failure
+        EVK_NODISCARD VkDescriptorSet Allocate(VkDescriptorSetLayout layout);
+
+        EVK_NODISCARD uint32_t GetCurrentFrame() const { return m_frame; }
+        EVK_NODISCARD uint32_t GetFramesInFlight() const { return static_cast<uint32_t>(m_frames.size()); }
+        /// sets allocated in the current frame slot
+        EVK_NODISCARD uint32_t GetSetsCount() const;
+        EVK_NODISCARD size_t GetPoolsCount() const;
+
+    private:
+        EVK_NODISCARD VkDescriptorPool CreatePool() const;
+
+    private:
+        const Types::Device*       m_device      = nullptr;
+
+        std::vector<FramePools>    m_frames      = { };
+        uint32_t                   m_frame       = 0;
+        uint32_t                   m_setsPerPool = 0;
+
+        mutable std::mutex         m_mutex;
+
+    };
+}
+
+#endif //EVOVULKAN_FRAMEDESCRIPTORALLOCATOR_H
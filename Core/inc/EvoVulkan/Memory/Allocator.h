@@ -42,6 +42,14 @@ namespace EvoVulkan::Memory {
 
     };
 
+    /// sum of VMA budgets of device local heaps
+    struct DLL_EVK_EXPORT HeapBudget {
+        /// memory used by this and (if VK_EXT_memory_budget is enabled) other processes
+        VkDeviceSize m_usage  = 0;
+        /// memory which can be used without degradation of performance
+        VkDeviceSize m_budget = 0;
+    };
+
     class DLL_EVK_EXPORT Allocator : public Types::IVkObject {
     private:
         explicit Allocator(Types::Device* device)
@@ -65,9 +73,13 @@ namespace EvoVulkan::Memory {
         void FreeImage(Types::Image& image);
         bool FreeMemory(RawMemory* memory);
 
+        /// with descriptor buffer, buffers which can be written into sets are addressed by the device
+        EVK_NODISCARD VkBufferUsageFlags GetBufferUsage(VkBufferUsageFlags usage) const;
+
         EVK_NODISCARD Types::Device* GetDevice() const { return m_device; }
         EVK_NODISCARD uint64_t GetGPUMemoryUsage() const;
         EVK_NODISCARD uint64_t GetCPUMemoryUsage() const;
+        EVK_NODISCARD HeapBudget GetDeviceLocalBudget() const;
         EVK_NODISCARD uint64_t GetAllocatedMemorySize() const { return m_deviceMemoryAllocSize; }
         EVK_NODISCARD uint64_t GetAllocatedHeapsCount() const { return m_allocHeapsCount;       }
 
@@ -0,0 +1,94 @@
+//
+// Created by Monika on 18.10.2026.
+//
+
+#ifndef EVOVULKAN_STAGINGRING_H
+#define EVOVULKAN_STAGINGRING_H
+
+#include <EvoVulkan/Memory/Allocator.h>
+#include <EvoVulkan/Tools/NonCopyable.h>
+
+namespace EvoVulkan::Types {
+    class UploadContext;
+}
+
+namespace EvoVulkan::Memory {
+    /// part of staging memory, mapped while it's alive
+    struct DLL_EVK_EXPORT StagingRegion {
+        VkBuffer     m_buffer = VK_NULL_HANDLE;
+        VkDeviceSize m_offset = 0;
+        VkDeviceSize m_size   = 0;
+        void*        m_data   = nullptr;
+        /// zero if region isn't allocated from the ring
+        uint64_t     m_id     = 0;
+
+        EVK_NODISCARD bool Valid() const { return m_buffer != VK_NULL_HANDLE && m_data; }
+    };
+
+    /**
+     * Persistently mapped staging buffer, regions are suballocated one after another and wrap around.
+     * Regions can be freed in any order, but memory is reclaimed from the oldest one,
+     * so long-living region holds all newer ones.
+     *
+     * @note Doesn't know about GPU, the owner frees region when the submission using it is complete.
+     */
+    class DLL_EVK_EXPORT StagingRing : public Tools::NonCopyable {
+        friend class Types::UploadContext;
+
+        struct Entry {
+            uint64_t     m_id       = 0;
+            /// head before allocation, including padding and skipped end of buffer
+            VkDeviceSize m_begin    = 0;
+            VkDeviceSize m_end      = 0;
+            bool         m_released = false;
+        };
+
+    private:
+        StagingRing() = default;
+
+    public:
+        ~StagingRing() override;
+
+        static StagingRing* Create(Allocator* pAllocator, VkDeviceSize size);
+
+    public:
+        /// returns false if there is no contiguous space, doesn't block
+        bool Allocate(VkDeviceSize size, VkDeviceSize alignment, StagingRegion& region);
+        void Free(const StagingRegion& region);
+
+        /// makes host writes visible, does nothing for coherent memory
+        void Flush();
+
+        EVK_NODISCARD VkBuffer GetBuffer() const { return m_buffer.m_buffer; }
+        EVK_NODISCARD uint8_t* GetMappedData() const { return m_mapped; }
+        EVK_NODISCARD VkDeviceSize GetSize() const { return m_size; }
+        EVK_NODISCARD VkDeviceSize GetUsed() const;
+        EVK_NODISCARD VkDeviceSize GetHighWaterMark() const;
+        /// how many times allocation waited for GPU
+        EVK_NODISCARD uint64_t GetStallsCount() const;
+        /// how many allocations didn't fit and used temporary buffers
+        EVK_NODISCARD uint64_t GetSpillsCount() const;
+
+    private:
+        Allocator*         m_allocator     = nullptr;
+        Buffer             m_buffer        = { };
+        uint8_t*           m_mapped        = nullptr;
+        VkDeviceSize       m_size          = 0;
+
+        VkDeviceSize       m_head          = 0;
+        VkDeviceSize       m_tail          = 0;
+        VkDeviceSize       m_used          = 0;
+        VkDeviceSize       m_highWaterMark = 0;
+
+        uint64_t           m_nextId        = 1;
+        uint64_t           m_stalls        = 0;
+        uint64_t           m_spills        = 0;
+
+        std::deque<Entry>  m_entries       = { };
+
+        mutable std::mutex m_mutex;
+
+    };
+}
+
+#endif //EVOVULKAN_STAGINGRING_H
@@ -0,0 +1,136 @@
+//
+// Created by Monika on 18.10.2026.
+//
+
+#ifndef EVOVULKAN_ASYNCFILEREADER_H
+#define EVOVULKAN_ASYNCFILEREADER_H
+
+#include <EvoVulkan/Tools/ThreadPool.h>
+
+#if defined(EVK_LINUX) && !defined(EVK_ANDROID)
+    #define EVK_IO_URING
+#endif
+
+namespace EvoVulkan::Tools {
+    /// identifier of the submitted reads, zero is always complete
+    typedef uint64_t FileReadTicket;
+
+    struct DLL_EVK_EXPORT FileReadRequest {
+        std::string m_path;
+        uint64_t    m_offset      = 0;
+        uint64_t    m_size        = 0;
+        /// e.g. mapped staging memory, has to be alive until the ticket is complete
+        void*       m_destination = nullptr;
+    };
+
+    /**
+     * Reads file ranges in background, e.g. straight into staging memory of UploadContext.
+     *
+     * On Linux reads are submitted into io_uring (raw syscalls, liburing isn't needed), requests are split
+     * into ReadSize parts, so hundreds of reads are in flight at once. Reads into the registered buffer
+     * (staging ring) use fixed buffers and aren't pinned by kernel on every call.
+     * If io_uring isn't available (old kernel, seccomp, other platforms), reads are jobs of the thread pool.
+     *
+     * Completions are reaped by IsComplete() and Wait(), there is no own thread.
+     */
+    class DLL_EVK_EXPORT AsyncFileReader : public NonCopyable {
+        /// one read in flight, its address is user data of io_uring entry
+        struct Operation {
+            FileReadTicket m_ticket      = 0;
+            int32_t        m_file        = -1;
+            uint64_t       m_offset      = 0;
+            uint64_t       m_size        = 0;
+            uint8_t*       m_destination = nullptr;
+        };
+
+        struct Batch {
+            uint64_t             m_pending = 0;
+            bool                 m_failed  = false;
+            std::vector<int32_t> m_files   = { };
+        };
+
+    public:
+        static constexpr uint64_t ReadSize = 1024 * 1024;
+
+    private:
+        AsyncFileReader() = default;
+
+    public:
+        ~AsyncFileReader() override;
+
+        /**
+         * @param queueDepth count of io_uring entries
+         * @param pPool fallback workers, if it's nullptr and io_uring isn't available, own pool is created
+         */
+        static AsyncFileReader* Create(uint32_t queueDepth = 256, ThreadPool* pPool = nullptr);
+
+    public:
+        /// @return zero if some file can't be opened, nothing is submitted in this case
+        FileReadTicket Submit(std::span<const FileReadRequest> requests);
+
+        /// memory which is read into most of the time (staging ring), only one buffer can be registered
+        bool RegisterBuffer(void* pData, uint64_t size);
+
+        /// @return false if some read of the ticket has failed
+        bool Wait(FileReadTicket ticket);
+        EVK_NODISCARD bool IsComplete(FileReadTicket ticket);
+
+        EVK_NODISCARD bool IsUring() const { return m_ring >= 0; }
+
+    private:
+        bool InitRing(uint32_t queueDepth);
+        void DestroyRing();
+
+        /// moves queued operations into submission queue and submits them, fails them if ring is broken
+        void SubmitQueued();
+        /// processes completions without blocking, has to be called under the lock
+        void Reap();
+        /// blocks until at least one completion is available, has to be called without the lock
+        bool WaitCompletions();
+        void Complete(Operation* pOperation, bool success);
+
+        void ReadFallback(const FileReadRequest& request, FileReadTicket ticket);
+
+    private:
+        int32_t                                    m_ring           = -1;
+        uint32_t                                   m_entries        = 0;
+        /// reads consumed by kernel and not completed yet
+        uint32_t                                   m_inFlight       = 0;
+        /// entries which are published into submission queue, but aren't consumed by kernel
+        uint32_t                                   m_unsubmitted    = 0;
+        /// some thread is blocked in kernel waiting for completions
+        bool                                       m_reaping        = false;
+
+        void*                                      m_sqRing         = nullptr;
+        void*                                      m_cqRing         = nullptr;
+        void*                                      m_sqes           = nullptr;
+        uint64_t                                   m_sqRingSize     = 0;
+        uint64_t                                   m_cqRingSize     = 0;
+        uint64_t                                   m_sqesSize       = 0;
+
+        uint32_t*                                  m_sqHead         = nullptr;
+        uint32_t*                                  m_sqTail         = nullptr;
+        uint32_t*                                  m_sqMask         = nullptr;
+        uint32_t*                                  m_sqArray        = nullptr;
+        uint32_t*                                  m_cqHead         = nullptr;
+        uint32_t*                                  m_cqTail         = nullptr;
+        uint32_t*                                  m_cqMask         = nullptr;
+        void*                                      m_cqes           = nullptr;
+
+        uint8_t*                                   m_registered     = nullptr;
+        uint64_t                                   m_registeredSize = 0;
+
+        ThreadPool*                                m_pool           = nullptr;
+        bool                                       m_ownPool        = false;
+
+        std::deque<Operation*>                     m_queued         = { };
+        std::unordered_map<FileReadTicket, Batch>  m_batches        = { };
+        FileReadTicket                             m_nextTicket     = 1;
+
+        std::mutex                                 m_mutex;
+        std::condition_variable                    m_condition;
+
+    };
+}
+
+#endif //EVOVULKAN_ASYNCFILEREADER_H
@@ -7,9 +7,35 @@
 
 #include <EvoVulkan/Tools/StringUtils.h>
 #include <EvoVulkan/Tools/Singleton.h>
+#include <EvoVulkan/Tools/NonCopyable.h>
 
 namespace EvoVulkan::Tools {
+    /// read-only view of the whole file, pages are loaded by OS on access
+    class DLL_EVK_EXPORT MappedFile : public NonCopyable {
+    private:
+        MappedFile() = default;
 
+    public:
+        ~MappedFile() override;
+
+        static MappedFile* Open(const std::string& path);
+
+    public:
+        EVK_NODISCARD const uint8_t* GetData() const { return m_data; }
+        EVK_NODISCARD uint64_t GetSize() const { return m_size; }
+
+    private:
+        const uint8_t* m_data    = nullptr;
+        uint64_t       m_size    = 0;
+
+    #ifdef EVK_WIN32
+        void*          m_file    = nullptr;
+        void*          m_mapping = nullptr;
+    #else
+        int32_t        m_file    = -1;
+    #endif
+
+    };
 }
 
 #endif //EVOVULKAN_FILESYSTEM_H
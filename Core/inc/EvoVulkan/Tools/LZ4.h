@@ -0,0 +1,27 @@
+//
+// Created by Monika on 18.10.2026.
+//
+
+#ifndef EVOVULKAN_LZ4_H
+#define EVOVULKAN_LZ4_H
+
+#include <EvoVulkan/macros.h>
+
+/**
+ * Codec of the LZ4 block format (https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md),
+ * blocks are compatible with LZ4_compress_default() / LZ4_decompress_safe().
+ * Compressor is a greedy single-probe one, it's used by offline baking,
+ * decompressor checks all bounds, so broken files can't write out of the destination.
+ */
+namespace EvoVulkan::Tools::LZ4 {
+    /// max size of compressed block
+    EVK_NODISCARD DLL_EVK_EXPORT uint64_t GetBound(uint64_t size);
+
+    /// @return size of the compressed block, zero if destination is too small
+    DLL_EVK_EXPORT uint64_t Compress(const uint8_t* pSrc, uint64_t srcSize, uint8_t* pDst, uint64_t dstCapacity);
+
+    /// @return true if block is valid and it's decompressed exactly into dstSize bytes
+    DLL_EVK_EXPORT bool Decompress(const uint8_t* pSrc, uint64_t srcSize, uint8_t* pDst, uint64_t dstSize);
+}
+
+#endif //EVOVULKAN_LZ4_H
@@ -0,0 +1,82 @@
+//
+// Created by Monika on 18.10.2026.
+//
+
+#ifndef EVOVULKAN_MIPCHAIN_H
+#define EVOVULKAN_MIPCHAIN_H
+
+#include <EvoVulkan/macros.h>
+
+namespace EvoVulkan::Tools {
+    class TextureCompressor;
+    class ThreadPool;
+
+    struct DLL_EVK_EXPORT MipLevel {
+        /// offset from the beginning of the chain data
+        VkDeviceSize m_offset = 0;
+        VkDeviceSize m_size   = 0;
+        uint32_t     m_width  = 0;
+        uint32_t     m_height = 0;
+    };
+
+    /**
+     * Mip chain built on CPU, levels are stored one after another in one block,
+     * so it can be uploaded with one staging allocation and one copy.
+     *
+     * Each level is a 2x2 box filter of the previous one, edge texels are repeated
+     * for odd sizes. sRGB formats are filtered in linear space, alpha is always linear.
+     * Rows of levels are split in bands which are run by the thread pool, a band starts as soon as
+     * the rows it reads are written, so the next level doesn't wait the whole previous one.
+     * Kernels are SSE2 or NEON depending on the target, AVX2 (8-bit formats) and F16C (half float)
+     * ones are chosen by CPUID at runtime.
+     * sRGB values are encoded by a table of linear buckets instead of a search.
+     *
+     * Supported formats: R8, R8G8, R8G8B8A8, B8G8R8A8 (UNORM and SRGB) and R16G16B16A16_SFLOAT.
+     * Block compressed chains are made from them by TextureCompressor.
+     */
+    class DLL_EVK_EXPORT MipChain {
+        friend class TextureCompressor;
+    public:
+        MipChain() = default;
+        ~MipChain() = default;
+
+        MipChain(MipChain&&) noexcept = default;
+        MipChain& operator=(MipChain&&) noexcept = default;
+
+        MipChain(const MipChain&) = delete;
+        MipChain& operator=(const MipChain&) = delete;
+
+    public:
+        EVK_NODISCARD static bool IsSupported(VkFormat format);
+
+        /**
+         * Copies base level and builds next ones.
+         *
+         * @param mipLevels zero means full chain down to 1x1
+         * @param pPool nullptr means that all bands are run by the calling thread
+         */
+        bool Generate(const uint8_t* pixels, VkFormat format, uint32_t width, uint32_t height, uint32_t mipLevels = 0, ThreadPool* pPool = nullptr);
+
+        void Clear();
+
+    public:
+        EVK_NODISCARD bool Valid() const { return !m_levels.empty(); }
+        EVK_NODISCARD VkFormat GetFormat() const { return m_format; }
+        EVK_NODISCARD uint32_t GetWidth() const { return m_levels.empty() ? 0 : m_levels.front().m_width; }
+        EVK_NODISCARD uint32_t GetHeight() const { return m_levels.empty() ? 0 : m_levels.front().m_height; }
+        EVK_NODISCARD uint32_t GetLevelsCount() const { return static_cast<uint32_t>(m_levels.size()); }
+        EVK_NODISCARD const MipLevel& GetLevel(uint32_t level) const { return m_levels[level]; }
+        EVK_NODISCARD const std::vector<MipLevel>& GetLevels() const { return m_levels; }
+        EVK_NODISCARD const uint8_t* GetData() const { return m_data.data(); }
+        EVK_NODISCARD const uint8_t* GetData(uint32_t level) const { return m_data.data() + m_levels[level].m_offset; }
+        EVK_NODISCARD VkDeviceSize GetSize() const { return m_data.size(); }
+
+    private:
+        VkFormat              m_format = VK_FORMAT_UNDEFINED;
+        std::vector<MipLevel> m_levels = { };
+        std::vector<uint8_t>  m_data   = { };
+
+    };
+}
+
+#endif //EVOVULKAN_MIPCHAIN_H
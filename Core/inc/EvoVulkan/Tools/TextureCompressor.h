@@ -0,0 +1,70 @@
+//
+// Created by Monika on 18.10.2026.
+//
+
+#ifndef EVOVULKAN_TEXTURECOMPRESSOR_H
+#define EVOVULKAN_TEXTURECOMPRESSOR_H
+
+#include <EvoVulkan/Tools/MipChain.h>
+#include <EvoVulkan/Tools/ThreadPool.h>
+
+namespace EvoVulkan::Tools {
+    enum class BlockCompression : uint8_t {
+        /// RGB with 1 bit alpha, 8 bytes per block
+        BC1 = 0,
+        /// RGBA, 16 bytes per block
+        BC3 = 1,
+        /// R, 8 bytes per block
+        BC4 = 2,
+        /// RG (e.g. normal maps), 16 bytes per block
+        BC5 = 3,
+        /// high quality RGBA, 16 bytes per block
+        BC7 = 4,
+        /// RGB with explicit 4 bit alpha, 16 bytes per block
+        BC2 = 5
+    };
+
+    /**
+     * Compresses RGBA8 mip chains into BCn by the bundled cmp_core (Depends/cmp_core).
+     * Every row of 4x4 blocks of every level is a job of the thread pool,
+     * the calling thread takes jobs too. Result is a MipChain with block compressed format,
+     * which can be passed to Texture::Load() directly.
+     *
+     * @note Compress() can be called from several threads at once, every call has its own cmp_core options.
+     */
+    class DLL_EVK_EXPORT TextureCompressor : public NonCopyable {
+    private:
+        TextureCompressor() = default;
+
+    public:
+        ~TextureCompressor() override;
+
+        /// @param threadsCount count of worker threads excluding the calling one, zero means hardware concurrency - 1
+        static TextureCompressor* Create(uint32_t threadsCount = 0);
+
+    public:
+        /**
+         * @param source R8G8B8A8_UNORM or R8G8B8A8_SRGB chain, BC4 uses R channel, BC5 uses R and G
+         * @param result levels of the source compressed into compression format
+         */
+        bool Compress(const MipChain& source, BlockCompression compression, MipChain& result);
+
+        /// 0 is the fastest, 1 is the best, it's applied to the next Compress() call
+        void SetQuality(float quality);
+
+        EVK_NODISCARD float GetQuality() const { return m_quality; }
+        EVK_NODISCARD uint32_t GetThreadsCount() const { return m_pool->GetThreadsCount(); }
+        EVK_NODISCARD ThreadPool* GetThreadPool() const { return m_pool; }
+
+        EVK_NODISCARD static VkFormat GetFormat(BlockCompression compression, bool sRGB);
+        EVK_NODISCARD static uint32_t GetBlockSize(BlockCompression compression);
+        EVK_NODISCARD static VkDeviceSize GetCompressedSize(BlockCompression compression, uint32_t width, uint32_t height);
+
+    private:
+        ThreadPool*          m_pool    = nullptr;
+        std::atomic<float>   m_quality = 0.5f;
+
+    };
+}
+
+#endif //EVOVULKAN_TEXTURECOMPRESSOR_H
@@ -0,0 +1,144 @@
+//
+// Created by Monika on 18.10.2026.
+//
+
+#ifndef EVOVULKAN_TEXTUREFILE_H
+#define EVOVULKAN_TEXTUREFILE_H
+
+#include <EvoVulkan/Tools/MipChain.h>
+#include <EvoVulkan/Tools/FileSystem.h>
+#include <EvoVulkan/Tools/ThreadPool.h>
+
+namespace EvoVulkan::Tools {
+    /**
+     * Native texture container (.evkt), payload is stored exactly as it is copied into image,
+     * so loading is mapping of the file and one memcpy into staging memory.
+     *
+     * Layout:
+     *  Header
+     *  MipLevel table, levels * layers entries ordered by level, then by layer,
+     *  offsets are relative to the payload
+     *  Chunk table, only if payload is supercompressed
+     *  payload, aligned to 16 bytes, raw or block compressed texels
+     *
+     * Supercompressed payload is split into chunks (ChunkSize bytes by default) which are compressed
+     * independently (lossless, on top of BCn), so Unpack() decompresses them in parallel
+     * straight into staging memory and only one chunk of the mapped file is touched by a job.
+     *
+     * Files are baked by Save() from mip chains, e.g. built by MipChain and compressed by TextureCompressor.
+     */
+    class DLL_EVK_EXPORT TextureFile : public NonCopyable {
+    public:
+        static constexpr uint32_t Magic     = 0x544B5645; /// "EVKT"
+        static constexpr uint32_t Version   = 2;
+        static constexpr uint32_t ChunkSize = 256 * 1024;
+
+        enum Flags : uint32_t {
+            None    = 0,
+            CubeMap = 1 << 0
+        };
+
+        enum class Supercompression : uint32_t {
+            None = 0,
+            LZ4  = 1
+        };
+
+        struct Header {
+            uint32_t m_magic       = Magic;
+            uint32_t m_version     = Version;
+            uint32_t m_format      = VK_FORMAT_UNDEFINED;
+            uint32_t m_width       = 0;
+            uint32_t m_height      = 0;
+            uint32_t m_levels      = 0;
+            uint32_t m_layers      = 0;
+            uint32_t m_flags       = None;
+            uint32_t m_compression = static_cast<uint32_t>(Supercompression::None);
+            uint32_t m_chunkSize   = 0;
+            uint32_t m_chunksCount = 0;
+            uint32_t m_reserved    = 0;
+        };
+
+        /// chunk i holds bytes [i * m_chunkSize, i * m_chunkSize + m_rawSize) of the unpacked payload
+        struct Chunk {
+            /// offset in the stored payload
+            uint64_t m_offset  = 0;
+            /// stored size, chunk isn't compressed if it's equal to m_rawSize
+            uint32_t m_size    = 0;
+            uint32_t m_rawSize = 0;
+        };
+
+    private:
+        TextureFile() = default;
+
+    public:
+        ~TextureFile() override;
+
+        /// maps the file and validates header and table, payload isn't read
+        static TextureFile* Open(const std::string& path);
+
+        /**
+         * @param layers chains of the same format and size, six faces (+X, -X, +Y, -Y, +Z, -Z) for cube map
+         */
+        static bool Save(const std::string& path, std::span<const MipChain* const> layers, bool cubeMap = false,
+            Supercompression compression = Supercompression::None);
+        static bool Save(const std::string& path, const MipChain& mipChain, Supercompression compression = Supercompression::None);
+
+        /**
+         * Copies or decompresses payload into destination, e.g. mapped staging memory.
+         *
+         * @param pDestination at least GetPayloadSize() bytes
+         * @param pPool if it's not nullptr, chunks are decompressed by its workers
+         */
+        bool Unpack(uint8_t* pDestination, ThreadPool* pPool = nullptr) const;
+
+        /**
+         * Copies or decompresses a part of the payload, e.g. a few levels of streamed texture.
+         * Only chunks which overlap the range are decompressed.
+         *
+         * @param offset offset in the unpacked payload, e.g. MipLevel::m_offset
+         */
+        bool UnpackRange(uint8_t* pDestination, VkDeviceSize offset, VkDeviceSize size) const;
+
+    public:
+        EVK_NODISCARD const std::string& GetPath() const { return m_path; }
+        EVK_NODISCARD VkFormat GetFormat() const { return static_cast<VkFormat>(m_header.m_format); }
+        EVK_NODISCARD uint32_t GetWidth() const { return m_header.m_width; }
+        EVK_NODISCARD uint32_t GetHeight() const { return m_header.m_height; }
+        EVK_NODISCARD uint32_t GetLevelsCount() const { return m_header.m_levels; }
+        EVK_NODISCARD uint32_t GetLayersCount() const { return m_header.m_layers; }
+        EVK_NODISCARD bool IsCubeMap() const { return m_header.m_flags & CubeMap; }
+        EVK_NODISCARD Supercompression GetSupercompression() const { return static_cast<Supercompression>(m_header.m_compression); }
+
+        EVK_NODISCARD const MipLevel* GetSubresources() const { return m_subresources; }
+        EVK_NODISCARD const MipLevel& GetSubresource(uint32_t level, uint32_t layer) const {
+            return m_subresources[level * m_header.m_layers + layer];
+        }
+
+        /// size of the unpacked payload
+        EVK_NODISCARD VkDeviceSize GetPayloadSize() const { return m_payloadSize; }
+        /// size of the payload in the file
+        EVK_NODISCARD VkDeviceSize GetStoredSize() const { return m_storedSize; }
+        /// stored payload in the mapped file, it's equal to the unpacked one if it isn't supercompressed
+        EVK_NODISCARD const uint8_t* GetPayload() const { return m_payload; }
+        /// offset of the first subresource of the level in the unpacked payload, payload size for levels count
+        EVK_NODISCARD VkDeviceSize GetLevelOffset(uint32_t level) const {
+            return level < m_header.m_levels ? GetSubresource(level, 0).m_offset : m_payloadSize;
+        }
+        /// offset of the payload from the beginning of the file
+        EVK_NODISCARD VkDeviceSize GetPayloadOffset() const { return m_payload - m_file->GetData(); }
+
+    private:
+        MappedFile*     m_file         = nullptr;
+        std::string     m_path         = { };
+
+        Header          m_header       = { };
+        const MipLevel* m_subresources = nullptr;
+        const Chunk*    m_chunks       = nullptr;
+        const uint8_t*  m_payload      = nullptr;
+        VkDeviceSize    m_storedSize   = 0;
+        VkDeviceSize    m_payloadSize  = 0;
+
+    };
+}
+
+#endif //EVOVULKAN_TEXTUREFILE_H
@@ -0,0 +1,72 @@
+//
+// Created by Monika on 18.10.2026.
+//
+
+#ifndef EVOVULKAN_THREADPOOL_H
+#define EVOVULKAN_THREADPOOL_H
+
+#include <EvoVulkan/Tools/NonCopyable.h>
+
+namespace EvoVulkan::Tools {
+    /**
+     * Workers for CPU-side texture jobs (block compression, decompression of containers, file reads).
+     * Execute() runs jobs of one Group: the calling thread takes jobs of its group too
+     * and waits only them, so it may be called from other jobs and from several threads at once.
+     * Enqueue() doesn't wait, owner of the job tracks its completion itself.
+     */
+    class DLL_EVK_EXPORT ThreadPool : public NonCopyable {
+    private:
+        ThreadPool() = default;
+
+    public:
+        ~ThreadPool() override;
+
+        /// @param threadsCount count of worker threads excluding the calling one, zero means hardware concurrency - 1
+        static ThreadPool* Create(uint32_t threadsCount = 0);
+
+        /**
+         * Jobs whose completion is tracked together. Jobs may add next jobs of their group,
+         * Wait() runs them on the calling thread until all jobs of the group are complete.
+         */
+        class DLL_EVK_EXPORT Group : public NonCopyable {
+            struct State;
+        public:
+            explicit Group(ThreadPool* pPool);
+            ~Group() override;
+
+        public:
+            void Run(std::function<void()>&& job);
+            void Wait();
+
+        private:
+            /// shared with tickets of workers, which may outlive the group
+            std::shared_ptr<State> m_state;
+            ThreadPool*            m_pool = nullptr;
+
+        };
+
+    public:
+        void Execute(std::vector<std::function<void()>>&& jobs);
+        void Enqueue(std::function<void()>&& job);
+
+        /// runs one job on the calling thread, returns false if there are no jobs
+        bool RunJob();
+
+        EVK_NODISCARD uint32_t GetThreadsCount() const { return static_cast<uint32_t>(m_threads.size()) + 1; }
+
+    private:
+        void ThreadLoop();
+
+    private:
+        std::vector<std::thread>          m_threads = { };
+        std::deque<std::function<void()>> m_jobs    = { };
+
+        std::mutex                        m_mutex;
+        std::condition_variable           m_condition;
+
+        bool                              m_stop    = false;
+
+    };
+}
+
+#endif //EVOVULKAN_THREADPOOL_H
@@ -39,6 +39,7 @@ namespace EvoVulkan::Tools {
     DLL_EVK_EXPORT VkShaderModule LoadShaderModule(const char *fileName, VkDevice device);
 
     DLL_EVK_EXPORT VkPipelineLayout CreatePipelineLayout(const VkDevice& device, uint32_t setLayoutCount, VkDescriptorSetLayout descriptorSetLayout, const std::vector<VkPushConstantRange>& pushConstants);
+    DLL_EVK_EXPORT VkPipelineLayout CreatePipelineLayout(const VkDevice& device, const std::vector<VkDescriptorSetLayout>& setLayouts, const std::vector<VkPushConstantRange>& pushConstants);
 
     DLL_EVK_EXPORT VkDescriptorSetLayout CreateDescriptorLayout(const VkDevice& device, const std::vector<VkDescriptorSetLayoutBinding>& setLayoutBindings);
 
@@ -436,10 +437,60 @@ namespace EvoVulkan::Tools {
 
         //!=============================================================================================================
 
+        VkPhysicalDeviceVulkan12Features supportedVulkan12Features = { };
+        supportedVulkan12Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+
+        VkPhysicalDeviceFeatures2 supportedFeatures2 = { };
+        supportedFeatures2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+        supportedFeatures2.pNext = (void*)&supportedVulkan12Features;
+
+        vkGetPhysicalDeviceFeatures2(physicalDevice, &supportedFeatures2);
+
         VkPhysicalDeviceVulkan12Features deviceVulkan12Features = { };
         deviceVulkan12Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
         deviceVulkan12Features.pNext = nullptr;
         /// deviceVulkan12Features.separateDepthStencilLayouts = VK_TRUE;
+        /// used by uploads on the transfer queue
+        deviceVulkan12Features.timelineSemaphore = supportedVulkan12Features.timelineSemaphore;
+        /// used by bindless textures (Core::BindlessTextures)
+        deviceVulkan12Features.runtimeDescriptorArray                       = supportedVulkan12Features.runtimeDescriptorArray;
+        deviceVulkan12Features.descriptorBindingPartiallyBound              = supportedVulkan12Features.descriptorBindingPartiallyBound;
+        deviceVulkan12Features.descriptorBindingSampledImageUpdateAfterBind = supportedVulkan12Features.descriptorBindingSampledImageUpdateAfterBind;
+        deviceVulkan12Features.descriptorBindingUpdateUnusedWhilePending    = supportedVulkan12Features.descriptorBindingUpdateUnusedWhilePending;
+        deviceVulkan12Features.shaderSampledImageArrayNonUniformIndexing    = supportedVulkan12Features.shaderSampledImageArrayNonUniformIndexing;
+
+    #ifdef VK_EXT_host_image_copy
+        /// extension is requested by Types::Device::Create only if the feature is supported
+        VkPhysicalDeviceHostImageCopyFeaturesEXT hostImageCopyFeatures = { };
+        hostImageCopyFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_IMAGE_COPY_FEATURES_EXT;
+        hostImageCopyFeatures.pNext = nullptr;
+        hostImageCopyFeatures.hostImageCopy = VK_TRUE;
+
+        for (auto&& extension : extensions) {
+            if (strcmp(extension, VK_EXT_HOST_IMAGE_COPY_EXTENSION_NAME) == 0) {
+                deviceVulkan12Features.pNext = (void*)&hostImageCopyFeatures;
+                break;
+            }
+        }
+    #endif
+
+    #ifdef VK_EXT_descriptor_buffer
+        /// extension is requested by Types::Device::Create only if the feature is supported
+        VkPhysicalDeviceDescriptorBufferFeaturesEXT descriptorBufferFeatures = { };
+        descriptorBufferFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_FEATURES_EXT;
+        descriptorBufferFeatures.pNext = nullptr;
+        descriptorBufferFeatures.descriptorBuffer = VK_TRUE;
+
+        for (auto&& extension : extensions) {
+            if (strcmp(extension, VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME) == 0) {
+                descriptorBufferFeatures.pNext = deviceVulkan12Features.pNext;
+                deviceVulkan12Features.pNext = (void*)&descriptorBufferFeatures;
+                /// descriptor buffers are bound by their addresses
+                deviceVulkan12Features.bufferDeviceAddress = VK_TRUE;
+                break;
+            }
+        }
+    #endif
 
         //!=============================================================================================================
 
@@ -489,12 +540,59 @@ namespace EvoVulkan::Tools {
         return device;
     }
 
-    EVK_MAYBE_UNUSED static bool CopyBufferToImage(Types::CmdBuffer* copyCmd, VkBuffer buffer, VkImage image, uint32_t width, uint32_t height) {
+    /// size of one texel in bytes, zero for block compressed and unknown formats
+    EVK_MAYBE_UNUSED static uint32_t GetTexelSize(VkFormat format) {
+        switch (format) {
+            case VK_FORMAT_R8_UNORM:
+            case VK_FORMAT_R8_SNORM:
+            case VK_FORMAT_R8_UINT:
+            case VK_FORMAT_R8_SRGB:
+                return 1;
+            case VK_FORMAT_R8G8_UNORM:
+            case VK_FORMAT_R8G8_SNORM:
+            case VK_FORMAT_R8G8_UINT:
+            case VK_FORMAT_R8G8_SRGB:
+            case VK_FORMAT_R16_UNORM:
+            case VK_FORMAT_R16_SFLOAT:
+                return 2;
+            case VK_FORMAT_R8G8B8_UNORM:
+            case VK_FORMAT_R8G8B8_SRGB:
+            case VK_FORMAT_B8G8R8_UNORM:
+            case VK_FORMAT_B8G8R8_SRGB:
+                return 3;
+            case VK_FORMAT_R8G8B8A8_UNORM:
+            case VK_FORMAT_R8G8B8A8_SNORM:
+            case VK_FORMAT_R8G8B8A8_UINT:
+            case VK_FORMAT_R8G8B8A8_SRGB:
+            case VK_FORMAT_B8G8R8A8_UNORM:
+            case VK_FORMAT_B8G8R8A8_SRGB:
+            case VK_FORMAT_A8B8G8R8_UNORM_PACK32:
+            case VK_FORMAT_A8B8G8R8_SRGB_PACK32:
+            case VK_FORMAT_A2B10G10R10_UNORM_PACK32:
+            case VK_FORMAT_R16G16_UNORM:
+            case VK_FORMAT_R16G16_SFLOAT:
+            case VK_FORMAT_R32_SFLOAT:
+            case VK_FORMAT_B10G11R11_UFLOAT_PACK32:
+                return 4;
+            case VK_FORMAT_R16G16B16A16_UNORM:
+            case VK_FORMAT_R16G16B16A16_SFLOAT:
+            case VK_FORMAT_R32G32_SFLOAT:
+                return 8;
+            case VK_FORMAT_R32G32B32_SFLOAT:
+                return 12;
+            case VK_FORMAT_R32G32B32A32_SFLOAT:
+                return 16;
+            default:
+                return 0;
+        }
+    }
+
+    EVK_MAYBE_UNUSED static bool CopyBufferToImage(Types::CmdBuffer* copyCmd, VkBuffer buffer, VkImage image, uint32_t width, uint32_t height, VkDeviceSize offset = 0) {
         if (!copyCmd->IsBegin())
             copyCmd->Begin(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
 
         VkBufferImageCopy region = {};
-        region.bufferOffset      = 0;
+        region.bufferOffset      = offset;
         region.bufferRowLength   = 0;
         region.bufferImageHeight = 0;
         region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
@@ -563,8 +661,9 @@ namespace EvoVulkan::Tools {
 
         samplerIC.borderColor = VK_BORDER_COLOR_FLOAT_OPAQUE_WHITE;
 
-        VkSampler sampler = VK_NULL_HANDLE;
-        if (vkCreateSampler(*pDevice, &samplerIC, nullptr, &sampler) != VK_SUCCESS) {
+        /// sampler is shared, it has to be released by Device::GetSamplerCache()
+        VkSampler sampler = pDevice->GetSamplerCache()->Acquire(samplerIC);
+        if (sampler == VK_NULL_HANDLE) {
             VK_ERROR("Tools::CreateSampler() : failed to create vulkan sampler!");
             return VK_NULL_HANDLE;
         }
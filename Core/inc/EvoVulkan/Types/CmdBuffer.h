@@ -11,8 +11,10 @@
 namespace EvoVulkan::Types {
     class CmdPool;
     class Device;
+    class UploadContext;
 
     class DLL_EVK_EXPORT CmdBuffer : public IVkObject {
+        friend class UploadContext;
     private:
         CmdBuffer()  = default;
 
@@ -29,11 +31,16 @@ namespace EvoVulkan::Types {
 
     public:
         bool Begin(const VkCommandBufferUsageFlagBits& usage);
+        /// for secondary buffers inheritance must describe render pass and framebuffer they are executed in
+        bool Begin(VkCommandBufferUsageFlags usage, const VkCommandBufferInheritanceInfo* pInheritance);
+        /// primary buffer is submitted and waited by its own fence, buffer of UploadContext keeps recording
         bool End();
 
         bool ReAlloc();
 
         EVK_NODISCARD bool IsBegin() const { return m_isBegin; }
+        EVK_NODISCARD bool IsSecondary() const { return m_buffAllocInfo.level == VK_COMMAND_BUFFER_LEVEL_SECONDARY; }
+        EVK_NODISCARD bool IsBatched() const { return m_batched; }
 
         EVK_NODISCARD bool IsComplete() const override;
         EVK_NODISCARD bool IsReady() const override;
@@ -42,6 +49,8 @@ namespace EvoVulkan::Types {
 
     private:
         bool                        m_isBegin       = false;
+        /// owned by UploadContext, which ends and submits the buffer
+        bool                        m_batched       = false;
         VkCommandBuffer             m_buffer        = VK_NULL_HANDLE;
         const Device*               m_device        = nullptr;
         const CmdPool*              m_cmdPool       = nullptr;
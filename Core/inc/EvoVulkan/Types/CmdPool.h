@@ -21,12 +21,18 @@ namespace EvoVulkan::Types {
 
     public:
         static CmdPool* Create(Device* device);
+        static CmdPool* Create(Device* device, VkCommandPoolCreateFlags flags, uint32_t queueFamilyIndex);
+
+        /// all command buffers allocated from the pool will be returned to initial state
+        bool Reset();
 
         EVK_NODISCARD bool IsReady() const override;
+        EVK_NODISCARD uint32_t GetQueueFamilyIndex() const { return m_queueFamilyIndex; }
 
     private:
         VkCommandPool m_pool = VK_NULL_HANDLE;
         Device* m_device = nullptr;
+        uint32_t m_queueFamilyIndex = 0;
 
     };
 }
@@ -0,0 +1,87 @@
+//
+// Created by Monika on 18.10.2026.
+//
+
+#ifndef EVOVULKAN_CMDRECORDER_H
+#define EVOVULKAN_CMDRECORDER_H
+
+#include <EvoVulkan/Types/CmdPool.h>
+#include <EvoVulkan/Types/CmdBuffer.h>
+
+namespace EvoVulkan::Types {
+    class Device;
+
+    /**
+     * Records secondary command buffers on several threads.
+     *
+     * Every thread owns its command pool, tasks are split into contiguous ranges,
+     * so task i is always recorded by the same thread into the same buffer.
+     * Execute() inserts buffers into primary one in tasks order.
+     *
+     * @note Record() resets all pools of the recorder, so buffers of the previous
+     * recording must not be in use by GPU. With frames in flight create one recorder per frame slot.
+     * @note Dynamic state isn't inherited, viewport and scissor must be set in each task.
+     */
+    class DLL_EVK_EXPORT CmdRecorder : public Tools::NonCopyable {
+    public:
+        /// returns false if recording of the task is failed
+        using Task = std::function<bool(VkCommandBuffer cmd, uint32_t index)>;
+
+    private:
+        struct Worker {
+            CmdPool*                m_pool    = nullptr;
+            std::vector<CmdBuffer*> m_buffers = { };
+        };
+
+    private:
+        CmdRecorder() = default;
+
+    public:
+        ~CmdRecorder() override;
+
+        /// @param threadsCount count of recording threads including the calling one
+        static CmdRecorder* Create(Device* device, uint32_t threadsCount);
+
+    public:
+        /**
+         * @param inheritance render pass, subpass and framebuffer the buffers will be executed in
+         * @param tasksCount count of secondary buffers
+         */
+        bool Record(const VkCommandBufferInheritanceInfo& inheritance, uint32_t tasksCount, const Task& task);
+
+        /// primary buffer should begin render pass with VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS
+        void Execute(VkCommandBuffer primary) const;
+
+        EVK_NODISCARD uint32_t GetThreadsCount() const { return static_cast<uint32_t>(m_workers.size()); }
+        EVK_NODISCARD const std::vector<VkCommandBuffer>& GetRecorded() const { return m_recorded; }
+
+    private:
+        void ThreadLoop(uint32_t index);
+        bool RecordRange(uint32_t index);
+
+    private:
+        Device*                        m_device      = nullptr;
+
+        std::vector<Worker>            m_workers     = { };
+        std::vector<std::thread>       m_threads     = { };
+
+        std::mutex                     m_mutex;
+        std::condition_variable        m_condition;
+        std::condition_variable        m_completeCondition;
+
+        uint64_t                       m_generation  = 0;
+        uint32_t                       m_pending     = 0;
+        bool                           m_stop        = false;
+        bool                           m_failed      = false;
+
+        const Task*                    m_task        = nullptr;
+        VkCommandBufferInheritanceInfo m_inheritance = { };
+        uint32_t                       m_tasksCount  = 0;
+
+        /// buffers in tasks order
+        std::vector<VkCommandBuffer>   m_recorded    = { };
+
+    };
+}
+
+#endif //EVOVULKAN_CMDRECORDER_H
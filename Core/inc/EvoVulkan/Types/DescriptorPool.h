@@ -42,7 +42,12 @@ namespace EvoVulkan::Types {
 
     public:
         static DescriptorPool* Create(VkDevice device, uint32_t maxSets, const std::vector<VkDescriptorPoolSize>& sizes);
-        static DescriptorPool* Create(VkDevice device, uint32_t maxSets, VkDescriptorSetLayout layout, const RequestTypes& requestTypes);
+        /**
+         * @param setSizes descriptors of each type in one set of the layout (Device::GetDescriptorSetLayoutSizes()),
+         * pool holds them for maxSets sets, if it's empty pool is sized by PoolSizes multipliers of request types
+         */
+        static DescriptorPool* Create(VkDevice device, uint32_t maxSets, VkDescriptorSetLayout layout, const RequestTypes& requestTypes,
+            const std::vector<VkDescriptorPoolSize>& setSizes = { });
         static bool Contains(const RequestTypes& types, const VkDescriptorType& type);
 
     public:
@@ -53,6 +58,7 @@ namespace EvoVulkan::Types {
 
         EVK_NODISCARD bool IsOutOfMemory() const;
         EVK_NODISCARD uint32_t GetUsageCount() const { return m_used; }
+        EVK_NODISCARD uint32_t GetMaxSets() const { return m_maxSets; }
         EVK_NODISCARD VkDescriptorSetLayout GetLayout() const { return m_layout; }
 
     private:
@@ -7,6 +7,10 @@
 
 #include <EvoVulkan/Tools/NonCopyable.h>
 
+namespace EvoVulkan::Core {
+    class DescriptorBuffer;
+}
+
 namespace EvoVulkan::Types {
     class DescriptorPool;
 
@@ -26,19 +30,35 @@ namespace EvoVulkan::Types {
             , pPool(pPool)
         { }
 
+        /// set in descriptor buffer, it doesn't have vulkan handle
+        DescriptorSet(VkDescriptorSetLayout layout, Core::DescriptorBuffer* pBuffer, VkDeviceSize offset)
+            : layout(layout)
+            , pBuffer(pBuffer)
+            , offset(offset)
+        { }
+
         void Reset() noexcept {
             descriptorSet = VK_NULL_HANDLE;
             layout = VK_NULL_HANDLE;
             pPool = nullptr;
+            pBuffer = nullptr;
+            offset = 0;
         }
 
         EVK_NODISCARD bool Valid() const noexcept {
+            if (pBuffer) {
+                return layout != VK_NULL_HANDLE;
+            }
+
             return descriptorSet != VK_NULL_HANDLE && layout != VK_NULL_HANDLE && pPool;
         }
 
         VkDescriptorSet descriptorSet = VK_NULL_HANDLE;
         VkDescriptorSetLayout layout = VK_NULL_HANDLE;
         DescriptorPool* pPool = nullptr;
+        /// descriptor buffer backend (Core::DescriptorBuffer), set is a range of the buffer
+        Core::DescriptorBuffer* pBuffer = nullptr;
+        VkDeviceSize offset = 0;
 
         operator VkDescriptorSet() const { return descriptorSet; }
     };
@@ -11,6 +11,7 @@
 #include <EvoVulkan/Tools/VulkanHelper.h>
 #include <EvoVulkan/Types/FamilyQueues.h>
 #include <EvoVulkan/Types/Instance.h>
+#include <EvoVulkan/Types/SamplerCache.h>
 
 #include <EvoVulkan/Tools/NonCopyable.h>
 
@@ -29,6 +30,8 @@ namespace EvoVulkan::Types {
         std::vector<const char*> validationLayers;
         bool enableSampleShading = false;
         bool rayTracing = false;
+        /// descriptors are written into buffers (VK_EXT_descriptor_buffer) instead of descriptor sets, if it's supported
+        bool descriptorBuffer = false;
         bool multisampling = false;
         uint32_t sampleCount = 0;
     };
@@ -57,22 +60,73 @@ namespace EvoVulkan::Types {
         EVK_NODISCARD VkFormat GetDepthFormat() const;
         EVK_NODISCARD uint8_t GetMSAASamplesCount() const;
         EVK_NODISCARD FamilyQueues* GetQueues() const;
+        /// samplers of textures and framebuffers are shared through it
+        EVK_NODISCARD SamplerCache* GetSamplerCache() const noexcept { return m_samplerCache; }
         EVK_NODISCARD bool IsRayTracingSupported() const noexcept { return m_rayTracingSupported; }
+        EVK_NODISCARD bool IsTimelineSemaphoreSupported() const noexcept { return m_timelineSemaphoreSupported; }
+        /// partially bound update-after-bind arrays of sampled images with non-uniform indexing, used by bindless textures
+        EVK_NODISCARD bool IsDescriptorIndexingSupported() const noexcept { return m_descriptorIndexingSupported; }
+        /// max count of combined image samplers in update-after-bind set
+        EVK_NODISCARD uint32_t GetMaxBindlessTextures() const noexcept { return m_maxBindlessTextures; }
+        /// VK_EXT_descriptor_buffer is requested and enabled, set layouts and pipelines are created for descriptor buffers
+        EVK_NODISCARD bool IsDescriptorBufferEnabled() const noexcept { return m_descriptorBufferEnabled; }
+    #ifdef VK_EXT_descriptor_buffer
+        EVK_NODISCARD const VkPhysicalDeviceDescriptorBufferPropertiesEXT& GetDescriptorBufferProperties() const noexcept { return m_descriptorBufferProps; }
+    #endif
+        /// VK_EXT_host_image_copy, images are written and transitioned by host without command buffers
+        EVK_NODISCARD bool IsHostImageCopySupported() const noexcept { return m_hostImageCopySupported; }
+        /// image with these parameters and VK_IMAGE_USAGE_HOST_TRANSFER_BIT_EXT can be created and it's accessed by device optimally
+        EVK_NODISCARD bool IsHostImageCopySupported(VkFormat format, VkImageUsageFlags usage, VkImageTiling tiling, VkImageCreateFlags flags = 0) const;
+        /// layout can be used by host copies and transitions, undefined layout is always supported
+        EVK_NODISCARD bool IsHostImageLayoutSupported(VkImageLayout layout) const;
+        /// layout in which images are written by host, undefined if host copies aren't supported
+        EVK_NODISCARD VkImageLayout GetHostCopyLayout() const noexcept { return m_hostCopyLayout; }
         EVK_NODISCARD bool IsReady() const;
         EVK_NODISCARD bool IsExtensionSupported(const std::string& extension) const;
         EVK_NODISCARD bool IsSupportLinearBlitting(const VkFormat& imageFormat) const;
         EVK_NODISCARD VkCommandPool CreateCommandPool(VkCommandPoolCreateFlags flagBits) const;
 
+        /// layout is remembered with its descriptor counts, so descriptor pools for it are sized exactly
+        EVK_NODISCARD VkDescriptorSetLayout CreateDescriptorSetLayout(const std::vector<VkDescriptorSetLayoutBinding>& bindings) const;
+        void DestroyDescriptorSetLayout(VkDescriptorSetLayout layout) const;
+        /// descriptors of each type in one set, empty if the layout wasn't created by the device
+        EVK_NODISCARD std::vector<VkDescriptorPoolSize> GetDescriptorSetLayoutSizes(VkDescriptorSetLayout layout) const;
+        /**
+         * Update template of the layout, it's created at the first call and destroyed with the layout.
+         * Data is packed by ascending binding numbers, each descriptor is VkDescriptorImageInfo,
+         * VkDescriptorBufferInfo, VkBufferView or VkAccelerationStructureKHR by its type, so it's a plain struct of these members.
+         * VK_NULL_HANDLE if the layout wasn't created by the device or descriptor buffer is enabled.
+         */
+        EVK_NODISCARD VkDescriptorUpdateTemplate GetDescriptorUpdateTemplate(VkDescriptorSetLayout layout) const;
+
         uint32_t GetMemoryType(uint32_t typeBits, VkMemoryPropertyFlags properties, VkBool32 *memTypeFound = nullptr) const;
 
         void WaitQueuesIdle();
 
+        /// host analogues of layout transition and vkCmdCopyBufferToImage, image mustn't be used by device
+        bool TransitionImageLayoutOnHost(VkImage image, VkImageLayout oldLayout, VkImageLayout newLayout, const VkImageSubresourceRange& range) const;
+        /// @param data host memory of each region, buffer offsets of regions are ignored
+        bool CopyMemoryToImage(VkImage image, VkImageLayout layout, std::span<const VkBufferImageCopy> regions, std::span<const void* const> data) const;
+
+    #ifdef VK_EXT_descriptor_buffer
+        /// functions of VK_EXT_descriptor_buffer, descriptor buffer has to be enabled
+        EVK_NODISCARD VkDeviceSize GetDescriptorSetLayoutSize(VkDescriptorSetLayout layout) const;
+        EVK_NODISCARD VkDeviceSize GetDescriptorSetLayoutBindingOffset(VkDescriptorSetLayout layout, uint32_t binding) const;
+        void GetDescriptor(const VkDescriptorGetInfoEXT& info, size_t size, void* pDescriptor) const;
+        void CmdBindDescriptorBuffers(VkCommandBuffer cmd, std::span<const VkDescriptorBufferBindingInfoEXT> buffers) const;
+        void CmdSetDescriptorBufferOffsets(VkCommandBuffer cmd, VkPipelineBindPoint bindPoint, VkPipelineLayout layout, uint32_t firstSet,
+            std::span<const uint32_t> bufferIndices, std::span<const VkDeviceSize> offsets) const;
+    #endif
+
     private:
         bool Initialize(bool enableSampleShading, bool multisampling, uint32_t sampleCount);
         void CheckRayTracing(bool isRequested);
+        void CheckHostImageCopy();
+        void CheckDescriptorBuffer(bool isRequested);
 
     private:
         FamilyQueues*                    m_familyQueues            = nullptr;
+        SamplerCache*                    m_samplerCache            = nullptr;
 
         VkPhysicalDevice                 m_physicalDevice          = VK_NULL_HANDLE;
         VkDevice                         m_logicalDevice           = VK_NULL_HANDLE;
@@ -94,6 +148,35 @@ namespace EvoVulkan::Types {
         bool                             m_enableSampleShading     = false;
         bool                             m_multisampling           = false;
         bool                             m_rayTracingSupported     = false;
+        bool                             m_timelineSemaphoreSupported = false;
+        bool                             m_descriptorIndexingSupported = false;
+        bool                             m_descriptorBufferEnabled = false;
+        uint32_t                         m_maxBindlessTextures     = 0;
+        bool                             m_hostImageCopySupported  = false;
+
+        VkImageLayout                    m_hostCopyLayout          = VK_IMAGE_LAYOUT_UNDEFINED;
+        std::vector<VkImageLayout>       m_hostImageLayouts        = { };
+
+        mutable std::unordered_map<VkDescriptorSetLayout, std::vector<VkDescriptorPoolSize>> m_layoutSizes = { };
+        /// entries are made with the layout, templates are created only for layouts which are updated by them
+        mutable std::unordered_map<VkDescriptorSetLayout, std::vector<VkDescriptorUpdateTemplateEntry>> m_layoutEntries = { };
+        mutable std::unordered_map<VkDescriptorSetLayout, VkDescriptorUpdateTemplate> m_updateTemplates = { };
+        mutable std::mutex               m_layoutsMutex;
+
+    #ifdef VK_EXT_host_image_copy
+        PFN_vkCopyMemoryToImageEXT       m_copyMemoryToImage       = nullptr;
+        PFN_vkTransitionImageLayoutEXT   m_transitionImageLayout   = nullptr;
+    #endif
+
+    #ifdef VK_EXT_descriptor_buffer
+        VkPhysicalDeviceDescriptorBufferPropertiesEXT m_descriptorBufferProps = { };
+
+        PFN_vkGetDescriptorSetLayoutSizeEXT          m_getDescriptorSetLayoutSize          = nullptr;
+        PFN_vkGetDescriptorSetLayoutBindingOffsetEXT m_getDescriptorSetLayoutBindingOffset = nullptr;
+        PFN_vkGetDescriptorEXT                       m_getDescriptor                       = nullptr;
+        PFN_vkCmdBindDescriptorBuffersEXT            m_cmdBindDescriptorBuffers            = nullptr;
+        PFN_vkCmdSetDescriptorBufferOffsetsEXT       m_cmdSetDescriptorBufferOffsets       = nullptr;
+    #endif
 
     };
 }
@@ -35,6 +35,20 @@ namespace EvoVulkan::Types {
         EVK_NODISCARD uint32_t GetComputeIndex() const noexcept { return static_cast<uint32_t>(m_computeQueueFamilyIndex); }
         EVK_NODISCARD uint32_t GetTransferIndex() const noexcept { return static_cast<uint32_t>(m_transferQueueFamilyIndex); }
 
+        /// transfer queue belongs to another family, so its work can overlap rendering
+        EVK_NODISCARD bool HasDedicatedTransfer() const noexcept { return m_transferQueueFamilyIndex != m_graphicsQueueFamilyIndex; }
+
+        /**
+         * Access to VkQueue has to be externally synchronized, render thread and loader threads
+         * submit to the same queues, so all submits, presents and waits go through these functions.
+         */
+        VkResult Submit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence) const;
+        VkResult Present(VkQueue queue, const VkPresentInfoKHR& presentInfo) const;
+        VkResult WaitIdle(VkQueue queue) const;
+
+        /// the same handle can be shared by several families, so mutex is found by the handle
+        EVK_NODISCARD std::mutex& GetQueueMutex(VkQueue queue) const;
+
     private:
         bool FindIndices();
 
@@ -58,6 +72,8 @@ namespace EvoVulkan::Types {
         int32_t m_computeQueueFamilyIndex  = EVK_ID_INVALID;
         int32_t m_transferQueueFamilyIndex = EVK_ID_INVALID;
 
+        std::unordered_map<VkQueue, std::unique_ptr<std::mutex>> m_queueMutexes;
+
     };
 }
 
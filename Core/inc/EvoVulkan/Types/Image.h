@@ -12,6 +12,8 @@ namespace EvoVulkan::Memory {
 }
 
 namespace EvoVulkan::Types {
+    class UploadContext;
+
     struct DLL_EVK_EXPORT ImageCreateInfo {
         ImageCreateInfo() = default;
 
@@ -77,6 +79,11 @@ namespace EvoVulkan::Types {
 
         bool TransitionImageLayout(VkImageLayout layout, CmdBuffer* pBuffer = nullptr) const;
         bool TransitionImageLayout(VkImageLayout layout, VkImageAspectFlags aspect, CmdBuffer* pBuffer = nullptr) const;
+        /// only for images with VK_IMAGE_USAGE_HOST_TRANSFER_BIT_EXT which aren't used by device, false if it can't be done by host
+        bool TransitionImageLayoutOnHost(VkImageLayout layout, VkImageAspectFlags aspect) const;
+
+        /// passes all mips and layers from upload queue to graphics one in current layout
+        void TransferOwnership(UploadContext* pContext) const;
 
     public:
         static Image Create(const ImageCreateInfo& info);
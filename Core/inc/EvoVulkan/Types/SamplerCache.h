@@ -0,0 +1,61 @@
+//
+// Created by Monika on 18.10.2026.
+//
+
+#ifndef EVOVULKAN_SAMPLERCACHE_H
+#define EVOVULKAN_SAMPLERCACHE_H
+
+#include <EvoVulkan/Tools/NonCopyable.h>
+
+namespace EvoVulkan::Types {
+    /**
+     * Shared samplers of the device. Samplers are immutable and textures usually have the same state,
+     * so equal create infos get one reference counted sampler instead of a sampler per texture
+     * (maxSamplerAllocationCount is only 4000 on many devices).
+     *
+     * Create infos with pNext chain (e.g. reduction mode or YCbCr conversion) aren't hashed,
+     * they always get a new sampler, which is destroyed by its Release().
+     */
+    class DLL_EVK_EXPORT SamplerCache : public Tools::NonCopyable {
+        /// all fields of VkSamplerCreateInfo except sType and pNext, floats are stored by bits
+        using Key = std::array<uint32_t, 16>;
+
+        struct KeyHash {
+            size_t operator()(const Key& key) const noexcept;
+        };
+
+        struct Entry {
+            VkSampler m_sampler    = VK_NULL_HANDLE;
+            uint32_t  m_references = 0;
+        };
+
+    public:
+        explicit SamplerCache(VkDevice device)
+            : m_device(device)
+        { }
+
+        ~SamplerCache() override;
+
+    public:
+        /// returns shared sampler, it has to be released by Release() instead of vkDestroySampler()
+        EVK_NODISCARD VkSampler Acquire(const VkSamplerCreateInfo& createInfo);
+        void Release(VkSampler sampler);
+
+        /// count of unique samplers which are alive
+        EVK_NODISCARD size_t GetSamplersCount() const;
+
+    private:
+        static Key MakeKey(const VkSamplerCreateInfo& createInfo);
+
+    private:
+        VkDevice                                   m_device   = VK_NULL_HANDLE;
+
+        std::unordered_map<Key, Entry, KeyHash>    m_entries  = { };
+        std::unordered_map<VkSampler, Key>         m_keys     = { };
+
+        mutable std::mutex                         m_mutex;
+
+    };
+}
+
+#endif //EVOVULKAN_SAMPLERCACHE_H
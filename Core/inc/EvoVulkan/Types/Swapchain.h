@@ -17,6 +17,13 @@ namespace EvoVulkan::Types {
         VkImageView m_view;
     };
 
+    /// swapchain replaced by ReSetup, which images can be still in use by frames in flight
+    struct DLL_EVK_EXPORT RetiredSwapchain {
+        VkSwapchainKHR   m_swapchain   = VK_NULL_HANDLE;
+        SwapChainBuffer* m_buffers     = nullptr;
+        uint32_t         m_countImages = 0;
+    };
+
     class DLL_EVK_EXPORT Swapchain : public IVkObject {
     protected:
         Swapchain() = default;
@@ -40,6 +47,9 @@ namespace EvoVulkan::Types {
 
         void SetVSync(bool vsync);
 
+        /// destroys the oldest swapchains replaced by ReSetup, call it when all frames which used them are complete
+        void DestroyRetired(uint32_t count = UINT32_MAX);
+
         EVK_NODISCARD SwapChainBuffer* GetBuffers() const { return m_buffers; }
         EVK_NODISCARD uint32_t GetSurfaceWidth() const { return m_surfaceWidth; }
         EVK_NODISCARD uint32_t GetSurfaceHeight() const { return m_surfaceHeight; }
@@ -48,6 +58,7 @@ namespace EvoVulkan::Types {
         EVK_NODISCARD VkColorSpaceKHR GetColorSpace() const { return m_colorSpace; }
         EVK_NODISCARD bool IsVSyncEnabled() const { return m_vsync; }
         EVK_NODISCARD bool IsDirty() const { return m_dirty; }
+        EVK_NODISCARD bool HasRetired() const { return !m_retired.empty(); }
         EVK_NODISCARD bool IsReady() const override;
 
     public:
@@ -99,6 +110,8 @@ namespace EvoVulkan::Types {
 
         SwapChainBuffer* m_buffers = nullptr;
 
+        std::vector<RetiredSwapchain> m_retired;
+
         uint32_t m_surfaceWidth = 0;
         uint32_t m_surfaceHeight = 0;
 
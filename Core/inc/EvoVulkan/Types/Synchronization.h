@@ -14,12 +14,14 @@
 namespace EvoVulkan::Types {
     struct DLL_EVK_EXPORT Synchronization {
         // Swap chain image presentation
-        VkSemaphore  m_presentComplete;
+        VkSemaphore  m_presentComplete = VK_NULL_HANDLE;
         // Command buffer submission and execution
-        VkSemaphore  m_renderComplete;
+        VkSemaphore  m_renderComplete  = VK_NULL_HANDLE;
+        // Signaled when GPU has finished all work of the frame slot
+        VkFence      m_inFlight        = VK_NULL_HANDLE;
 
         [[nodiscard]] inline bool IsReady() const {
-            return m_presentComplete != VK_NULL_HANDLE && m_renderComplete != VK_NULL_HANDLE;
+            return m_presentComplete != VK_NULL_HANDLE && m_renderComplete != VK_NULL_HANDLE && m_inFlight != VK_NULL_HANDLE;
         }
     };
 }
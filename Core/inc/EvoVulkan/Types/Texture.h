@@ -10,8 +10,12 @@
 #include <EvoVulkan/Tools/VulkanDebug.h>
 #include <EvoVulkan/Tools/FileSystem.h>
 #include <EvoVulkan/Tools/VulkanTools.h>
+#include <EvoVulkan/Tools/MipChain.h>
+#include <EvoVulkan/Tools/TextureCompressor.h>
+#include <EvoVulkan/Tools/TextureFile.h>
 #include <EvoVulkan/Types/Image.h>
 #include <EvoVulkan/Types/DescriptorSet.h>
+#include <EvoVulkan/Types/UploadContext.h>
 
 namespace EvoVulkan::Memory {
     class Allocator;
@@ -19,19 +23,57 @@ namespace EvoVulkan::Memory {
 
 namespace EvoVulkan::Complexes {
     class FrameBuffer;
+    class BlockEncoder;
+    class TextureStreamer;
 }
 
 namespace EvoVulkan::Core {
     class DescriptorManager;
+    class DescriptorWriter;
 }
 
 namespace EvoVulkan::Types {
     class VmaBuffer;
     class Device;
     class CmdPool;
+    class Texture;
+
+    /// description of one texture of Texture::LoadBatch()
+    struct DLL_EVK_EXPORT TextureLoadInfo {
+        const uint8_t* pixels    = nullptr;
+        VkFormat       format    = VK_FORMAT_R8G8B8A8_UNORM;
+        int32_t        width     = 0;
+        int32_t        height    = 0;
+        /// zero means full mip chain
+        uint32_t       mipLevels = 0;
+        VkFilter       filter    = VK_FILTER_LINEAR;
+        bool           cpuUsage  = false;
+    };
+
+    struct DLL_EVK_EXPORT TextureBatch {
+        /// in order of descriptions, nullptr if the texture is failed
+        std::vector<Texture*> m_textures = { };
+        /// all textures can be used by GPU after it's complete
+        UploadTicket          m_ticket   = 0;
+    };
+
+    /// mip levels of streamed texture (Texture::LoadStreamed()) which are in device memory
+    struct DLL_EVK_EXPORT TextureResidency {
+        uint32_t     m_levels         = 0;
+        /// the most detailed resident level, levels [m_residentLevel, m_levels) are resident
+        uint32_t     m_residentLevel  = 0;
+        /// the most detailed level which is wanted by the user
+        uint32_t     m_requestedLevel = 0;
+        /// levels from it are uploaded at load and never evicted
+        uint32_t     m_tailLevel      = 0;
+        VkDeviceSize m_residentSize   = 0;
+        /// is incremented when image, view and descriptor of the texture are replaced
+        uint64_t     m_version        = 0;
+    };
 
     class DLL_EVK_EXPORT Texture : public Tools::NonCopyable {
         friend class EvoVulkan::Complexes::FrameBuffer;
+        friend class EvoVulkan::Complexes::TextureStreamer;
     public:
         struct RGBAPixel {
             uint64_t r, g, b, a;
@@ -53,7 +95,8 @@ namespace EvoVulkan::Types {
                 int32_t height,
                 const std::array<const uint8_t*, 6>& sides,
                 uint32_t mipLevels = 0,
-                bool cpuUsage = false);
+                bool cpuUsage = false,
+                UploadContext* pUploadContext = nullptr);
 
         static Texture* Load(
                 Device *device,
@@ -64,7 +107,127 @@ namespace EvoVulkan::Types {
                 VkFormat format,
                 int32_t width, int32_t height,
                 uint32_t mipLevels, VkFilter,
-                bool cpuUsage = false);
+                bool cpuUsage = false,
+                UploadContext* pUploadContext = nullptr);
+
+        /**
+         * Two-phase load: staging memory is allocated and mapped, the caller decodes pixels
+         * straight into GetStagingData() (info.pixels isn't used), EndLoad() records the copy
+         * and mips generation. There is no intermediate heap buffer and no memcpy of the image.
+         */
+        static Texture* BeginLoad(
+                Device *device,
+                Memory::Allocator *allocator,
+                Core::DescriptorManager* manager,
+                CmdPool *pool,
+                const TextureLoadInfo& info,
+                UploadContext* pUploadContext = nullptr);
+
+        /**
+         * Uploads precomputed mip chain (e.g. baked offline or built by Tools::MipChain)
+         * with one copy which has region per level, mips aren't generated on GPU.
+         * Chain can be block compressed by Tools::TextureCompressor.
+         * If device supports VK_EXT_host_image_copy for the format, levels are copied into the image by host.
+         */
+        static Texture* Load(
+                Device *device,
+                Memory::Allocator *allocator,
+                Core::DescriptorManager* manager,
+                CmdPool *pool,
+                const Tools::MipChain& mipChain,
+                VkFilter filter,
+                bool cpuUsage = false,
+                UploadContext* pUploadContext = nullptr);
+
+        /**
+         * Uploads baked container (Tools::TextureFile), payload is copied from the mapped file
+         * straight into staging memory, it isn't decoded and mips aren't generated.
+         * Supercompressed chunks are decompressed into staging memory by workers of the pool.
+         * If the upload context has a file reader, raw payload is read into staging memory
+         * in background and waited only by submission of the batch. If the read fails, Wait() of the upload ticket
+         * returns false and IsLoadFailed() is set, the caller has to release such texture.
+         * Otherwise raw payload is copied from the mapped file into the image by host, if it's supported.
+         */
+        static Texture* Load(
+                Device *device,
+                Memory::Allocator *allocator,
+                Core::DescriptorManager* manager,
+                CmdPool *pool,
+                const Tools::TextureFile& file,
+                VkFilter filter,
+                bool cpuUsage = false,
+                UploadContext* pUploadContext = nullptr,
+                Tools::ThreadPool* pThreadPool = nullptr);
+
+        /// opens container by Tools::TextureFile::Open() and loads it
+        static Texture* Load(
+                Device *device,
+                Memory::Allocator *allocator,
+                Core::DescriptorManager* manager,
+                CmdPool *pool,
+                const std::string& path,
+                VkFilter filter,
+                bool cpuUsage = false,
+                UploadContext* pUploadContext = nullptr,
+                Tools::ThreadPool* pThreadPool = nullptr);
+
+        /**
+         * Opens container and uploads only its tail levels (see TextureStreamer::SetTailSize()),
+         * other levels are streamed in by the streamer over frames. The file stays mapped while
+         * the texture is alive. Descriptor set has to be taken by GetDescriptorSet() after
+         * TextureStreamer::Update(), when the residency version is changed. Bindless index stays the same.
+         */
+        static Texture* LoadStreamed(
+                Device *device,
+                Memory::Allocator *allocator,
+                Core::DescriptorManager* manager,
+                CmdPool *pool,
+                const std::string& path,
+                VkFilter filter,
+                Complexes::TextureStreamer* pStreamer);
+
+        /**
+         * Loads textures with one staging allocation, all copies, transitions and mip blits
+         * are recorded into the batch of the upload context, which is submitted at once.
+         */
+        static TextureBatch LoadBatch(
+                Device *device,
+                Memory::Allocator *allocator,
+                Core::DescriptorManager* manager,
+                CmdPool *pool,
+                std::span<const TextureLoadInfo> infos,
+                UploadContext* pUploadContext);
+
+        /**
+         * Creates block compressed copy of the source image on GPU without CPU round-trip,
+         * e.g. for baked lightmaps or captured reflection probes. Commands are recorded
+         * into the graphics part of the upload context batch, so the frame isn't stalled.
+         *
+         * @param source sampled view (texture or framebuffer attachment) in VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL
+         * @param sRGB source contains sRGB data, it has to be read through UNORM view
+         */
+        static Texture* CompressOnGPU(
+                Device *device,
+                Memory::Allocator *allocator,
+                Core::DescriptorManager* manager,
+                CmdPool *pool,
+                VkImageView source,
+                uint32_t width, uint32_t height,
+                Complexes::BlockEncoder* pEncoder,
+                Tools::BlockCompression compression,
+                bool sRGB, float quality, VkFilter filter,
+                UploadContext* pUploadContext = nullptr);
+
+        static Texture* CompressOnGPU(
+                Texture* pSource,
+                Complexes::BlockEncoder* pEncoder,
+                Tools::BlockCompression compression,
+                float quality = 0.5f)
+        {
+            return CompressOnGPU(pSource->m_device, pSource->m_allocator, pSource->m_descriptorManager, pSource->m_pool,
+                        pSource->m_view, pSource->m_width, pSource->m_height, pEncoder, compression, false, quality,
+                        pSource->m_filter, pSource->m_uploadContext);
+        }
 
         static Texture* LoadAutoMip(
                 Device *device,
@@ -75,10 +238,11 @@ namespace EvoVulkan::Types {
                 VkFormat format,
                 int32_t width,
                 int32_t height, VkFilter filter,
-                bool cpuUsage = false)
+                bool cpuUsage = false,
+                UploadContext* pUploadContext = nullptr)
         {
             return Load(device, allocator, manager, pool, pixels, format, width, height,
-                        static_cast<uint32_t>(std::floor(std::log2(EVK_MAX(width, height)))) + 1, filter, cpuUsage);
+                        static_cast<uint32_t>(std::floor(std::log2(EVK_MAX(width, height)))) + 1, filter, cpuUsage, pUploadContext);
         }
 
         static Texture* LoadWithoutMip(
@@ -89,12 +253,19 @@ namespace EvoVulkan::Types {
                 const uint8_t* pixels,
                 VkFormat format,
                 int32_t width, int32_t height, VkFilter filter,
-                bool cpuUsage = false)
+                bool cpuUsage = false,
+                UploadContext* pUploadContext = nullptr)
         {
-            return Load(device, allocator, manager, pool, pixels, format, width, height, 1, filter, cpuUsage);
+            return Load(device, allocator, manager, pool, pixels, format, width, height, 1, filter, cpuUsage, pUploadContext);
         }
 
     public:
+        /// @return false if the texture can't be created, it has to be deleted in this case
+        bool EndLoad();
+
+        /// rows are tightly packed, it's empty after EndLoad()
+        EVK_NODISCARD std::span<uint8_t> GetStagingData() const;
+
         EVK_NODISCARD RGBAPixel GetPixel(uint32_t x, uint32_t y, uint32_t z) const;
 
         EVK_NODISCARD EVK_INLINE VkDescriptorImageInfo* GetDescriptorRef() noexcept { return &m_descriptor; }
@@ -104,10 +275,45 @@ namespace EvoVulkan::Types {
         EVK_NODISCARD EVK_INLINE VkImage GetImage() const { return m_image; }
         EVK_NODISCARD EVK_INLINE uint32_t GetWidth() const { return m_width; }
         EVK_NODISCARD EVK_INLINE uint32_t GetHeight() const { return m_height; }
+        /// texture can be used by GPU after the batch is complete, zero if it was loaded synchronously
+        EVK_NODISCARD EVK_INLINE UploadTicket GetUploadTicket() const { return m_uploadTicket; }
+        /// background file read of the texture has failed, its contents are undefined and it shouldn't be used
+        EVK_NODISCARD EVK_INLINE bool IsLoadFailed() const { return m_loadFailed; }
         Types::DescriptorSet GetDescriptorSet(VkDescriptorSetLayout layout);
+        /// write of the new set is collected by the writer, it's valid after DescriptorWriter::Flush()
+        Types::DescriptorSet GetDescriptorSet(VkDescriptorSetLayout layout, Core::DescriptorWriter& writer);
+        /**
+         * Index in the array of Core::BindlessTextures if bindless mode of the descriptor manager is enabled.
+         * It's stable, when residency of streamed texture is changed, the descriptor of the index is rewritten in place.
+         */
+        EVK_NODISCARD EVK_INLINE uint32_t GetBindlessIndex() const { return m_bindlessIndex; }
+
+        EVK_NODISCARD EVK_INLINE bool IsStreamed() const { return m_streamSource; }
+        EVK_NODISCARD EVK_INLINE const TextureResidency& GetResidency() const { return m_residency; }
+        /// the most detailed level which should be streamed in, it's clamped by the tail
+        void RequestLevel(uint32_t level) { m_residency.m_requestedLevel = EVK_MIN(level, m_residency.m_tailLevel); }
 
     private:
-        bool Create(VmaBuffer* stagingBuffer);
+        /**
+         * @param pRegions if it's not nullptr, staging buffer contains all levels, they are copied
+         * by these regions (offsets are relative to stagingOffset) and mips aren't generated
+         */
+        bool Create(VkBuffer stagingBuffer, VkDeviceSize stagingOffset, const std::vector<VkBufferImageCopy>* pRegions = nullptr, uint32_t layers = 1);
+
+        /**
+         * Writes all levels from host memory by VK_EXT_host_image_copy, there is no staging buffer,
+         * command buffer and submission, the texture is ready when it returns.
+         *
+         * @param data host memory of each region, buffer offsets of regions are ignored
+         */
+        bool CreateOnHost(std::span<const VkBufferImageCopy> regions, std::span<const void* const> data, uint32_t layers,
+            VkSamplerAddressMode addressMode = VK_SAMPLER_ADDRESS_MODE_MIRRORED_REPEAT);
+
+        /// view, sampler and descriptor of the created image
+        bool CreateSampledView(VkSamplerAddressMode addressMode);
+
+        /// writes the descriptor into bindless array, changed descriptor keeps the index
+        void UpdateBindless();
 
     private:
         Types::Image       m_image                   = Types::Image();
@@ -128,11 +334,24 @@ namespace EvoVulkan::Types {
 
         Types::Device*     m_device                  = nullptr;
         Types::CmdPool*    m_pool                    = nullptr;
+        UploadContext*     m_uploadContext           = nullptr;
+        UploadTicket       m_uploadTicket            = 0;
+        /// set by the thread which submits the batch
+        std::atomic<bool>  m_loadFailed              = false;
+        /// staging memory between BeginLoad() and EndLoad()
+        Memory::StagingRegion m_staging              = { };
+        VmaBuffer*         m_stagingBuffer           = nullptr;
         Memory::Allocator* m_allocator               = nullptr;
         Core::DescriptorManager* m_descriptorManager = nullptr;
 
         Types::DescriptorSet      m_descriptorSet     = {};
         VkDescriptorImageInfo    m_descriptor        = {};
+        uint32_t                 m_bindlessIndex     = UINT32_MAX;
+
+        /// container of streamed texture, levels are read from it
+        Tools::TextureFile*         m_streamSource   = nullptr;
+        Complexes::TextureStreamer* m_streamer       = nullptr;
+        TextureResidency            m_residency      = {};
 
     };
 }
@@ -0,0 +1,195 @@
+//
+// Created by Monika on 18.10.2026.
+//
+
+#ifndef EVOVULKAN_UPLOADCONTEXT_H
+#define EVOVULKAN_UPLOADCONTEXT_H
+
+#include <EvoVulkan/Types/CmdPool.h>
+#include <EvoVulkan/Types/CmdBuffer.h>
+#include <EvoVulkan/Memory/StagingRing.h>
+#include <EvoVulkan/Tools/AsyncFileReader.h>
+
+namespace EvoVulkan::Complexes {
+    class MipGenerator;
+}
+
+namespace EvoVulkan::Types {
+    class Device;
+    class VmaBuffer;
+
+    /// identifier of the submitted batch, zero is always complete
+    typedef uint64_t UploadTicket;
+
+    /**
+     * Collects one-time commands of many resources (copies, layout transitions, mip generation)
+     * into one command buffer and submits them as one batch with a fence.
+     *
+     * @note Command buffer returned by GetCmd() is not submitted by CmdBuffer::End(),
+     * commands are executed only after Submit(). Use Wait() if the result is needed on CPU.
+     *
+     * @note If the context is created on the queue of another family (e.g. dedicated transfer),
+     * it's asynchronous: GetCmd() is recorded for the upload queue, GetGraphicsCmd() for the graphics one.
+     * Upload batch signals timeline semaphore with ticket value, graphics part waits for it,
+     * so graphics work submitted after Submit() sees uploaded resources. Images have to be passed
+     * between queues by TransferOwnership(), upload queue can't generate mips or use shader stages.
+     */
+    class DLL_EVK_EXPORT UploadContext : public Tools::NonCopyable {
+        struct FileRead {
+            Tools::FileReadTicket              m_ticket       = 0;
+            std::function<void()>              m_onFailed     = { };
+        };
+
+        struct Batch {
+            CmdBuffer*                         m_cmd          = nullptr;
+            CmdBuffer*                         m_graphicsCmd  = nullptr;
+            bool                               m_graphicsUsed = false;
+            VkFence                            m_fence        = VK_NULL_HANDLE;
+            UploadTicket                       m_ticket       = 0;
+            std::vector<std::function<void()>> m_onComplete   = { };
+            std::vector<Memory::StagingRegion> m_regions      = { };
+            std::vector<VmaBuffer*>            m_spills       = { };
+            std::vector<FileRead>              m_fileReads    = { };
+            /// file reads are waited, the batch can be submitted
+            bool                               m_ready        = false;
+            /// some file read has failed, staging memory of the batch isn't valid
+            bool                               m_failed       = false;
+        };
+
+    private:
+        UploadContext() = default;
+
+    public:
+        ~UploadContext() override;
+
+        static UploadContext* Create(Device* device);
+        static UploadContext* Create(Device* device, uint32_t queueFamilyIndex, VkQueue queue);
+        /// asynchronous context if families are different, requires timeline semaphores
+        static UploadContext* Create(Device* device, uint32_t queueFamilyIndex, VkQueue queue, uint32_t graphicsFamilyIndex, VkQueue graphicsQueue);
+
+    public:
+        /// creates persistently mapped staging ring, without it every allocation is a temporary buffer
+        bool InitStaging(Memory::Allocator* pAllocator, VkDeviceSize size);
+
+        /**
+         * Allocates staging memory which lives until the current batch is complete.
+         * If the ring is full, waits for the oldest batches, if it's still not enough
+         * (or the size is bigger than the ring) allocates temporary buffer.
+         *
+         * @note May submit the current batch, so GetCmd() has to be called after it.
+         * @param pData if it's not nullptr, it's copied into the region
+         * @param detached region isn't attached to any batch and is owned by the caller
+         * until ReleaseStaging(), so submits and collects between them don't free it
+         */
+        EVK_NODISCARD Memory::StagingRegion AllocateStaging(VkDeviceSize size, const void* pData = nullptr, VkDeviceSize alignment = 16, bool detached = false);
+
+        /// attaches detached region to the current batch, it's freed when the batch is complete
+        void ReleaseStaging(const Memory::StagingRegion& region);
+
+        /// command buffer of the batch which is recorded now, it's already began
+        EVK_NODISCARD CmdBuffer* GetCmd();
+
+        /// graphics queue command buffer of the current batch, executed after GetCmd() one
+        EVK_NODISCARD CmdBuffer* GetGraphicsCmd();
+
+        /**
+         * Releases image from upload queue family in GetCmd() and acquires it in GetGraphicsCmd().
+         * Layout isn't changed. Does nothing if the context isn't asynchronous.
+         */
+        void TransferOwnership(VkImage image, VkImageLayout layout, const VkImageSubresourceRange& range);
+
+        /// ticket of the batch which is recorded now
+        EVK_NODISCARD UploadTicket GetCurrentTicket();
+
+        /// will be called when the current batch is complete, e.g. to free staging buffers
+        void OnComplete(std::function<void()> callback);
+
+        /**
+         * Reads into staging regions of the current batch, they are waited by Submit() before the batch is executed.
+         * @param onFailed is called if some read of the ticket has failed, e.g. to mark the texture as broken
+         */
+        void AddFileReads(Tools::FileReadTicket ticket, std::function<void()> onFailed = nullptr);
+
+        /**
+         * Submits the current batch, returns ticket which can be waited.
+         * File reads of the batch are waited without the lock, batches are submitted in order of tickets,
+         * so the batch can be submitted later by the thread which submits the previous one.
+         */
+        UploadTicket Submit();
+
+        /// submits the batch if it's still recorded and waits for its fence, false if some file read of it has failed
+        bool Wait(UploadTicket ticket);
+        bool WaitIdle();
+
+        EVK_NODISCARD bool IsComplete(UploadTicket ticket);
+
+        /// releases resources of complete batches, doesn't block
+        void Collect();
+
+        EVK_NODISCARD Device* GetDevice() const { return m_device; }
+        EVK_NODISCARD CmdPool* GetCmdPool() const { return m_pool; }
+        EVK_NODISCARD VkQueue GetQueue() const { return m_queue; }
+        EVK_NODISCARD uint32_t GetQueueFamilyIndex() const { return m_queueFamilyIndex; }
+        EVK_NODISCARD uint32_t GetGraphicsFamilyIndex() const { return m_graphicsFamilyIndex; }
+        EVK_NODISCARD bool IsAsync() const { return m_queueFamilyIndex != m_graphicsFamilyIndex; }
+        EVK_NODISCARD Memory::StagingRing* GetStagingRing() const { return m_staging; }
+        EVK_NODISCARD Complexes::MipGenerator* GetMipGenerator() const { return m_mipGenerator; }
+        EVK_NODISCARD Tools::AsyncFileReader* GetFileReader() const { return m_fileReader; }
+
+        /// textures use it instead of blits if format is supported, isn't owned by the context
+        void SetMipGenerator(Complexes::MipGenerator* pGenerator) { m_mipGenerator = pGenerator; }
+
+        /**
+         * Textures read files by it straight into staging memory, isn't owned by the context.
+         * Staging ring is registered in the reader, so InitStaging() has to be called before.
+         */
+        void SetFileReader(Tools::AsyncFileReader* pReader);
+
+        /// signaled with ticket value when upload part of the batch is complete, VK_NULL_HANDLE if not asynchronous
+        EVK_NODISCARD VkSemaphore GetTimelineSemaphore() const { return m_timeline; }
+
+    private:
+        Batch* AcquireBatch();
+        void ReleaseBatch(Batch* pBatch);
+        /// submits batches which file reads are waited, in order of tickets, false if the batch of the ticket has failed
+        bool SubmitReady(UploadTicket ticket);
+        bool SubmitBatch(Batch* pBatch);
+        bool IsSubmitting(UploadTicket ticket) const;
+        bool WaitBatch(Batch* pBatch);
+        bool WaitTimeline(UploadTicket ticket);
+
+    private:
+        Device*                      m_device              = nullptr;
+        CmdPool*                     m_pool                = nullptr;
+        VkQueue                      m_queue               = VK_NULL_HANDLE;
+        uint32_t                     m_queueFamilyIndex    = 0;
+
+        CmdPool*                     m_graphicsPool        = nullptr;
+        VkQueue                      m_graphicsQueue       = VK_NULL_HANDLE;
+        uint32_t                     m_graphicsFamilyIndex = 0;
+        VkSemaphore                  m_timeline            = VK_NULL_HANDLE;
+
+        Memory::Allocator*           m_allocator           = nullptr;
+        Memory::StagingRing*         m_staging             = nullptr;
+        Complexes::MipGenerator*     m_mipGenerator        = nullptr;
+        Tools::AsyncFileReader*      m_fileReader          = nullptr;
+
+        Batch*                       m_current             = nullptr;
+        /// batches which aren't recorded anymore, but wait for file reads or for the previous batches
+        std::deque<Batch*>           m_submitting          = { };
+        std::vector<Batch*>          m_pending             = { };
+        std::vector<Batch*>          m_free                = { };
+        /// temporary buffers of detached regions, found by buffer handle on release
+        std::vector<VmaBuffer*>      m_detachedSpills      = { };
+
+        UploadTicket                 m_nextTicket          = 1;
+        UploadTicket                 m_lastSubmitted       = 0;
+
+        mutable std::recursive_mutex m_mutex;
+        /// notified when batches are moved from submitting to pending
+        std::condition_variable_any  m_submitCondition;
+
+    };
+}
+
+#endif //EVOVULKAN_UPLOADCONTEXT_H
@@ -16,9 +16,12 @@
 #include <EvoVulkan/Types/RenderPass.h>
 
 #include <EvoVulkan/DescriptorManager.h>
+#include <EvoVulkan/FrameDescriptorAllocator.h>
 #include <EvoVulkan/Complexes/Framebuffer.h>
 
 #include <EvoVulkan/Types/MultisampleTarget.h>
+#include <EvoVulkan/Types/CmdRecorder.h>
+#include <EvoVulkan/Types/UploadContext.h>
 
 namespace EvoVulkan::Core {
     enum class FrameResult : uint8_t {
@@ -27,7 +30,9 @@ namespace EvoVulkan::Core {
         OutOfDate,
         DeviceLost,
         Dirty,
-        Suboptimal
+        Suboptimal,
+        /// image isn't acquired because new sizes are received, kernel has to be re-created before the next frame
+        Skip
     };
 
     enum class RenderResult : uint8_t {
@@ -67,10 +72,12 @@ namespace EvoVulkan::Core {
     public:
         EVK_NODISCARD EVK_INLINE VkPipelineCache GetPipelineCache() const noexcept { return m_pipelineCache; }
         EVK_NODISCARD EVK_INLINE VkCommandBuffer* GetDrawCmdBuffs() const { return m_drawCmdBuffs; }
+        EVK_NODISCARD EVK_INLINE VkCommandBuffer GetFrameCmdBuffer() const { return m_frameCmdBuffs ? m_frameCmdBuffs[m_currentFrame] : VK_NULL_HANDLE; }
         EVK_NODISCARD EVK_INLINE Types::Device* GetDevice() const { return m_device; }
         EVK_NODISCARD EVK_INLINE Memory::Allocator* GetAllocator() const { return m_allocator; }
         EVK_NODISCARD EVK_INLINE Types::MultisampleTarget* GetMultisampleTarget() const { return m_multisample; }
         EVK_NODISCARD EVK_INLINE Types::CmdPool* GetCmdPool() const { return m_cmdPool; }
+        EVK_NODISCARD EVK_INLINE Types::UploadContext* GetUploadContext() const { return m_uploadContext; }
         EVK_NODISCARD EVK_INLINE Types::Swapchain* GetSwapchain() const { return m_swapchain; }
         EVK_NODISCARD EVK_INLINE Types::Surface* GetSurface() const { return m_surface; }
         EVK_NODISCARD EVK_INLINE VkInstance GetInstance() const { return *m_instance; }
@@ -85,22 +92,28 @@ namespace EvoVulkan::Core {
         EVK_NODISCARD EVK_INLINE bool IsMultisamplingEnabled() const noexcept { return m_sampleCount > 1; }
         EVK_NODISCARD EVK_INLINE VkSemaphore GetPresentCompleteSemaphore() const noexcept { return m_syncs.m_presentComplete; }
         EVK_NODISCARD EVK_INLINE VkSemaphore GetRenderCompleteSemaphore() const noexcept { return m_syncs.m_renderComplete; }
+        EVK_NODISCARD EVK_INLINE VkFence GetFrameFence() const noexcept { return m_syncs.m_inFlight; }
+        EVK_NODISCARD EVK_INLINE uint32_t GetCurrentFrame() const noexcept { return m_currentFrame; }
+        EVK_NODISCARD EVK_INLINE uint32_t GetCurrentImage() const noexcept { return m_currentBuffer; }
+        EVK_NODISCARD EVK_INLINE uint32_t GetFramesInFlight() const noexcept { return m_framesInFlight; }
         EVK_NODISCARD std::vector<VkSemaphore>& GetWaitSemaphores() { return m_submitInfo.waitSemaphores; }
 
         EVK_NODISCARD uint8_t GetSampleCount() const;
         EVK_NODISCARD EvoVulkan::Types::CmdBuffer* CreateSingleTimeCmd() const;
         EVK_NODISCARD EvoVulkan::Types::CmdBuffer* CreateCmd() const;
+        EVK_NODISCARD EvoVulkan::Types::CmdRecorder* CreateCmdRecorder(uint32_t threadsCount) const;
+        /// for secondary buffers executed in the swapchain render pass
+        EVK_NODISCARD VkCommandBufferInheritanceInfo GetInheritanceInfo(uint32_t imageIndex) const;
         EVK_NODISCARD Core::DescriptorManager* GetDescriptorManager() const;
+        /// transient sets of the current frame slot, nullptr with descriptor buffer
+        EVK_NODISCARD Core::FrameDescriptorAllocator* GetFrameDescriptors() const { return m_frameDescriptors; }
         EVK_NODISCARD uint32_t GetCountBuildIterations() const;
         EVK_NODISCARD bool IsGUIEnabled() const { return m_GUIEnabled; }
         EVK_NODISCARD bool IsValidationLayersEnabled() const { return m_validationEnabled; }
         EVK_NODISCARD bool IsSurfaceCollapsed() const { return m_paused; }
+        EVK_NODISCARD bool IsResizePending() const { return m_resizePending; }
         EVK_NODISCARD VkPipelineStageFlags GetSubmitPipelineStages() const { return m_submitPipelineStages; }
 
-        EVK_NODISCARD virtual bool IsWindowValid() const { return true; }
-
-        virtual void PollWindowEvents() { }
-
         void ClearSubmitQueue();
         void PrintSubmitQueue();
         void AddSubmitQueue(SubmitInfo submitInfo);
@@ -115,7 +128,16 @@ namespace EvoVulkan::Core {
         virtual bool IsRayTracingRequired() const noexcept { return false; }
 
         bool SetValidationLayersEnabled(bool value);
+        bool SetFramesInFlight(uint32_t count);
+        bool SetStagingSize(VkDeviceSize size);
         void SetSize(uint32_t width, uint32_t height);
+        /**
+         * Has to be called for OutOfDate, Skip and Dirty results of PrepareFrame and OutOfDate of SubmitFrame.
+         * Suboptimal frame is submitted and presented first, then the kernel is re-created for it.
+         * Image which is acquired but not presented is released before re-creation.
+         * Doesn't wait for the device: old swapchain, frame buffers and draw command buffers are retired
+         * and destroyed by PrepareFrame when the frames which used them are complete.
+         */
         bool ReCreate(FrameResult reason);
 
     public:
@@ -127,14 +149,37 @@ namespace EvoVulkan::Core {
     protected:
         virtual RenderResult Render() { return RenderResult::Fatal; }
 
+    private:
+        /// resources of the previous swapchain which can be still used by frames in flight
+        struct RetiredFrameResources {
+            /// number of the first frame which doesn't use these resources
+            uint64_t                   m_frame        = 0;
+            std::vector<VkFramebuffer> m_frameBuffers = { };
+            Types::RenderPass          m_renderPass   = { };
+            Types::MultisampleTarget*  m_multisample  = nullptr;
+            VkCommandBuffer*           m_drawCmdBuffs = nullptr;
+            uint8_t                    m_countDCB     = 0;
+        };
+
     private:
         bool ReCreateFrameBuffers();
         bool ReCreateSynchronizations();
+        bool AllocateDrawCmdBuffers();
         void DestroyFrameBuffers();
+        void DestroySynchronizations();
+        void SelectFrame(uint32_t frame);
+        /// consumes present semaphore of the acquired image which won't be presented
+        bool ReleaseAcquiredImage();
+        /// moves resources of the current swapchain to the retirement list
+        void RetireFrameResources();
+        /// destroys retired resources which aren't used by frames in flight, or all of them if force
+        void DestroyRetired(bool force);
 
     public:
         uint8_t                    m_countDCB             = 0;
         VkCommandBuffer*           m_drawCmdBuffs         = nullptr;
+        /// command buffers owned by frame slots, can be re-recorded after PrepareFrame
+        VkCommandBuffer*           m_frameCmdBuffs        = nullptr;
         std::vector<VkFramebuffer> m_frameBuffers         = std::vector<VkFramebuffer>();
 
     protected:
@@ -143,6 +188,10 @@ namespace EvoVulkan::Core {
         bool                       m_hasErrors            = false;
         bool                       m_paused               = false;
         bool                       m_dirty                = false;
+        /// window or surface reported a new size, the next PrepareFrame skips the frame to re-create the swapchain
+        std::atomic<bool>          m_resizePending        = false;
+        /// image is acquired by PrepareFrame and isn't presented yet
+        bool                       m_imageAcquired        = false;
 
         int32_t                    m_newWidth             = -1;
         int32_t                    m_newHeight            = -1;
@@ -161,15 +210,31 @@ namespace EvoVulkan::Core {
         Types::Surface*            m_surface              = nullptr;
         Types::Swapchain*          m_swapchain            = nullptr;
         Types::CmdPool*            m_cmdPool              = nullptr;
+        Types::UploadContext*      m_uploadContext        = nullptr;
         Types::MultisampleTarget*  m_multisample          = nullptr;
 
         Core::DescriptorManager*   m_descriptorManager    = nullptr;
+        Core::FrameDescriptorAllocator* m_frameDescriptors = nullptr;
 
+        /// synchronization of the current frame slot
         Types::Synchronization     m_syncs                = { };
         SubmitInfo                 m_submitInfo           = { };
 
-        std::vector<VkFence>       m_waitFences           = std::vector<VkFence>();
+        std::vector<Types::Synchronization> m_frameSyncs  = { };
+        /// fences of the frame slots that last used swapchain images, not owned
+        std::vector<VkFence>       m_imageFences          = std::vector<VkFence>();
+        /// count of frame slots, Complexes::FrameBuffer has to be created with the same count
+        uint32_t                   m_framesInFlight       = 2;
+        /// size of the persistent staging ring of the upload context
+        VkDeviceSize               m_stagingSize          = 64 * 1024 * 1024;
+        /// index of the frame slot, not the same as swapchain image index
+        uint32_t                   m_currentFrame         = 0;
+        /// index of the acquired swapchain image
         uint32_t                   m_currentBuffer        = 0;
+        /// count of presented frames
+        uint64_t                   m_frameNumber          = 0;
+        /// resources replaced by ReCreate, destroyed when frames which used them are complete
+        std::vector<RetiredFrameResources> m_retired      = { };
 
         std::vector<SubmitInfo>    m_submitQueue          = { };
 
@@ -85,10 +85,16 @@
 #include <map>
 #include <algorithm>
 #include <stack>
+#include <deque>
 #include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <atomic>
+#include <chrono>
 #include <sys/stat.h>
 #include <fstream>
 #include <array>
+#include <span>
 #include <cstring>
 #include <cmath>
 #include <unordered_set>
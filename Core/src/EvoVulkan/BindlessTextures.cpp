@@ -0,0 +1,174 @@
+//
+// Created by Monika on 18.10.2026.
+//
+
+#include <EvoVulkan/BindlessTextures.h>
+#include <EvoVulkan/Types/Device.h>
+#include <EvoVulkan/Tools/VulkanDebug.h>
+#include <EvoVulkan/Tools/VulkanInitializers.h>
+
+namespace EvoVulkan::Core {
+    BindlessTextures::~BindlessTextures() {
+        /// the set is freed with the pool
+        if (m_pool != VK_NULL_HANDLE) {
+            vkDestroyDescriptorPool(*m_device, m_pool, nullptr);
+            m_pool = VK_NULL_HANDLE;
+        }
+
+        if (m_layout != VK_NULL_HANDLE) {
+            vkDestroyDescriptorSetLayout(*m_device, m_layout, nullptr);
+            m_layout = VK_NULL_HANDLE;
+        }
+    }
+
+    BindlessTextures* BindlessTextures::Create(const Types::Device* pDevice, uint32_t capacity, uint32_t framesInFlight) {
+        if (!pDevice->IsDescriptorIndexingSupported()) {
+            VK_ERROR("BindlessTextures::Create() : descriptor indexing isn't supported by device!");
+            return nullptr;
+        }
+
+        capacity = EVK_MIN(capacity, pDevice->GetMaxBindlessTextures());
+        if (capacity == 0) {
+            VK_ERROR("BindlessTextures::Create() : capacity is zero!");
+            return nullptr;
+        }
+
+        VK_LOG("BindlessTextures::Create() : create bindless textures... \n\tCapacity: " + std::to_string(capacity));
+
+        auto&& pBindless = new BindlessTextures();
+
+        pBindless->m_device         = pDevice;
+        pBindless->m_capacity       = capacity;
+        pBindless->m_framesInFlight = framesInFlight;
+
+        //!=============================================================================================================
+
+        const VkDescriptorSetLayoutBinding binding = Tools::Initializers::DescriptorSetLayoutBinding(
+            VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, VK_SHADER_STAGE_ALL, 0, capacity);
+
+        /// descriptors which aren't used by shaders can be invalid and updated while the set is in use
+        const VkDescriptorBindingFlags bindingFlags =
+            VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT |
+            VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT |
+            VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT;
+
+        VkDescriptorSetLayoutBindingFlagsCreateInfo bindingFlagsCI = {};
+        bindingFlagsCI.sType         = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO;
+        bindingFlagsCI.bindingCount  = 1;
+        bindingFlagsCI.pBindingFlags = &bindingFlags;
+
+        auto&& layoutCI = Tools::Initializers::DescriptorSetLayoutCreateInfo(&binding, 1);
+        layoutCI.pNext = &bindingFlagsCI;
+        layoutCI.flags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT;
+
+        if (vkCreateDescriptorSetLayout(*pDevice, &layoutCI, nullptr, &pBindless->m_layout) != VK_SUCCESS) {
+            VK_ERROR("BindlessTextures::Create() : failed to create descriptor set layout!");
+            delete pBindless;
+            return nullptr;
+        }
+
+        //!=============================================================================================================
+
+        const VkDescriptorPoolSize poolSize = { VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, capacity };
+
+        auto&& poolCI = Tools::Initializers::DescriptorPoolCreateInfo(1, &poolSize, 1);
+        poolCI.flags = VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT;
+
+        if (vkCreateDescriptorPool(*pDevice, &poolCI, nullptr, &pBindless->m_pool) != VK_SUCCESS) {
+            VK_ERROR("BindlessTextures::Create() : failed to create descriptor pool!");
+            delete pBindless;
+            return nullptr;
+        }
+
+        auto&& allocateInfo = Tools::Initializers::DescriptorSetAllocateInfo(pBindless->m_pool, &pBindless->m_layout, 1);
+
+        if (vkAllocateDescriptorSets(*pDevice, &allocateInfo, &pBindless->m_descriptorSet) != VK_SUCCESS) {
+            VK_ERROR("BindlessTextures::Create() : failed to allocate descriptor set!");
+            delete pBindless;
+            return nullptr;
+        }
+
+        return pBindless;
+    }
+
+    uint32_t BindlessTextures::Add(const VkDescriptorImageInfo& imageInfo) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        uint32_t index = InvalidIndex;
+
+        if (!m_free.empty()) {
+            index = m_free.back();
+            m_free.pop_back();
+        }
+        else if (m_used < m_capacity) {
+            index = m_used++;
+        }
+        else {
+            VK_ERROR("BindlessTextures::Add() : bindless textures overflow! Capacity: " + std::to_string(m_capacity));
+            return InvalidIndex;
+        }
+
+        Write(index, imageInfo);
+
+        return index;
+    }
+
+    void BindlessTextures::Update(uint32_t index, const VkDescriptorImageInfo& imageInfo) {
+        if (index >= m_capacity) {
+            VK_ERROR("BindlessTextures::Update() : invalid index! Index: " + std::to_string(index));
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        Write(index, imageInfo);
+    }
+
+    void BindlessTextures::Remove(uint32_t index) {
+        if (index >= m_capacity) {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        /// descriptor stays valid for frames in flight, it's just unused after them
+        m_retired.emplace_back(m_frame + m_framesInFlight, index);
+    }
+
+    void BindlessTextures::NextFrame() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        ++m_frame;
+
+        while (!m_retired.empty() && m_retired.front().first <= m_frame) {
+            m_free.emplace_back(m_retired.front().second);
+            m_retired.pop_front();
+        }
+    }
+
+    void BindlessTextures::SetFramesInFlight(uint32_t count) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_framesInFlight = count;
+    }
+
+    void BindlessTextures::Bind(VkCommandBuffer cmd, VkPipelineLayout pipelineLayout, uint32_t set, VkPipelineBindPoint bindPoint) const {
+        vkCmdBindDescriptorSets(cmd, bindPoint, pipelineLayout, set, 1, &m_descriptorSet, 0, nullptr);
+    }
+
+    uint32_t BindlessTextures::GetCount() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_used - static_cast<uint32_t>(m_free.size() + m_retired.size());
+    }
+
+    void BindlessTextures::Write(uint32_t index, const VkDescriptorImageInfo& imageInfo) {
+        VkWriteDescriptorSet writeDescriptorSet = {};
+        writeDescriptorSet.sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        writeDescriptorSet.dstSet          = m_descriptorSet;
+        writeDescriptorSet.dstBinding      = 0;
+        writeDescriptorSet.dstArrayElement = index;
+        writeDescriptorSet.descriptorType  = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        writeDescriptorSet.descriptorCount = 1;
+        writeDescriptorSet.pImageInfo      = &imageInfo;
+
+        vkUpdateDescriptorSets(*m_device, 1, &writeDescriptorSet, 0, nullptr);
+    }
+}
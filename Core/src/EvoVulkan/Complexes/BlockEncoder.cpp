@@ -0,0 +1,316 @@
+//
+// Created by Monika on 18.10.2026.
+//
+
+#include <EvoVulkan/Complexes/BlockEncoder.h>
+#include <EvoVulkan/Complexes/Shader.h>
+
+#include <EvoVulkan/Types/VmaBuffer.h>
+#include <EvoVulkan/Types/UploadContext.h>
+#include <EvoVulkan/Tools/VulkanTools.h>
+
+namespace EvoVulkan::Complexes {
+    /// every workgroup of the kernels encodes four blocks
+    constexpr uint32_t BlockEncoderBlocksPerGroup = 4;
+
+    BlockEncoder::~BlockEncoder() {
+        for (auto&& pool : m_pools) {
+            vkDestroyDescriptorPool(*m_device, pool, nullptr);
+        }
+        m_pools.clear();
+
+        for (auto&& pipeline : m_pipelines) {
+            if (pipeline != VK_NULL_HANDLE) {
+                vkDestroyPipeline(*m_device, pipeline, nullptr);
+            }
+        }
+        m_pipelines = { };
+
+        for (auto&& module : m_modules) {
+            if (module != VK_NULL_HANDLE) {
+                vkDestroyShaderModule(*m_device, module, nullptr);
+            }
+        }
+        m_modules = { };
+
+        if (m_pipelineLayout != VK_NULL_HANDLE) {
+            vkDestroyPipelineLayout(*m_device, m_pipelineLayout, nullptr);
+            m_pipelineLayout = VK_NULL_HANDLE;
+        }
+
+        if (m_setLayout != VK_NULL_HANDLE) {
+            vkDestroyDescriptorSetLayout(*m_device, m_setLayout, nullptr);
+            m_setLayout = VK_NULL_HANDLE;
+        }
+
+        EVSafeFreeObject(m_input);
+
+        m_allocator = nullptr;
+        m_device = nullptr;
+    }
+
+    BlockEncoder* BlockEncoder::Create(Types::Device* pDevice, Memory::Allocator* pAllocator, const std::string& kernels) {
+        VK_GRAPH("BlockEncoder::Create() : creating GPU block encoder...");
+
+        if (!pDevice || !pAllocator) {
+            VK_ERROR("BlockEncoder::Create() : invalid arguments!");
+            return nullptr;
+        }
+
+        auto&& pEncoder = new BlockEncoder();
+        pEncoder->m_device = pDevice;
+        pEncoder->m_allocator = pAllocator;
+
+        /// registers of the kernels: b0 - constants, t0 - source, t1 - input buffer, u0 - output buffer
+        const std::vector<VkDescriptorSetLayoutBinding> bindings = {
+            Tools::Initializers::DescriptorSetLayoutBinding(VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT, 0),
+            Tools::Initializers::DescriptorSetLayoutBinding(VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, VK_SHADER_STAGE_COMPUTE_BIT, 1),
+            Tools::Initializers::DescriptorSetLayoutBinding(VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT, 2),
+            Tools::Initializers::DescriptorSetLayoutBinding(VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT, 3),
+        };
+
+        if ((pEncoder->m_setLayout = Tools::CreateDescriptorLayout(*pDevice, bindings)) == VK_NULL_HANDLE) {
+            VK_ERROR("BlockEncoder::Create() : failed to create descriptor set layout!");
+            delete pEncoder;
+            return nullptr;
+        }
+
+        if ((pEncoder->m_pipelineLayout = Tools::CreatePipelineLayout(*pDevice, 1, pEncoder->m_setLayout, { })) == VK_NULL_HANDLE) {
+            VK_ERROR("BlockEncoder::Create() : failed to create pipeline layout!");
+            delete pEncoder;
+            return nullptr;
+        }
+
+        const std::string options =
+            "-x hlsl -fshader-stage=compute -fentry-point=EncodeBlocks -fhlsl-iomap "
+            "-fcbuffer-binding-base 0 -ftexture-binding-base 1 -fuav-binding-base 3";
+
+        const std::array<std::pair<Tools::BlockCompression, std::string>, 5> sources = {
+            std::pair(Tools::BlockCompression::BC1, "bc1_encode_kernel.hlsl"),
+            std::pair(Tools::BlockCompression::BC2, "bc2_encode_kernel.hlsl"),
+            std::pair(Tools::BlockCompression::BC3, "bc3_encode_kernel.hlsl"),
+            std::pair(Tools::BlockCompression::BC4, "bc4_encode_kernel.hlsl"),
+            std::pair(Tools::BlockCompression::BC5, "bc5_encode_kernel.hlsl"),
+        };
+
+        for (auto&& [compression, path] : sources) {
+            const uint32_t index = static_cast<uint32_t>(compression);
+
+            if ((pEncoder->m_modules[index] = Shader::LoadModule(pDevice, kernels, path, options)) == VK_NULL_HANDLE) {
+                VK_ERROR("BlockEncoder::Create() : failed to load kernel! \n\tPath: " + path);
+                delete pEncoder;
+                return nullptr;
+            }
+
+            auto&& pipelineCreateInfo = Tools::Initializers::ComputePipelineCreateInfo(pEncoder->m_pipelineLayout);
+            pipelineCreateInfo.stage = Tools::Initializers::PipelineShaderStageCreateInfo(pEncoder->m_modules[index], VK_SHADER_STAGE_COMPUTE_BIT);
+            pipelineCreateInfo.stage.pName = "EncodeBlocks";
+
+            auto&& result = vkCreateComputePipelines(*pDevice, VK_NULL_HANDLE, 1, &pipelineCreateInfo, nullptr, &pEncoder->m_pipelines[index]);
+            if (result != VK_SUCCESS) {
+                VK_ERROR("BlockEncoder::Create() : failed to create pipeline! Reason: " + Tools::Convert::result_to_description(result));
+                delete pEncoder;
+                return nullptr;
+            }
+        }
+
+        pEncoder->m_input = Types::VmaBuffer::Create(pAllocator, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, VMA_MEMORY_USAGE_GPU_ONLY, sizeof(uint32_t) * 4);
+        if (!pEncoder->m_input) {
+            VK_ERROR("BlockEncoder::Create() : failed to create input buffer!");
+            delete pEncoder;
+            return nullptr;
+        }
+
+        return pEncoder;
+    }
+
+    bool BlockEncoder::IsSupported(Tools::BlockCompression compression) const {
+        const uint32_t index = static_cast<uint32_t>(compression);
+        return index < m_pipelines.size() && m_pipelines[index] != VK_NULL_HANDLE;
+    }
+
+    bool BlockEncoder::Encode(Types::CmdBuffer* pCmd, VkImageView source, uint32_t width, uint32_t height,
+        Tools::BlockCompression compression, float quality,
+        VkImage destination, uint32_t mipLevel, Types::UploadContext* pContext)
+    {
+        if (!pCmd || source == VK_NULL_HANDLE || destination == VK_NULL_HANDLE) {
+            VK_ERROR("BlockEncoder::Encode() : invalid arguments!");
+            return false;
+        }
+
+        if (!IsSupported(compression)) {
+            VK_ERROR("BlockEncoder::Encode() : compression isn't supported!");
+            return false;
+        }
+
+        if (width == 0 || height == 0) {
+            VK_ERROR("BlockEncoder::Encode() : invalid size! \n\tWidth: " +
+                std::to_string(width) + "\n\tHeight: " + std::to_string(height));
+            return false;
+        }
+
+        /// partial blocks on the right and bottom edges repeat the edge texels, kernels clamp coordinates
+        const uint32_t blocksX = (width + 3) / 4;
+        const uint32_t blocksCount = blocksX * ((height + 3) / 4);
+        const uint32_t groupsCount = (blocksCount + BlockEncoderBlocksPerGroup - 1) / BlockEncoderBlocksPerGroup;
+
+        Constants constants = { };
+        constants.m_width       = width;
+        constants.m_height      = height;
+        constants.m_blocksX     = blocksX;
+        constants.m_blocksCount = blocksCount;
+        constants.m_alphaWeight = 1.f;
+        constants.m_quality     = EVK_MAX(0.f, EVK_MIN(quality, 1.f));
+
+        /// the last workgroup writes whole group without bounds check
+        const VkDeviceSize blockSize = Tools::TextureCompressor::GetBlockSize(compression);
+        const VkDeviceSize outputSize = static_cast<VkDeviceSize>(groupsCount) * BlockEncoderBlocksPerGroup * blockSize;
+
+        Encoding encoding;
+        if (!CreateEncoding(source, constants, outputSize, encoding)) {
+            VK_ERROR("BlockEncoder::Encode() : failed to create encoding resources!");
+            return false;
+        }
+
+        if (!pCmd->IsBegin()) {
+            pCmd->Begin(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
+        }
+
+        const VkCommandBuffer cmd = *pCmd;
+
+        /// source could be written by previous render passes or compute dispatches
+        VkMemoryBarrier memoryBarrier = { };
+        memoryBarrier.sType         = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        memoryBarrier.srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_TRANSFER_WRITE_BIT;
+        memoryBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+
+        vkCmdPipelineBarrier(cmd,
+            VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT,
+            VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+            0, 1, &memoryBarrier, 0, nullptr, 0, nullptr
+        );
+
+        vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_COMPUTE, m_pipelines[static_cast<uint32_t>(compression)]);
+        vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_COMPUTE, m_pipelineLayout, 0, 1, &encoding.m_set, 0, nullptr);
+        vkCmdDispatch(cmd, groupsCount, 1, 1);
+
+        VkBufferMemoryBarrier bufferBarrier = { };
+        bufferBarrier.sType               = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+        bufferBarrier.srcAccessMask       = VK_ACCESS_SHADER_WRITE_BIT;
+        bufferBarrier.dstAccessMask       = VK_ACCESS_TRANSFER_READ_BIT;
+        bufferBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        bufferBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        bufferBarrier.buffer              = *encoding.m_output;
+        bufferBarrier.offset              = 0;
+        bufferBarrier.size                = VK_WHOLE_SIZE;
+
+        vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 1, &bufferBarrier, 0, nullptr);
+
+        /// blocks are written row by row, as tightly packed buffer of block compressed image,
+        /// rows of the buffer are rounded up to whole blocks, partial extent is valid at the edge of the level
+        VkBufferImageCopy region = { };
+        region.bufferOffset                    = 0;
+        region.imageSubresource.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
+        region.imageSubresource.mipLevel       = mipLevel;
+        region.imageSubresource.baseArrayLayer = 0;
+        region.imageSubresource.layerCount     = 1;
+        region.imageExtent                     = { width, height, 1 };
+
+        vkCmdCopyBufferToImage(cmd, *encoding.m_output, destination, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+
+        bool result = true;
+
+        if (pContext) {
+            pContext->OnComplete([this, encoding]() {
+                ReleaseEncoding(encoding);
+            });
+        }
+        else {
+            result = pCmd->End();
+            ReleaseEncoding(encoding);
+        }
+
+        return result;
+    }
+
+    bool BlockEncoder::CreateEncoding(VkImageView source, const Constants& constants, VkDeviceSize outputSize, Encoding& encoding) {
+        encoding.m_constants = Types::VmaBuffer::Create(m_allocator, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, VMA_MEMORY_USAGE_CPU_TO_GPU,
+            sizeof(Constants), const_cast<Constants*>(&constants));
+
+        encoding.m_output = Types::VmaBuffer::Create(m_allocator, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+            VMA_MEMORY_USAGE_GPU_ONLY, outputSize);
+
+        if (!encoding.m_constants || !encoding.m_output) {
+            VK_ERROR("BlockEncoder::CreateEncoding() : failed to create buffers!");
+            ReleaseEncoding(encoding);
+            return false;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        for (auto&& pool : m_pools) {
+            auto&& allocateInfo = Tools::Initializers::DescriptorSetAllocateInfo(pool, &m_setLayout, 1);
+            if (vkAllocateDescriptorSets(*m_device, &allocateInfo, &encoding.m_set) == VK_SUCCESS) {
+                encoding.m_pool = pool;
+                break;
+            }
+        }
+
+        if (encoding.m_set == VK_NULL_HANDLE) {
+            constexpr uint32_t maxSets = 32;
+
+            const std::array<VkDescriptorPoolSize, 3> poolSizes = {
+                Tools::Initializers::DescriptorPoolSize(VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, maxSets),
+                Tools::Initializers::DescriptorPoolSize(VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, maxSets),
+                Tools::Initializers::DescriptorPoolSize(VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, maxSets * 2),
+            };
+
+            auto&& poolCreateInfo = Tools::Initializers::DescriptorPoolCreateInfo(static_cast<uint32_t>(poolSizes.size()), poolSizes.data(), maxSets);
+            poolCreateInfo.flags = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT;
+
+            VkDescriptorPool pool = VK_NULL_HANDLE;
+            if (vkCreateDescriptorPool(*m_device, &poolCreateInfo, nullptr, &pool) != VK_SUCCESS) {
+                VK_ERROR("BlockEncoder::CreateEncoding() : failed to create descriptor pool!");
+                EVSafeFreeObject(encoding.m_constants);
+                EVSafeFreeObject(encoding.m_output);
+                return false;
+            }
+            m_pools.emplace_back(pool);
+
+            auto&& allocateInfo = Tools::Initializers::DescriptorSetAllocateInfo(pool, &m_setLayout, 1);
+            if (vkAllocateDescriptorSets(*m_device, &allocateInfo, &encoding.m_set) != VK_SUCCESS) {
+                VK_ERROR("BlockEncoder::CreateEncoding() : failed to allocate descriptor set!");
+                EVSafeFreeObject(encoding.m_constants);
+                EVSafeFreeObject(encoding.m_output);
+                return false;
+            }
+            encoding.m_pool = pool;
+        }
+
+        VkDescriptorImageInfo sourceInfo = { VK_NULL_HANDLE, source, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL };
+
+        const std::array<VkWriteDescriptorSet, 4> writes = {
+            Tools::Initializers::WriteDescriptorSet(encoding.m_set, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 0, encoding.m_constants->GetDescriptorRef()),
+            Tools::Initializers::WriteDescriptorSet(encoding.m_set, VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, 1, &sourceInfo),
+            Tools::Initializers::WriteDescriptorSet(encoding.m_set, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 2, m_input->GetDescriptorRef()),
+            Tools::Initializers::WriteDescriptorSet(encoding.m_set, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 3, encoding.m_output->GetDescriptorRef()),
+        };
+
+        vkUpdateDescriptorSets(*m_device, static_cast<uint32_t>(writes.size()), writes.data(), 0, nullptr);
+
+        return true;
+    }
+
+    void BlockEncoder::ReleaseEncoding(const Encoding& encoding) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            if (encoding.m_set != VK_NULL_HANDLE) {
+                vkFreeDescriptorSets(*m_device, encoding.m_pool, 1, &encoding.m_set);
+            }
+        }
+
+        delete encoding.m_constants;
+        delete encoding.m_output;
+    }
+}
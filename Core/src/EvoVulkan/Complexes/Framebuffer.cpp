@@ -11,15 +11,15 @@ namespace EvoVulkan::Complexes {
     FrameBuffer::~FrameBuffer() {
         DeInitialize();
 
-        if (m_semaphore != VK_NULL_HANDLE) {
-            vkDestroySemaphore(*m_device, m_semaphore, nullptr);
-            m_semaphore = VK_NULL_HANDLE;
+        for (auto&& semaphore : m_semaphores) {
+            vkDestroySemaphore(*m_device, semaphore, nullptr);
         }
+        m_semaphores.clear();
 
-        if (m_cmdBuff) {
-            delete m_cmdBuff;
-            m_cmdBuff = nullptr;
+        for (auto&& pCmdBuff : m_cmdBuffs) {
+            delete pCmdBuff;
         }
+        m_cmdBuffs.clear();
 
         if (m_renderPass.IsReady()) {
             Types::DestroyRenderPass(m_device, &m_renderPass);
@@ -43,7 +43,8 @@ namespace EvoVulkan::Complexes {
         float_t scale,
         uint8_t samplesCount,
         VkImageAspectFlags depthAspect,
-        VkFormat depthFormat
+        VkFormat depthFormat,
+        uint32_t framesInFlight
     ) {
         if (scale <= 0.f) {
             VK_ERROR("Framebuffer::Create() : scale <= zero!");
@@ -60,6 +61,11 @@ namespace EvoVulkan::Complexes {
             return nullptr;
         }
 
+        if (framesInFlight == 0) {
+            VK_ERROR("Framebuffer::Create() : frames count must be greater than zero!");
+            return nullptr;
+        }
+
         auto&& pFBO = new FrameBuffer();
         {
             pFBO->m_layersCount        = arrayLayers;
@@ -77,17 +83,34 @@ namespace EvoVulkan::Complexes {
 
         pFBO->SetSampleCount(samplesCount);
 
-        auto&& semaphoreCI = Tools::Initializers::SemaphoreCreateInfo();
-        if (vkCreateSemaphore(*device, &semaphoreCI, nullptr, &pFBO->m_semaphore) != VK_SUCCESS) {
-            VK_ERROR("Framebuffer::Create() : failed to create vulkan semaphore!");
-            return nullptr;
+        /// the slot can be recorded while other frames in flight still execute their command buffers
+        for (uint32_t frame = 0; frame < framesInFlight; ++frame) {
+            auto&& semaphoreCI = Tools::Initializers::SemaphoreCreateInfo();
+            VkSemaphore semaphore = VK_NULL_HANDLE;
+
+            if (vkCreateSemaphore(*device, &semaphoreCI, nullptr, &semaphore) != VK_SUCCESS) {
+                VK_ERROR("Framebuffer::Create() : failed to create vulkan semaphore!");
+                delete pFBO;
+                return nullptr;
+            }
+
+            pFBO->m_semaphores.emplace_back(semaphore);
+
+            auto&& pCmdBuff = Types::CmdBuffer::Create(device, pool, VK_COMMAND_BUFFER_LEVEL_PRIMARY);
+            if (!pCmdBuff) {
+                VK_ERROR("Framebuffer::Create() : failed to create command buffer!");
+                delete pFBO;
+                return nullptr;
+            }
+
+            pFBO->m_cmdBuffs.emplace_back(pCmdBuff);
         }
 
-        pFBO->m_cmdBuff = Types::CmdBuffer::Create(device, pool, VK_COMMAND_BUFFER_LEVEL_PRIMARY);
         pFBO->m_cmdBufInfo = Tools::Initializers::CommandBufferBeginInfo();
 
         if (!pFBO->ReCreate(width, height)) {
             VK_ERROR("Framebuffer::Create() : failed to re-create framebuffer!");
+            delete pFBO;
             return nullptr;
         }
 
@@ -149,7 +172,7 @@ namespace EvoVulkan::Complexes {
         sampler.maxLod        = 1.0f;
         sampler.borderColor   = VK_BORDER_COLOR_FLOAT_OPAQUE_WHITE;
 
-        if (vkCreateSampler(*m_device, &sampler, nullptr, &m_colorSampler) != VK_SUCCESS) {
+        if ((m_colorSampler = m_device->GetSamplerCache()->Acquire(sampler)) == VK_NULL_HANDLE) {
             VK_ERROR("Framebuffer::CreateSampler() : failed to create vulkan sampler!");
             return false;
         }
@@ -424,17 +447,31 @@ namespace EvoVulkan::Complexes {
     }
 
     void EvoVulkan::Complexes::FrameBuffer::BeginCmd() {
-        vkBeginCommandBuffer(*m_cmdBuff, &m_cmdBufInfo);
+        vkBeginCommandBuffer(GetCmd(), &m_cmdBufInfo);
     }
 
     void EvoVulkan::Complexes::FrameBuffer::End() const {
-        vkCmdEndRenderPass(*m_cmdBuff);
-        vkEndCommandBuffer(*m_cmdBuff);
+        vkCmdEndRenderPass(GetCmd());
+        vkEndCommandBuffer(GetCmd());
     }
 
     void EvoVulkan::Complexes::FrameBuffer::SetViewportAndScissor() const {
-        vkCmdSetViewport(*m_cmdBuff, 0, 1, &m_viewport);
-        vkCmdSetScissor(*m_cmdBuff, 0, 1, &m_scissor);
+        vkCmdSetViewport(GetCmd(), 0, 1, &m_viewport);
+        vkCmdSetScissor(GetCmd(), 0, 1, &m_scissor);
+    }
+
+    void FrameBuffer::SetFrame(uint32_t frame) {
+        const VkSemaphore previous = GetSemaphore();
+
+        m_frame = frame % static_cast<uint32_t>(m_cmdBuffs.size());
+
+        if (previous == GetSemaphore()) {
+            return;
+        }
+
+        for (auto&& semaphores : { &m_waitSemaphores, &m_signalSemaphores }) {
+            std::replace(semaphores->begin(), semaphores->end(), previous, GetSemaphore());
+        }
     }
 
     VkRenderPassBeginInfo EvoVulkan::Complexes::FrameBuffer::BeginRenderPass(VkClearValue *clearValues, uint32_t countCls, uint32_t layer) const {
@@ -450,6 +487,15 @@ namespace EvoVulkan::Complexes {
         return renderPassBeginInfo;
     }
 
+    VkCommandBufferInheritanceInfo EvoVulkan::Complexes::FrameBuffer::GetInheritanceInfo(uint32_t layer) const {
+        VkCommandBufferInheritanceInfo inheritanceInfo = {};
+        inheritanceInfo.sType       = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+        inheritanceInfo.renderPass  = m_renderPass.m_self;
+        inheritanceInfo.subpass     = 0;
+        inheritanceInfo.framebuffer = m_layers[layer]->GetFramebuffer();
+        return inheritanceInfo;
+    }
+
     bool EvoVulkan::Complexes::FrameBuffer::IsMultisampleEnabled() const {
         return m_device->IsMultiSamplingEnabled() && m_currentSampleCount > 1;
     }
@@ -472,7 +518,7 @@ namespace EvoVulkan::Complexes {
         m_depthAttachment.reset();
 
         if (m_colorSampler != VK_NULL_HANDLE) {
-            vkDestroySampler(*m_device, m_colorSampler, nullptr);
+            m_device->GetSamplerCache()->Release(m_colorSampler);
             m_colorSampler = VK_NULL_HANDLE;
         }
     }
@@ -4,11 +4,32 @@
 
 #include <EvoVulkan/Complexes/Mesh.h>
 #include <EvoVulkan/Types/VulkanBuffer.h>
+#include <EvoVulkan/DescriptorBuffer.h>
+
+void EvoVulkan::Complexes::Mesh::BindDescriptorSet(const VkCommandBuffer& cmd) {
+    if (m_descriptorSet.pBuffer) {
+        m_descriptorSet.pBuffer->SetOffsets(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, m_attachShader->GetPipelineLayout(), 0,
+                                            std::span<const Types::DescriptorSet>(&m_descriptorSet, 1));
+    }
+    else {
+        vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS,
+                                m_attachShader->GetPipelineLayout(), 0, 1, &m_descriptorSet.descriptorSet, 0, NULL);
+    }
+}
 
 void EvoVulkan::Complexes::Mesh::Draw(const VkCommandBuffer& cmd) {
     VkDeviceSize offsets[1] = {0};
-    vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS,
-                            m_attachShader->GetPipelineLayout(), 0, 1, &m_descriptorSet.descriptorSet, 0, NULL);
+    BindDescriptorSet(cmd);
+    vkCmdBindVertexBuffers(cmd, 0, 1, m_vertices->GetCRef(), offsets);
+    vkCmdBindIndexBuffer(cmd, *m_indices, 0, VK_INDEX_TYPE_UINT32);
+
+    vkCmdDrawIndexed(cmd, m_countIndices, 1, 0, 0, 0);
+}
+
+void EvoVulkan::Complexes::Mesh::DrawBindless(const VkCommandBuffer& cmd, uint32_t textureIndex, VkShaderStageFlags stages) {
+    VkDeviceSize offsets[1] = {0};
+    BindDescriptorSet(cmd);
+    vkCmdPushConstants(cmd, m_attachShader->GetPipelineLayout(), stages, 0, sizeof(uint32_t), &textureIndex);
     vkCmdBindVertexBuffers(cmd, 0, 1, m_vertices->GetCRef(), offsets);
     vkCmdBindIndexBuffer(cmd, *m_indices, 0, VK_INDEX_TYPE_UINT32);
 
@@ -0,0 +1,402 @@
+//
+// Created by Monika on 18.10.2026.
+//
+
+#include <EvoVulkan/Complexes/MipGenerator.h>
+#include <EvoVulkan/Complexes/Shader.h>
+
+#include <EvoVulkan/Types/VmaBuffer.h>
+#include <EvoVulkan/Types/UploadContext.h>
+#include <EvoVulkan/Tools/VulkanTools.h>
+
+namespace EvoVulkan::Complexes {
+    MipGenerator::~MipGenerator() {
+        for (auto&& pool : m_pools) {
+            vkDestroyDescriptorPool(*m_device, pool, nullptr);
+        }
+        m_pools.clear();
+
+        if (m_sampler != VK_NULL_HANDLE) {
+            m_device->GetSamplerCache()->Release(m_sampler);
+            m_sampler = VK_NULL_HANDLE;
+        }
+
+        if (m_pipeline != VK_NULL_HANDLE) {
+            vkDestroyPipeline(*m_device, m_pipeline, nullptr);
+            m_pipeline = VK_NULL_HANDLE;
+        }
+
+        if (m_pipelineLayout != VK_NULL_HANDLE) {
+            vkDestroyPipelineLayout(*m_device, m_pipelineLayout, nullptr);
+            m_pipelineLayout = VK_NULL_HANDLE;
+        }
+
+        if (m_setLayout != VK_NULL_HANDLE) {
+            vkDestroyDescriptorSetLayout(*m_device, m_setLayout, nullptr);
+            m_setLayout = VK_NULL_HANDLE;
+        }
+
+        if (m_module != VK_NULL_HANDLE) {
+            vkDestroyShaderModule(*m_device, m_module, nullptr);
+            m_module = VK_NULL_HANDLE;
+        }
+
+        EVSafeFreeObject(m_global);
+
+        m_device = nullptr;
+    }
+
+    MipGenerator* MipGenerator::Create(Types::Device* pDevice, Memory::Allocator* pAllocator, const std::string& cache, const std::string& path) {
+        VK_GRAPH("MipGenerator::Create() : creating compute mip generator...");
+
+        if (!pDevice || !pAllocator) {
+            VK_ERROR("MipGenerator::Create() : invalid arguments!");
+            return nullptr;
+        }
+
+        auto&& pGenerator = new MipGenerator();
+        pGenerator->m_device = pDevice;
+
+        VkPhysicalDeviceFeatures features;
+        vkGetPhysicalDeviceFeatures(*pDevice, &features);
+
+        /// storage views are declared without format, so one shader works with all formats
+        if (!(pGenerator->m_writeWithoutFormat = features.shaderStorageImageWriteWithoutFormat)) {
+            VK_ERROR("MipGenerator::Create() : device does not support storage image write without format!");
+            delete pGenerator;
+            return nullptr;
+        }
+
+        if ((pGenerator->m_module = Shader::LoadModule(pDevice, cache, path)) == VK_NULL_HANDLE) {
+            VK_ERROR("MipGenerator::Create() : failed to load shader module! \n\tPath: " + path);
+            delete pGenerator;
+            return nullptr;
+        }
+
+        const std::vector<VkDescriptorSetLayoutBinding> bindings = {
+            Tools::Initializers::DescriptorSetLayoutBinding(VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, VK_SHADER_STAGE_COMPUTE_BIT, 0),
+            Tools::Initializers::DescriptorSetLayoutBinding(VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, VK_SHADER_STAGE_COMPUTE_BIT, 1, MaxLevelsPerDispatch),
+            Tools::Initializers::DescriptorSetLayoutBinding(VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT, 2),
+        };
+
+        if ((pGenerator->m_setLayout = Tools::CreateDescriptorLayout(*pDevice, bindings)) == VK_NULL_HANDLE) {
+            VK_ERROR("MipGenerator::Create() : failed to create descriptor set layout!");
+            delete pGenerator;
+            return nullptr;
+        }
+
+        const VkPushConstantRange pushConstant = { VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(PushConstants) };
+
+        if ((pGenerator->m_pipelineLayout = Tools::CreatePipelineLayout(*pDevice, 1, pGenerator->m_setLayout, { pushConstant })) == VK_NULL_HANDLE) {
+            VK_ERROR("MipGenerator::Create() : failed to create pipeline layout!");
+            delete pGenerator;
+            return nullptr;
+        }
+
+        auto&& pipelineCreateInfo = Tools::Initializers::ComputePipelineCreateInfo(pGenerator->m_pipelineLayout);
+        pipelineCreateInfo.stage = Tools::Initializers::PipelineShaderStageCreateInfo(pGenerator->m_module, VK_SHADER_STAGE_COMPUTE_BIT);
+
+        auto&& result = vkCreateComputePipelines(*pDevice, VK_NULL_HANDLE, 1, &pipelineCreateInfo, nullptr, &pGenerator->m_pipeline);
+        if (result != VK_SUCCESS) {
+            VK_ERROR("MipGenerator::Create() : failed to create pipeline! Reason: " + Tools::Convert::result_to_description(result));
+            delete pGenerator;
+            return nullptr;
+        }
+
+        /// texels are fetched, filtering isn't used
+        pGenerator->m_sampler = Tools::CreateSampler(pDevice, 1, VK_FILTER_NEAREST, VK_FILTER_NEAREST, VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE, VK_COMPARE_OP_NEVER);
+        if (pGenerator->m_sampler == VK_NULL_HANDLE) {
+            VK_ERROR("MipGenerator::Create() : failed to create sampler!");
+            delete pGenerator;
+            return nullptr;
+        }
+
+        /// counter of finished workgroups and level 6 of 64x64 tiles, see mipmaps.comp
+        const VkDeviceSize globalSize = sizeof(uint32_t) * 4 + sizeof(float) * 4 * 4096;
+        std::vector<uint8_t> zeros(globalSize, 0);
+
+        pGenerator->m_global = Types::VmaBuffer::Create(pAllocator, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, VMA_MEMORY_USAGE_CPU_TO_GPU, globalSize, zeros.data());
+        if (!pGenerator->m_global) {
+            VK_ERROR("MipGenerator::Create() : failed to create global buffer!");
+            delete pGenerator;
+            return nullptr;
+        }
+
+        return pGenerator;
+    }
+
+    bool MipGenerator::IsSupported(VkFormat format) const {
+        if (!m_writeWithoutFormat) {
+            return false;
+        }
+
+        VkFormatProperties formatProperties;
+
+        vkGetPhysicalDeviceFormatProperties(*m_device, format, &formatProperties);
+        if (!(formatProperties.optimalTilingFeatures & VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT)) {
+            return false;
+        }
+
+        vkGetPhysicalDeviceFormatProperties(*m_device, GetStorageFormat(format), &formatProperties);
+
+        return formatProperties.optimalTilingFeatures & VK_FORMAT_FEATURE_STORAGE_IMAGE_BIT;
+    }
+
+    VkFormat MipGenerator::GetStorageFormat(VkFormat format) {
+        /// sRGB formats can't be used as storage images, they are written through UNORM aliases
+        switch (format) {
+            case VK_FORMAT_R8_SRGB: return VK_FORMAT_R8_UNORM;
+            case VK_FORMAT_R8G8_SRGB: return VK_FORMAT_R8G8_UNORM;
+            case VK_FORMAT_R8G8B8A8_SRGB: return VK_FORMAT_R8G8B8A8_UNORM;
+            case VK_FORMAT_B8G8R8A8_SRGB: return VK_FORMAT_B8G8R8A8_UNORM;
+            case VK_FORMAT_A8B8G8R8_SRGB_PACK32: return VK_FORMAT_A8B8G8R8_UNORM_PACK32;
+            default:
+                return format;
+        }
+    }
+
+    bool MipGenerator::IsSRGB(VkFormat format) {
+        return GetStorageFormat(format) != format;
+    }
+
+    VkImageUsageFlags MipGenerator::GetImageUsage(VkFormat) {
+        return VK_IMAGE_USAGE_STORAGE_BIT;
+    }
+
+    VkImageCreateFlags MipGenerator::GetImageFlags(VkFormat format) {
+        if (IsSRGB(format)) {
+            /// storage usage is supported only by the UNORM view format
+            return VK_IMAGE_CREATE_MUTABLE_FORMAT_BIT | VK_IMAGE_CREATE_EXTENDED_USAGE_BIT;
+        }
+
+        return 0;
+    }
+
+    bool MipGenerator::Generate(Types::CmdBuffer* pCmd, Types::Image& image, uint32_t width, uint32_t height, uint32_t mipLevels, Types::UploadContext* pContext) {
+        if (!pCmd || mipLevels < 2) {
+            VK_ERROR("MipGenerator::Generate() : invalid arguments!");
+            return false;
+        }
+
+        if (!pCmd->IsBegin()) {
+            pCmd->Begin(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
+        }
+
+        const VkCommandBuffer cmd = *pCmd;
+
+        /// previous generation could use the global buffer
+        VkMemoryBarrier memoryBarrier = { };
+        memoryBarrier.sType         = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        memoryBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+        memoryBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+
+        vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 1, &memoryBarrier, 0, nullptr, 0, nullptr);
+
+        Barrier(cmd, image, mipLevels,
+            VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_GENERAL,
+            VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT,
+            VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT
+        );
+
+        vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_COMPUTE, m_pipeline);
+
+        std::vector<Dispatch> dispatches;
+        bool result = true;
+
+        for (uint32_t base = 0; base + 1 < mipLevels; ) {
+            const uint32_t levelWidth = EVK_MAX(width >> base, 1u);
+            const uint32_t levelHeight = EVK_MAX(height >> base, 1u);
+
+            const uint32_t tilesX = (levelWidth + 63) / 64;
+            const uint32_t tilesY = (levelHeight + 63) / 64;
+
+            /// the last workgroup can reduce 64x64 tiles at most
+            const uint32_t limit = EVK_MIN(mipLevels - 1 - base, (tilesX <= 64 && tilesY <= 64) ? MaxLevelsPerDispatch : MaxLevelsPerDispatch / 2);
+
+            /// levels after the first one are reduced by 2x2 box inside of tiles, Kaiser taps and
+            /// odd sizes need texels of neighbouring tiles, so such level starts the next dispatch
+            uint32_t levels = 1;
+            while (levels < limit && m_filter == MipFilter::Box && IsEvenLevel(width, height, base + levels)) {
+                ++levels;
+            }
+
+            Dispatch dispatch;
+            if (!CreateDispatch(image, base, levels, dispatch)) {
+                VK_ERROR("MipGenerator::Generate() : failed to create dispatch resources!");
+                result = false;
+                break;
+            }
+            dispatches.emplace_back(dispatch);
+
+            PushConstants constants = { };
+            constants.m_width  = static_cast<int32_t>(levelWidth);
+            constants.m_height = static_cast<int32_t>(levelHeight);
+            constants.m_levels = static_cast<int32_t>(levels);
+            constants.m_tilesX = static_cast<int32_t>(tilesX);
+            constants.m_filter = static_cast<int32_t>(m_filter);
+            constants.m_srgb   = IsSRGB(image.GetFormat()) ? 1 : 0;
+
+            vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_COMPUTE, m_pipelineLayout, 0, 1, &dispatch.m_set, 0, nullptr);
+            vkCmdPushConstants(cmd, m_pipelineLayout, VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(PushConstants), &constants);
+            vkCmdDispatch(cmd, tilesX, tilesY, 1);
+
+            /// written levels are read by the next dispatch, the global buffer is reused
+            vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 1, &memoryBarrier, 0, nullptr, 0, nullptr);
+
+            base += levels;
+        }
+
+        Barrier(cmd, image, mipLevels,
+            VK_IMAGE_LAYOUT_GENERAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+            VK_ACCESS_SHADER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT,
+            VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT
+        );
+
+        image.SetLayout(VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+
+        if (pContext) {
+            pContext->OnComplete([this, dispatches]() {
+                for (auto&& dispatch : dispatches) {
+                    ReleaseDispatch(dispatch);
+                }
+            });
+        }
+        else {
+            result &= pCmd->End();
+
+            for (auto&& dispatch : dispatches) {
+                ReleaseDispatch(dispatch);
+            }
+        }
+
+        return result;
+    }
+
+    bool MipGenerator::IsEvenLevel(uint32_t width, uint32_t height, uint32_t level) {
+        const uint32_t levelWidth = EVK_MAX(width >> level, 1u);
+        const uint32_t levelHeight = EVK_MAX(height >> level, 1u);
+
+        /// a side of one texel is repeated by clamping, so it's reduced as even one
+        return (levelWidth == 1 || levelWidth % 2 == 0) && (levelHeight == 1 || levelHeight % 2 == 0);
+    }
+
+    bool MipGenerator::CreateDispatch(const Types::Image& image, uint32_t baseLevel, uint32_t levels, Dispatch& dispatch) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        VkImageViewUsageCreateInfo usageCreateInfo = { };
+        usageCreateInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_USAGE_CREATE_INFO;
+
+        VkImageViewCreateInfo viewCreateInfo = Tools::Initializers::ImageViewCreateInfo();
+        viewCreateInfo.pNext                           = &usageCreateInfo;
+        viewCreateInfo.image                           = image;
+        viewCreateInfo.viewType                        = VK_IMAGE_VIEW_TYPE_2D;
+        viewCreateInfo.subresourceRange.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
+        viewCreateInfo.subresourceRange.levelCount     = 1;
+        viewCreateInfo.subresourceRange.baseArrayLayer = 0;
+        viewCreateInfo.subresourceRange.layerCount     = 1;
+
+        /// the first view is sampled, sRGB texels are decoded by hardware
+        for (uint32_t i = 0; i <= levels; ++i) {
+            usageCreateInfo.usage = i == 0 ? VK_IMAGE_USAGE_SAMPLED_BIT : VK_IMAGE_USAGE_STORAGE_BIT;
+            viewCreateInfo.format = i == 0 ? image.GetFormat() : GetStorageFormat(image.GetFormat());
+            viewCreateInfo.subresourceRange.baseMipLevel = baseLevel + i;
+
+            VkImageView view = VK_NULL_HANDLE;
+            if (vkCreateImageView(*m_device, &viewCreateInfo, nullptr, &view) != VK_SUCCESS) {
+                VK_ERROR("MipGenerator::CreateDispatch() : failed to create image view!");
+                for (auto&& created : dispatch.m_views) {
+                    vkDestroyImageView(*m_device, created, nullptr);
+                }
+                dispatch.m_views.clear();
+                return false;
+            }
+
+            dispatch.m_views.emplace_back(view);
+        }
+
+        for (auto&& pool : m_pools) {
+            auto&& allocateInfo = Tools::Initializers::DescriptorSetAllocateInfo(pool, &m_setLayout, 1);
+            if (vkAllocateDescriptorSets(*m_device, &allocateInfo, &dispatch.m_set) == VK_SUCCESS) {
+                dispatch.m_pool = pool;
+                break;
+            }
+        }
+
+        if (dispatch.m_set == VK_NULL_HANDLE) {
+            constexpr uint32_t maxSets = 32;
+
+            const std::array<VkDescriptorPoolSize, 3> poolSizes = {
+                Tools::Initializers::DescriptorPoolSize(VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, maxSets),
+                Tools::Initializers::DescriptorPoolSize(VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, maxSets * MaxLevelsPerDispatch),
+                Tools::Initializers::DescriptorPoolSize(VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, maxSets),
+            };
+
+            auto&& poolCreateInfo = Tools::Initializers::DescriptorPoolCreateInfo(static_cast<uint32_t>(poolSizes.size()), poolSizes.data(), maxSets);
+            poolCreateInfo.flags = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT;
+
+            VkDescriptorPool pool = VK_NULL_HANDLE;
+            if (vkCreateDescriptorPool(*m_device, &poolCreateInfo, nullptr, &pool) != VK_SUCCESS) {
+                VK_ERROR("MipGenerator::CreateDispatch() : failed to create descriptor pool!");
+                return false;
+            }
+            m_pools.emplace_back(pool);
+
+            auto&& allocateInfo = Tools::Initializers::DescriptorSetAllocateInfo(pool, &m_setLayout, 1);
+            if (vkAllocateDescriptorSets(*m_device, &allocateInfo, &dispatch.m_set) != VK_SUCCESS) {
+                VK_ERROR("MipGenerator::CreateDispatch() : failed to allocate descriptor set!");
+                return false;
+            }
+            dispatch.m_pool = pool;
+        }
+
+        const VkDescriptorImageInfo srcInfo = { m_sampler, dispatch.m_views[0], VK_IMAGE_LAYOUT_GENERAL };
+
+        /// unused levels repeat the last one, they are never written
+        std::array<VkDescriptorImageInfo, MaxLevelsPerDispatch> dstInfos = { };
+        for (uint32_t i = 0; i < MaxLevelsPerDispatch; ++i) {
+            dstInfos[i] = { VK_NULL_HANDLE, dispatch.m_views[EVK_MIN(i + 1, levels)], VK_IMAGE_LAYOUT_GENERAL };
+        }
+
+        const std::array<VkWriteDescriptorSet, 3> writes = {
+            Tools::Initializers::WriteDescriptorSet(dispatch.m_set, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 0, const_cast<VkDescriptorImageInfo*>(&srcInfo)),
+            Tools::Initializers::WriteDescriptorSet(dispatch.m_set, VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, 1, dstInfos.data(), MaxLevelsPerDispatch),
+            Tools::Initializers::WriteDescriptorSet(dispatch.m_set, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 2, m_global->GetDescriptorRef()),
+        };
+
+        vkUpdateDescriptorSets(*m_device, static_cast<uint32_t>(writes.size()), writes.data(), 0, nullptr);
+
+        return true;
+    }
+
+    void MipGenerator::ReleaseDispatch(const Dispatch& dispatch) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (dispatch.m_set != VK_NULL_HANDLE) {
+            vkFreeDescriptorSets(*m_device, dispatch.m_pool, 1, &dispatch.m_set);
+        }
+
+        for (auto&& view : dispatch.m_views) {
+            vkDestroyImageView(*m_device, view, nullptr);
+        }
+    }
+
+    void MipGenerator::Barrier(VkCommandBuffer cmd, VkImage image, uint32_t mipLevels,
+        VkImageLayout oldLayout, VkImageLayout newLayout,
+        VkAccessFlags srcAccess, VkAccessFlags dstAccess,
+        VkPipelineStageFlags srcStage, VkPipelineStageFlags dstStage) const
+    {
+        VkImageMemoryBarrier barrier = Tools::Initializers::ImageMemoryBarrier();
+        barrier.oldLayout                       = oldLayout;
+        barrier.newLayout                       = newLayout;
+        barrier.srcAccessMask                   = srcAccess;
+        barrier.dstAccessMask                   = dstAccess;
+        barrier.image                           = image;
+        barrier.subresourceRange.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
+        barrier.subresourceRange.baseMipLevel   = 0;
+        barrier.subresourceRange.levelCount     = mipLevels;
+        barrier.subresourceRange.baseArrayLayer = 0;
+        barrier.subresourceRange.layerCount     = 1;
+
+        vkCmdPipelineBarrier(cmd, srcStage, dstStage, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+    }
+}
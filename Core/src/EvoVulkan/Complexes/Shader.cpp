@@ -39,40 +39,9 @@ bool EvoVulkan::Complexes::Shader::Load(
     m_pushConstants = pushConstants;
 
     for (const auto& [path, stage] : modules) {
-        const std::string inputFile = std::string(cache + "/").append(path);
-        const std::string hashFile = inputFile + ".spv.hash";
-        const std::string outputFile = inputFile + ".spv";
-
-        const uint64_t hash = Tools::VkFunctionsHolder::Instance().GetFileHash(inputFile);
-
-        if (hash != Tools::VkFunctionsHolder::Instance().ReadHash(hashFile) || !Tools::VkFunctionsHolder::Instance().IsExists(outputFile)) {
-            Tools::VkFunctionsHolder::Instance().WriteHash(hashFile, hash);
-
-            if (EVK_IS_EXISTS(outputFile)) {
-                EVK_DELETE_FILE(outputFile);
-            }
-
-        #if defined(EVK_WIN32) || defined(EVK_LINUX)
-        #ifdef EVK_WIN32
-            std::string command = std::string("\"\"" + (Complexes::GLSLCompiler::Instance().GetPath() + "\" -c \"").append(inputFile).append("\" -o \"" + outputFile + "\"\""));
-        #else
-            std::string command = std::string("\"" + (Complexes::GLSLCompiler::Instance().GetPath() + "\" -c \"").append(inputFile).append("\" -o \"" + outputFile + "\""));
-        #endif
-            /// VK_LOG("Shader::Load() : execute command: " + command);
-            system(command.c_str());
-
-            if (!Tools::VkFunctionsHolder::Instance().IsExists(outputFile)) {
-                VK_ERROR("Shader::Load() : failed to compile shader!\n\tPath: " + inputFile + "\n\tGLSL Command: " + command);
-                return false;
-            }
-        #else
-            VK_ERROR("Shader::Load() : the platform does not suppet shader compilation!");
-        #endif
-        }
-
-        auto shaderModule = Tools::LoadShaderModule(outputFile.c_str(), *m_device);
+        auto&& shaderModule = LoadModule(m_device, cache, path);
         if (shaderModule == VK_NULL_HANDLE) {
-            VK_ERROR("Shader::Load() : failed to load shader module! \n\tPath: " + inputFile);
+            VK_ERROR("Shader::Load() : failed to load shader module! \n\tPath: " + path);
             return false;
         }
         else {
@@ -84,6 +53,41 @@ bool EvoVulkan::Complexes::Shader::Load(
     return true;
 }
 
+VkShaderModule EvoVulkan::Complexes::Shader::LoadModule(const EvoVulkan::Types::Device* pDevice, const std::string& cache, const std::string& path, const std::string& options) {
+    const std::string inputFile = std::string(cache + "/").append(path);
+    const std::string hashFile = inputFile + ".spv.hash";
+    const std::string outputFile = inputFile + ".spv";
+
+    const uint64_t hash = Tools::VkFunctionsHolder::Instance().GetFileHash(inputFile);
+
+    if (hash != Tools::VkFunctionsHolder::Instance().ReadHash(hashFile) || !Tools::VkFunctionsHolder::Instance().IsExists(outputFile)) {
+        Tools::VkFunctionsHolder::Instance().WriteHash(hashFile, hash);
+
+        if (EVK_IS_EXISTS(outputFile)) {
+            EVK_DELETE_FILE(outputFile);
+        }
+
+    #if defined(EVK_WIN32) || defined(EVK_LINUX)
+    #ifdef EVK_WIN32
+        std::string command = std::string("\"\"" + (Complexes::GLSLCompiler::Instance().GetPath() + "\" " + options + " -c \"").append(inputFile).append("\" -o \"" + outputFile + "\"\""));
+    #else
+        std::string command = std::string("\"" + (Complexes::GLSLCompiler::Instance().GetPath() + "\" " + options + " -c \"").append(inputFile).append("\" -o \"" + outputFile + "\""));
+    #endif
+        /// VK_LOG("Shader::Load() : execute command: " + command);
+        system(command.c_str());
+
+        if (!Tools::VkFunctionsHolder::Instance().IsExists(outputFile)) {
+            VK_ERROR("Shader::LoadModule() : failed to compile shader!\n\tPath: " + inputFile + "\n\tGLSL Command: " + command);
+            return VK_NULL_HANDLE;
+        }
+    #else
+        VK_ERROR("Shader::LoadModule() : the platform does not suppet shader compilation!");
+    #endif
+    }
+
+    return Tools::LoadShaderModule(outputFile.c_str(), *pDevice);
+}
+
 bool EvoVulkan::Complexes::Shader::SetVertexDescriptions(
     const std::vector<VkVertexInputBindingDescription> &binding,
     const std::vector<VkVertexInputAttributeDescription> &attribute
@@ -149,6 +153,13 @@ bool EvoVulkan::Complexes::Shader::ReCreatePipeLine(Types::RenderPass renderPass
         0
     );
 
+#ifdef VK_EXT_descriptor_buffer
+    /// layout of the shader is created for descriptor buffer
+    if (m_device->IsDescriptorBufferEnabled()) {
+        pipelineCreateInfo.flags |= VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
+    }
+#endif
+
     pipelineCreateInfo.pVertexInputState   = &m_vertices.m_inputState;
     pipelineCreateInfo.pInputAssemblyState = &m_inputAssemblyState;
     pipelineCreateInfo.pRasterizationState = &m_rasterizationState;
@@ -210,13 +221,19 @@ bool EvoVulkan::Complexes::Shader::Compile(
 }
 
 bool EvoVulkan::Complexes::Shader::BuildLayouts() {
-    m_descriptorSetLayout = Tools::CreateDescriptorLayout(*m_device, m_layoutBindings);
+    m_descriptorSetLayout = m_device->CreateDescriptorSetLayout(m_layoutBindings);
     if (m_descriptorSetLayout == VK_NULL_HANDLE) {
         VK_ERROR("Shader::BuildLayouts() : failed to create descriptor layout!");
         return false;
     }
 
-    m_pipelineLayout = Tools::CreatePipelineLayout(*m_device, 1, m_descriptorSetLayout, m_pushConstants);
+    if (m_bindlessLayout != VK_NULL_HANDLE) {
+        m_pipelineLayout = Tools::CreatePipelineLayout(*m_device, { m_descriptorSetLayout, m_bindlessLayout }, m_pushConstants);
+    }
+    else {
+        m_pipelineLayout = Tools::CreatePipelineLayout(*m_device, 1, m_descriptorSetLayout, m_pushConstants);
+    }
+
     if (m_pipelineLayout == VK_NULL_HANDLE) {
         VK_ERROR("Shader::BuildLayouts() : failed to create pipeline layout!");
         return false;
@@ -227,7 +244,7 @@ bool EvoVulkan::Complexes::Shader::BuildLayouts() {
 
 EvoVulkan::Complexes::Shader::~Shader() {
     if (m_descriptorSetLayout != VK_NULL_HANDLE) {
-        vkDestroyDescriptorSetLayout(*m_device, m_descriptorSetLayout, nullptr);
+        m_device->DestroyDescriptorSetLayout(m_descriptorSetLayout);
         m_descriptorSetLayout = VK_NULL_HANDLE;
     }
 
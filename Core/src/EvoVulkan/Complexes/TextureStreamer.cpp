@@ -0,0 +1,397 @@
+//
+// Created by Monika on 18.10.2026.
+//
+
+#include <EvoVulkan/Complexes/TextureStreamer.h>
+
+#include <EvoVulkan/Types/Texture.h>
+#include <EvoVulkan/Memory/Allocator.h>
+#include <EvoVulkan/DescriptorManager.h>
+
+namespace EvoVulkan::Complexes {
+    /// size of the levels [begin, end) in the payload of the container
+    static VkDeviceSize GetLevelsSize(const Tools::TextureFile& file, uint32_t begin, uint32_t end) {
+        return file.GetLevelOffset(end) - file.GetLevelOffset(begin);
+    }
+
+    TextureStreamer::~TextureStreamer() {
+        /// textures keep their resident levels
+        for (auto&& pTexture : m_textures) {
+            pTexture->m_streamer = nullptr;
+        }
+        m_textures.clear();
+
+        CollectRetired(true);
+    }
+
+    TextureStreamer* TextureStreamer::Create(
+        Types::Device* pDevice,
+        Memory::Allocator* pAllocator,
+        Types::UploadContext* pUploadContext,
+        VkDeviceSize frameBudget,
+        uint32_t framesInFlight)
+    {
+        if (!pDevice || !pAllocator || !pUploadContext) {
+            VK_ERROR("TextureStreamer::Create() : invalid arguments!");
+            return nullptr;
+        }
+
+        auto&& pStreamer = new TextureStreamer();
+
+        pStreamer->m_device         = pDevice;
+        pStreamer->m_allocator      = pAllocator;
+        pStreamer->m_uploadContext  = pUploadContext;
+        pStreamer->m_frameBudget    = frameBudget;
+        pStreamer->m_framesInFlight = framesInFlight;
+
+        return pStreamer;
+    }
+
+    bool TextureStreamer::Add(Types::Texture* pTexture) {
+        auto&& file = *pTexture->m_streamSource;
+        auto&& residency = pTexture->m_residency;
+
+        residency.m_levels = file.GetLevelsCount();
+        residency.m_residentLevel = residency.m_levels;
+        residency.m_requestedLevel = 0;
+
+        /// the first level which fits the tail size, the last level is resident anyway
+        residency.m_tailLevel = residency.m_levels - 1;
+        while (residency.m_tailLevel > 0) {
+            auto&& subresource = file.GetSubresource(residency.m_tailLevel - 1, 0);
+            if (EVK_MAX(subresource.m_width, subresource.m_height) > m_tailSize) {
+                break;
+            }
+            --residency.m_tailLevel;
+        }
+
+        if (!SetResidentLevel(pTexture, residency.m_tailLevel)) {
+            VK_ERROR("TextureStreamer::Add() : failed to upload tail levels!");
+            return false;
+        }
+
+        pTexture->m_streamer = this;
+        m_textures.emplace_back(pTexture);
+
+        return true;
+    }
+
+    void TextureStreamer::Remove(Types::Texture* pTexture) {
+        auto&& pIt = std::find(m_textures.begin(), m_textures.end(), pTexture);
+        if (pIt != m_textures.end()) {
+            m_textures.erase(pIt);
+        }
+
+        pTexture->m_streamer = nullptr;
+    }
+
+    void TextureStreamer::Update() {
+        ++m_frame;
+
+        /// budgets are fetched from the driver on frame change
+        vmaSetCurrentFrameIndex(*m_allocator, static_cast<uint32_t>(m_frame));
+
+        CollectRetired(false);
+
+        m_uploadedBytes = 0;
+        m_evictedBytes = 0;
+
+        const Memory::HeapBudget budget = m_allocator->GetDeviceLocalBudget();
+        const auto limit = static_cast<VkDeviceSize>(static_cast<double_t>(budget.m_budget) * m_pressureThreshold);
+
+        if (budget.m_usage > limit) {
+            Evict(budget.m_usage, limit);
+        }
+        else {
+            StreamIn(budget.m_usage, limit);
+        }
+
+        /// new images are used by textures right after Update(), so their batch goes before the frame
+        if (m_recorded) {
+            m_uploadContext->Submit();
+            m_recorded = false;
+        }
+    }
+
+    void TextureStreamer::Evict(VkDeviceSize usage, VkDeviceSize limit) {
+        std::vector<Types::Texture*> candidates;
+
+        for (auto&& pTexture : m_textures) {
+            if (pTexture->m_residency.m_residentLevel < pTexture->m_residency.m_tailLevel) {
+                candidates.emplace_back(pTexture);
+            }
+        }
+
+        /// levels which aren't requested go first, then the biggest ones
+        std::sort(candidates.begin(), candidates.end(), [](Types::Texture* pLeft, Types::Texture* pRight) {
+            auto&& left = pLeft->m_residency;
+            auto&& right = pRight->m_residency;
+
+            const bool leftUnused = left.m_residentLevel < left.m_requestedLevel;
+            const bool rightUnused = right.m_residentLevel < right.m_requestedLevel;
+
+            if (leftUnused != rightUnused) {
+                return leftUnused;
+            }
+
+            return GetLevelsSize(*pLeft->m_streamSource, left.m_residentLevel, left.m_residentLevel + 1) >
+                   GetLevelsSize(*pRight->m_streamSource, right.m_residentLevel, right.m_residentLevel + 1);
+        });
+
+        /// memory is freed only when replaced images are retired, so usage is estimated
+        for (auto&& pTexture : candidates) {
+            if (usage <= limit) {
+                break;
+            }
+
+            const uint32_t level = pTexture->m_residency.m_residentLevel;
+            const VkDeviceSize size = GetLevelsSize(*pTexture->m_streamSource, level, level + 1);
+
+            if (!SetResidentLevel(pTexture, level + 1)) {
+                continue;
+            }
+
+            usage -= EVK_MIN(usage, size);
+            m_evictedBytes += size;
+        }
+
+        if (m_evictedBytes > 0) {
+            VK_LOG("TextureStreamer::Evict() : levels are evicted under memory pressure. \n\tSize: " + std::to_string(m_evictedBytes));
+        }
+    }
+
+    void TextureStreamer::StreamIn(VkDeviceSize usage, VkDeviceSize limit) {
+        std::vector<std::pair<VkDeviceSize, Types::Texture*>> candidates;
+
+        for (auto&& pTexture : m_textures) {
+            auto&& residency = pTexture->m_residency;
+            if (residency.m_residentLevel > residency.m_requestedLevel) {
+                const uint32_t level = residency.m_residentLevel - 1;
+                candidates.emplace_back(GetLevelsSize(*pTexture->m_streamSource, level, level + 1), pTexture);
+            }
+        }
+
+        /// the cheapest levels first, so all textures get sharper evenly
+        std::sort(candidates.begin(), candidates.end(), [](auto&& left, auto&& right) {
+            return left.first < right.first;
+        });
+
+        for (auto&& [size, pTexture] : candidates) {
+            if (m_uploadedBytes > 0 && m_uploadedBytes + size > m_frameBudget) {
+                break;
+            }
+
+            if (usage + size > limit) {
+                continue;
+            }
+
+            if (!SetResidentLevel(pTexture, pTexture->m_residency.m_residentLevel - 1)) {
+                continue;
+            }
+
+            usage += size;
+            m_uploadedBytes += size;
+        }
+    }
+
+    bool TextureStreamer::SetResidentLevel(Types::Texture* pTexture, uint32_t level) {
+        auto&& file = *pTexture->m_streamSource;
+        auto&& residency = pTexture->m_residency;
+
+        const uint32_t levels = residency.m_levels;
+        const uint32_t layers = file.GetLayersCount();
+        /// all levels are missing if the texture is just loaded
+        const uint32_t oldLevel = pTexture->m_image.Valid() ? residency.m_residentLevel : levels;
+
+        if (level >= levels || level == oldLevel) {
+            return false;
+        }
+
+        auto&& top = file.GetSubresource(level, 0);
+
+        auto&& imageCI = Types::ImageCreateInfo(
+            m_allocator, pTexture->m_pool,
+            top.m_width, top.m_height, 1,
+            VK_IMAGE_ASPECT_COLOR_BIT,
+            file.GetFormat(),
+            VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
+            1 /** sample count */,
+            false /** cpu usage */,
+            levels - level,
+            layers
+        );
+
+        if (file.IsCubeMap()) {
+            imageCI.createFlagBits = VK_IMAGE_CREATE_CUBE_COMPATIBLE_BIT;
+        }
+
+        Types::Image image = Types::Image::Create(imageCI);
+        if (!image.Valid()) {
+            VK_ERROR("TextureStreamer::SetResidentLevel() : failed to create image!");
+            return false;
+        }
+
+        //!=============================================================================================================
+
+        /// levels [level, uploadEnd) aren't resident, they are uploaded from the file
+        const uint32_t uploadEnd = EVK_MIN(oldLevel, levels);
+        std::vector<VkBufferImageCopy> uploadRegions;
+        Memory::StagingRegion staging;
+
+        if (level < uploadEnd) {
+            const VkDeviceSize begin = file.GetLevelOffset(level);
+            const VkDeviceSize size = GetLevelsSize(file, level, uploadEnd);
+
+            staging = m_uploadContext->AllocateStaging(size);
+            if (!staging.Valid() || !file.UnpackRange(static_cast<uint8_t*>(staging.m_data), begin, size)) {
+                VK_ERROR("TextureStreamer::SetResidentLevel() : failed to upload levels!");
+                m_allocator->FreeImage(image);
+                return false;
+            }
+
+            for (uint32_t i = level; i < uploadEnd; ++i) {
+                for (uint32_t layer = 0; layer < layers; ++layer) {
+                    auto&& subresource = file.GetSubresource(i, layer);
+
+                    VkBufferImageCopy bufferCopyRegion = {};
+                    bufferCopyRegion.imageSubresource.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
+                    bufferCopyRegion.imageSubresource.mipLevel       = i - level;
+                    bufferCopyRegion.imageSubresource.baseArrayLayer = layer;
+                    bufferCopyRegion.imageSubresource.layerCount     = 1;
+                    bufferCopyRegion.imageExtent.width               = subresource.m_width;
+                    bufferCopyRegion.imageExtent.height              = subresource.m_height;
+                    bufferCopyRegion.imageExtent.depth               = 1;
+                    bufferCopyRegion.bufferOffset                    = staging.m_offset + (subresource.m_offset - begin);
+                    uploadRegions.emplace_back(bufferCopyRegion);
+                }
+            }
+        }
+
+        //!=============================================================================================================
+
+        auto&& pCmd = uploadRegions.empty() ? m_uploadContext->GetGraphicsCmd() : m_uploadContext->GetCmd();
+
+        image.TransitionImageLayout(VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, pCmd);
+
+        if (!uploadRegions.empty()) {
+            vkCmdCopyBufferToImage(
+                *pCmd,
+                staging.m_buffer,
+                image,
+                VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                static_cast<uint32_t>(uploadRegions.size()),
+                uploadRegions.data()
+            );
+
+            if (m_uploadContext->IsAsync()) {
+                /// resident levels are copied on graphics queue, which owns the old image
+                image.TransferOwnership(m_uploadContext);
+                pCmd = m_uploadContext->GetGraphicsCmd();
+            }
+        }
+
+        /// levels which stay resident are copied from the old image without CPU
+        if (pTexture->m_image.Valid()) {
+            std::vector<VkImageCopy> imageCopies;
+
+            for (uint32_t i = EVK_MAX(level, oldLevel); i < levels; ++i) {
+                auto&& subresource = file.GetSubresource(i, 0);
+
+                VkImageCopy imageCopy = {};
+                imageCopy.srcSubresource.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
+                imageCopy.srcSubresource.mipLevel       = i - oldLevel;
+                imageCopy.srcSubresource.baseArrayLayer = 0;
+                imageCopy.srcSubresource.layerCount     = layers;
+                imageCopy.dstSubresource                = imageCopy.srcSubresource;
+                imageCopy.dstSubresource.mipLevel       = i - level;
+                imageCopy.extent.width                  = subresource.m_width;
+                imageCopy.extent.height                 = subresource.m_height;
+                imageCopy.extent.depth                  = 1;
+                imageCopies.emplace_back(imageCopy);
+            }
+
+            pTexture->m_image.TransitionImageLayout(VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, pCmd);
+
+            vkCmdCopyImage(
+                *pCmd,
+                pTexture->m_image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                static_cast<uint32_t>(imageCopies.size()),
+                imageCopies.data()
+            );
+        }
+
+        image.TransitionImageLayout(VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, pCmd);
+
+        m_recorded = true;
+
+        //!=============================================================================================================
+
+        const VkImageView view = Tools::CreateImageView(image, file.IsCubeMap() ? VK_IMAGE_VIEW_TYPE_CUBE : VK_IMAGE_VIEW_TYPE_2D, 0);
+        if (view == VK_NULL_HANDLE) {
+            VK_ERROR("TextureStreamer::SetResidentLevel() : failed to create image view!");
+            /// commands which use the image are already recorded
+            Retire(std::move(image), VK_NULL_HANDLE, Types::DescriptorSet(), nullptr);
+            return false;
+        }
+
+        if (pTexture->m_image.Valid()) {
+            Retire(std::move(pTexture->m_image), pTexture->m_view, pTexture->m_descriptorSet, pTexture->m_descriptorManager);
+        }
+
+        /// descriptor set is allocated again by Texture::GetDescriptorSet(), the old one can be bound by frames in flight
+        pTexture->m_image         = std::move(image);
+        pTexture->m_view          = view;
+        pTexture->m_descriptorSet = Types::DescriptorSet();
+        pTexture->m_descriptor    = { pTexture->m_sampler, view, pTexture->m_image.GetLayout() };
+        pTexture->m_uploadTicket  = m_uploadContext->GetCurrentTicket();
+
+        pTexture->UpdateBindless();
+
+        residency.m_residentLevel = level;
+        residency.m_residentSize  = GetLevelsSize(file, level, levels);
+        ++residency.m_version;
+
+        return true;
+    }
+
+    void TextureStreamer::Retire(Types::Image&& image, VkImageView view, Types::DescriptorSet descriptorSet, Core::DescriptorManager* pManager) {
+        Retired retired;
+
+        retired.m_frame         = m_frame + m_framesInFlight;
+        retired.m_ticket        = m_uploadContext->GetCurrentTicket();
+        retired.m_image         = std::move(image);
+        retired.m_view          = view;
+        retired.m_descriptorSet = descriptorSet;
+        retired.m_manager       = pManager;
+
+        m_retired.emplace_back(std::move(retired));
+    }
+
+    void TextureStreamer::CollectRetired(bool force) {
+        while (!m_retired.empty()) {
+            auto&& retired = m_retired.front();
+
+            if (force) {
+                m_uploadContext->Wait(retired.m_ticket);
+            }
+            else if (retired.m_frame > m_frame || !m_uploadContext->IsComplete(retired.m_ticket)) {
+                break;
+            }
+
+            if (retired.m_manager && retired.m_descriptorSet.Valid()) {
+                retired.m_manager->FreeDescriptorSet(&retired.m_descriptorSet);
+            }
+
+            if (retired.m_view != VK_NULL_HANDLE) {
+                vkDestroyImageView(*m_device, retired.m_view, nullptr);
+            }
+
+            if (retired.m_image.Valid()) {
+                m_allocator->FreeImage(retired.m_image);
+            }
+
+            m_retired.pop_front();
+        }
+    }
+}
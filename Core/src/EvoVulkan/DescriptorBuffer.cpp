@@ -0,0 +1,295 @@
+//
+// Created by Monika on 18.10.2026.
+//
+
+#include <EvoVulkan/DescriptorBuffer.h>
+#include <EvoVulkan/Types/Device.h>
+#include <EvoVulkan/Tools/VulkanDebug.h>
+
+namespace EvoVulkan::Core {
+    DescriptorBuffer::~DescriptorBuffer() {
+        if (m_usedSize > 0) {
+            VK_WARN("DescriptorBuffer::~DescriptorBuffer() : not all descriptor sets have been freed! Size: " + std::to_string(m_usedSize));
+        }
+
+        if (m_buffer != VK_NULL_HANDLE) {
+            vkDestroyBuffer(*m_device, m_buffer, nullptr);
+            m_buffer = VK_NULL_HANDLE;
+        }
+
+        /// memory is unmapped implicitly
+        if (m_memory != VK_NULL_HANDLE) {
+            vkFreeMemory(*m_device, m_memory, nullptr);
+            m_memory = VK_NULL_HANDLE;
+        }
+    }
+
+    DescriptorBuffer* DescriptorBuffer::Create(const Types::Device* pDevice, VkDeviceSize size) {
+    #ifdef VK_EXT_descriptor_buffer
+        if (!pDevice->IsDescriptorBufferEnabled()) {
+            VK_ERROR("DescriptorBuffer::Create() : descriptor buffer isn't enabled!");
+            return nullptr;
+        }
+
+        VK_LOG("DescriptorBuffer::Create() : create descriptor buffer... \n\tSize: " + std::to_string(size));
+
+        auto&& pBuffer = new DescriptorBuffer();
+
+        pBuffer->m_device    = pDevice;
+        pBuffer->m_size      = size;
+        pBuffer->m_alignment = EVK_MAX(pDevice->GetDescriptorBufferProperties().descriptorBufferOffsetAlignment, static_cast<VkDeviceSize>(1));
+        /// combined image samplers contain sampler, so one buffer holds both kinds of descriptors
+        pBuffer->m_usage     = VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT |
+                               VK_BUFFER_USAGE_SAMPLER_DESCRIPTOR_BUFFER_BIT_EXT |
+                               VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+
+        VkBufferCreateInfo bufferCI = {};
+        bufferCI.sType       = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+        bufferCI.size        = size;
+        bufferCI.usage       = pBuffer->m_usage;
+        bufferCI.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+        if (vkCreateBuffer(*pDevice, &bufferCI, nullptr, &pBuffer->m_buffer) != VK_SUCCESS) {
+            VK_ERROR("DescriptorBuffer::Create() : failed to create buffer!");
+            delete pBuffer;
+            return nullptr;
+        }
+
+        VkMemoryRequirements memoryRequirements;
+        vkGetBufferMemoryRequirements(*pDevice, pBuffer->m_buffer, &memoryRequirements);
+
+        /// buffer is bound by its device address
+        VkMemoryAllocateFlagsInfo allocateFlagsInfo = {};
+        allocateFlagsInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO;
+        allocateFlagsInfo.flags = VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT;
+
+        VkMemoryAllocateInfo allocateInfo = {};
+        allocateInfo.sType           = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+        allocateInfo.pNext           = &allocateFlagsInfo;
+        allocateInfo.allocationSize  = memoryRequirements.size;
+        allocateInfo.memoryTypeIndex = pDevice->GetMemoryType(memoryRequirements.memoryTypeBits,
+            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+
+        if (vkAllocateMemory(*pDevice, &allocateInfo, nullptr, &pBuffer->m_memory) != VK_SUCCESS) {
+            VK_ERROR("DescriptorBuffer::Create() : failed to allocate memory!");
+            delete pBuffer;
+            return nullptr;
+        }
+
+        if (vkBindBufferMemory(*pDevice, pBuffer->m_buffer, pBuffer->m_memory, 0) != VK_SUCCESS) {
+            VK_ERROR("DescriptorBuffer::Create() : failed to bind memory!");
+            delete pBuffer;
+            return nullptr;
+        }
+
+        if (vkMapMemory(*pDevice, pBuffer->m_memory, 0, VK_WHOLE_SIZE, 0, reinterpret_cast<void**>(&pBuffer->m_mapped)) != VK_SUCCESS) {
+            VK_ERROR("DescriptorBuffer::Create() : failed to map memory!");
+            delete pBuffer;
+            return nullptr;
+        }
+
+        VkBufferDeviceAddressInfo addressInfo = {};
+        addressInfo.sType  = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO;
+        addressInfo.buffer = pBuffer->m_buffer;
+
+        pBuffer->m_address = vkGetBufferDeviceAddress(*pDevice, &addressInfo);
+
+        return pBuffer;
+    #else
+        VK_ERROR("DescriptorBuffer::Create() : descriptor buffer is not supported by vulkan headers!");
+        return nullptr;
+    #endif
+    }
+
+    Types::DescriptorSet DescriptorBuffer::Allocate(VkDescriptorSetLayout layout) {
+    #ifdef VK_EXT_descriptor_buffer
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        auto&& pSizeIt = m_layoutSizes.find(layout);
+        if (pSizeIt == m_layoutSizes.end()) {
+            const VkDeviceSize layoutSize = m_device->GetDescriptorSetLayoutSize(layout);
+            /// offsets of sets have to be aligned
+            pSizeIt = m_layoutSizes.emplace(layout, (layoutSize + m_alignment - 1) / m_alignment * m_alignment).first;
+        }
+
+        const VkDeviceSize size = pSizeIt->second;
+        VkDeviceSize offset = 0;
+
+        if (auto&& pFreeIt = m_free.find(size); pFreeIt != m_free.end() && !pFreeIt->second.empty()) {
+            offset = pFreeIt->second.back();
+            pFreeIt->second.pop_back();
+        }
+        else if (m_head + size <= m_size) {
+            offset = m_head;
+            m_head += size;
+        }
+        else {
+            VK_ERROR("DescriptorBuffer::Allocate() : descriptor buffer overflow! \n\tSize: " + std::to_string(m_size) +
+                "\n\tUsed: " + std::to_string(m_usedSize));
+            return Types::DescriptorSet();
+        }
+
+        m_usedSize += size;
+
+        return Types::DescriptorSet(layout, this, offset);
+    #else
+        return Types::DescriptorSet();
+    #endif
+    }
+
+    bool DescriptorBuffer::Free(Types::DescriptorSet& descriptorSet) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        auto&& pSizeIt = m_layoutSizes.find(descriptorSet.layout);
+        if (descriptorSet.pBuffer != this || pSizeIt == m_layoutSizes.end()) {
+            VK_ERROR("DescriptorBuffer::Free() : descriptor set isn't allocated by the buffer!");
+            return false;
+        }
+
+        m_free[pSizeIt->second].emplace_back(descriptorSet.offset);
+        m_usedSize -= pSizeIt->second;
+
+        descriptorSet.Reset();
+
+        return true;
+    }
+
+    VkDeviceSize DescriptorBuffer::GetUsedSize() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_usedSize;
+    }
+
+    void DescriptorBuffer::WriteImage(const Types::DescriptorSet& descriptorSet, uint32_t binding, uint32_t arrayElement,
+        VkDescriptorType type, const VkDescriptorImageInfo& imageInfo)
+    {
+        /// sampler and storage image descriptors take only a part of the image info
+        switch (type) {
+            case VK_DESCRIPTOR_TYPE_SAMPLER:
+                Write(descriptorSet, binding, arrayElement, type, &imageInfo.sampler);
+                break;
+            case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+            case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+            case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+            case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+                Write(descriptorSet, binding, arrayElement, type, &imageInfo);
+                break;
+            default:
+                VK_ERROR("DescriptorBuffer::WriteImage() : invalid descriptor type! Type: " + std::to_string(static_cast<int32_t>(type)));
+                break;
+        }
+    }
+
+    void DescriptorBuffer::WriteBuffer(const Types::DescriptorSet& descriptorSet, uint32_t binding, uint32_t arrayElement,
+        VkDescriptorType type, const VkDescriptorBufferInfo& bufferInfo)
+    {
+    #ifdef VK_EXT_descriptor_buffer
+        VkBufferDeviceAddressInfo addressInfo = {};
+        addressInfo.sType  = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO;
+        addressInfo.buffer = bufferInfo.buffer;
+
+        VkDescriptorAddressInfoEXT descriptorAddressInfo = {};
+        descriptorAddressInfo.sType   = VK_STRUCTURE_TYPE_DESCRIPTOR_ADDRESS_INFO_EXT;
+        descriptorAddressInfo.address = vkGetBufferDeviceAddress(*m_device, &addressInfo) + bufferInfo.offset;
+        descriptorAddressInfo.range   = bufferInfo.range;
+        descriptorAddressInfo.format  = VK_FORMAT_UNDEFINED;
+
+        if (descriptorAddressInfo.range == VK_WHOLE_SIZE) {
+            VK_ERROR("DescriptorBuffer::WriteBuffer() : range of descriptor buffer has to be explicit!");
+            return;
+        }
+
+        Write(descriptorSet, binding, arrayElement, type, &descriptorAddressInfo);
+    #endif
+    }
+
+    void DescriptorBuffer::Bind(VkCommandBuffer cmd) const {
+    #ifdef VK_EXT_descriptor_buffer
+        VkDescriptorBufferBindingInfoEXT bindingInfo = {};
+        bindingInfo.sType   = VK_STRUCTURE_TYPE_DESCRIPTOR_BUFFER_BINDING_INFO_EXT;
+        bindingInfo.address = m_address;
+        bindingInfo.usage   = m_usage;
+
+        m_device->CmdBindDescriptorBuffers(cmd, std::span<const VkDescriptorBufferBindingInfoEXT>(&bindingInfo, 1));
+    #endif
+    }
+
+    void DescriptorBuffer::SetOffsets(VkCommandBuffer cmd, VkPipelineBindPoint bindPoint, VkPipelineLayout pipelineLayout, uint32_t firstSet,
+        std::span<const Types::DescriptorSet> descriptorSets) const
+    {
+    #ifdef VK_EXT_descriptor_buffer
+        /// draws bind one or a few sets, so arrays are on the stack
+        static constexpr size_t MaxSets = 8;
+
+        if (descriptorSets.size() > MaxSets) {
+            SetOffsets(cmd, bindPoint, pipelineLayout, firstSet, descriptorSets.first(MaxSets));
+            SetOffsets(cmd, bindPoint, pipelineLayout, firstSet + static_cast<uint32_t>(MaxSets), descriptorSets.subspan(MaxSets));
+            return;
+        }
+
+        std::array<uint32_t, MaxSets> bufferIndices = { };
+        std::array<VkDeviceSize, MaxSets> offsets = { };
+
+        for (size_t i = 0; i < descriptorSets.size(); ++i) {
+            offsets[i] = descriptorSets[i].offset;
+        }
+
+        m_device->CmdSetDescriptorBufferOffsets(cmd, bindPoint, pipelineLayout, firstSet,
+            std::span<const uint32_t>(bufferIndices.data(), descriptorSets.size()),
+            std::span<const VkDeviceSize>(offsets.data(), descriptorSets.size()));
+    #endif
+    }
+
+    size_t DescriptorBuffer::GetDescriptorSize(VkDescriptorType type) const {
+    #ifdef VK_EXT_descriptor_buffer
+        auto&& properties = m_device->GetDescriptorBufferProperties();
+
+        switch (type) {
+            case VK_DESCRIPTOR_TYPE_SAMPLER: return properties.samplerDescriptorSize;
+            case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER: return properties.combinedImageSamplerDescriptorSize;
+            case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE: return properties.sampledImageDescriptorSize;
+            case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE: return properties.storageImageDescriptorSize;
+            case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER: return properties.uniformTexelBufferDescriptorSize;
+            case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER: return properties.storageTexelBufferDescriptorSize;
+            case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER: return properties.uniformBufferDescriptorSize;
+            case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER: return properties.storageBufferDescriptorSize;
+            case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT: return properties.inputAttachmentDescriptorSize;
+            case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR: return properties.accelerationStructureDescriptorSize;
+            default:
+                return 0;
+        }
+    #else
+        return 0;
+    #endif
+    }
+
+    void DescriptorBuffer::Write(const Types::DescriptorSet& descriptorSet, uint32_t binding, uint32_t arrayElement,
+        VkDescriptorType type, const void* pData)
+    {
+    #ifdef VK_EXT_descriptor_buffer
+        if (descriptorSet.pBuffer != this) {
+            VK_ERROR("DescriptorBuffer::Write() : descriptor set isn't allocated by the buffer!");
+            return;
+        }
+
+        /// dynamic buffers aren't supported by descriptor buffers
+        const size_t size = GetDescriptorSize(type);
+        if (size == 0) {
+            VK_ERROR("DescriptorBuffer::Write() : unsupported descriptor type! Type: " + std::to_string(static_cast<int32_t>(type)));
+            return;
+        }
+
+        VkDescriptorGetInfoEXT getInfo = {};
+        getInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT;
+        getInfo.type  = type;
+
+        /// all members of the union are pointers
+        std::memcpy(&getInfo.data, &pData, sizeof(pData));
+
+        const VkDeviceSize offset = descriptorSet.offset +
+            m_device->GetDescriptorSetLayoutBindingOffset(descriptorSet.layout, binding) +
+            static_cast<VkDeviceSize>(arrayElement) * size;
+
+        m_device->GetDescriptor(getInfo, size, m_mapped + offset);
+    #endif
+    }
+}
@@ -9,40 +9,207 @@
 #include <EvoVulkan/Tools/FileSystem.h>
 
 namespace EvoVulkan::Core {
+    size_t DescriptorManager::PoolKeyHash::operator()(const PoolKey& key) const noexcept {
+        size_t hash = std::hash<VkDescriptorSetLayout>()(key.m_layout);
+
+        for (auto&& type : key.m_requestTypes) {
+            hash ^= std::hash<uint64_t>()(type) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        }
+
+        return hash;
+    }
+
     Types::DescriptorSet DescriptorManager::AllocateDescriptorSet(VkDescriptorSetLayout layout, const RequestTypes& requestTypes, bool reallocate) {
-        auto&& pFound = reallocate ? nullptr : FindDescriptorPool(layout, requestTypes);
-        Types::DescriptorPool* pPool = pFound;
+        /// sizes of sets are known from layouts, request types aren't needed
+        if (m_descriptorBuffer) {
+            return m_descriptorBuffer->Allocate(layout);
+        }
+
+        const PoolKey key = MakePoolKey(layout, requestTypes);
+        auto&& shard = GetShard(layout);
+
+        /// a new pool is requested explicitly, it isn't cached
+        if (reallocate) {
+            std::lock_guard<std::mutex> lock(shard.m_mutex);
+            return AllocateDescriptorSet(shard, key, true);
+        }
+
+        auto&& pCache = GetThreadCache(true);
+
+        /// other threads lock the cache only to free their sets of its pools
+        {
+            std::lock_guard<std::mutex> lock(pCache->m_mutex);
+
+            auto&& pIt = pCache->m_pools.find(key);
+            if (pIt != pCache->m_pools.end() && !pIt->second->IsOutOfMemory()) {
+                auto&& [result, set] = pIt->second->Allocate();
+                if (result == VK_SUCCESS) {
+                    return set;
+                }
+            }
+        }
+
+        std::lock_guard<std::mutex> shardLock(shard.m_mutex);
+        std::lock_guard<std::mutex> cacheLock(pCache->m_mutex);
+
+        return RefillThreadCache(shard, *pCache, key);
+    }
+
+    Types::DescriptorSet DescriptorManager::RefillThreadCache(Shard& shard, ThreadCache& cache, const PoolKey& key) {
+        auto&& pCachedIt = cache.m_pools.find(key);
+        if (pCachedIt != cache.m_pools.end()) {
+            /// sets could be freed by other threads while the cache was unlocked
+            if (!pCachedIt->second->IsOutOfMemory()) {
+                auto&& [result, set] = pCachedIt->second->Allocate();
+                if (result == VK_SUCCESS) {
+                    return set;
+                }
+            }
+
+            ReleaseCachedPool(shard, cache, pCachedIt->second);
+            cache.m_pools.erase(pCachedIt);
+        }
+
+        auto&& [bucketKey, bucket] = GetBucket(shard, key);
+
+        if (bucket.m_available.empty() && !AllocateDescriptorPool(shard, bucketKey, bucket)) {
+            VK_ERROR("DescriptorManager::RefillThreadCache() : failed to allocate descriptor pool!" + PoolKeyToString(bucketKey));
+            return Types::DescriptorSet();
+        }
+
+        Types::DescriptorPool* pPool = bucket.m_available.back();
+        bucket.m_available.pop_back();
+
+        if (pPool->GetUsageCount() == 0) {
+            --bucket.m_emptyPools;
+        }
+
+        shard.m_pools[pPool].m_owner = &cache;
+        cache.m_pools.emplace(bucketKey, pPool);
+        cache.m_owned.emplace(pPool);
+
+        auto&& [result, set] = pPool->Allocate();
+        if (result == VK_SUCCESS) {
+            return set;
+        }
+
+        /// pool is fragmented, the set gets a new pool of the shard
+        return AllocateDescriptorSet(shard, bucketKey, true);
+    }
+
+    void DescriptorManager::ReleaseCachedPool(Shard& shard, ThreadCache& cache, Types::DescriptorPool* pPool) {
+        cache.m_owned.erase(pPool);
+
+        auto&& pIt = shard.m_pools.find(pPool);
+        if (pIt == shard.m_pools.end()) {
+            VK_ERROR("DescriptorManager::ReleaseCachedPool() : descriptor pool isn't owned by manager!");
+            return;
+        }
+
+        pIt->second.m_owner = nullptr;
+
+        auto&& bucket = *pIt->second.m_bucket;
+
+        if (!pPool->IsOutOfMemory()) {
+            bucket.m_available.emplace_back(pPool);
+        }
+
+        if (pPool->GetUsageCount() == 0 && ++bucket.m_emptyPools > m_emptyPoolsLimit) {
+            DestroyDescriptorPool(shard, pPool, bucket);
+        }
+    }
+
+    void DescriptorManager::ReleaseThreadCaches(Shard& shard) {
+        std::lock_guard<std::mutex> lock(m_cachesMutex);
+
+        for (auto&& pCache : m_caches) {
+            std::lock_guard<std::mutex> cacheLock(pCache->m_mutex);
+
+            for (auto pIt = pCache->m_pools.begin(); pIt != pCache->m_pools.end(); ) {
+                if (&GetShard(pIt->first.m_layout) != &shard) {
+                    ++pIt;
+                    continue;
+                }
+
+                ReleaseCachedPool(shard, *pCache, pIt->second);
+                pIt = pCache->m_pools.erase(pIt);
+            }
+        }
+    }
+
+    DescriptorManager::ThreadCache* DescriptorManager::GetThreadCache(bool create) {
+        /// a new manager can get the address of the freed one, so caches are found by id
+        thread_local std::unordered_map<uint64_t, ThreadCache*> caches;
+
+        auto&& pIt = caches.find(m_id);
+        if (pIt != caches.end()) {
+            return pIt->second;
+        }
+
+        if (!create) {
+            return nullptr;
+        }
+
+        std::lock_guard<std::mutex> lock(m_cachesMutex);
+
+        ThreadCache* pCache = m_caches.emplace_back(std::make_unique<ThreadCache>()).get();
+        caches.emplace(m_id, pCache);
+
+        return pCache;
+    }
+
+    Types::DescriptorSet DescriptorManager::AllocateDescriptorSet(Shard& shard, const PoolKey& poolKey, bool reallocate) {
+        auto&& [key, bucket] = GetBucket(shard, poolKey);
+
+        Types::DescriptorPool* pPool = nullptr;
+
+        if (!reallocate && !bucket.m_available.empty()) {
+            pPool = bucket.m_available.back();
+        }
 
         if (!pPool) {
-            /// VK_LOG("DescriptorPool::Create() : create new descriptor pool. Total: " + std::to_string(m_pools.size() + 1));
-            pPool = AllocateDescriptorPool(layout, requestTypes);
+            pPool = AllocateDescriptorPool(shard, key, bucket);
         }
 
         if (!pPool) {
-            VK_ERROR("DescriptorManager::AllocateDescriptorSets() : failed to allocate descriptor pool!");
+            VK_ERROR("DescriptorManager::AllocateDescriptorSet() : failed to allocate descriptor pool!" + PoolKeyToString(key));
             return Types::DescriptorSet();
         }
 
+        const bool wasEmpty = pPool->GetUsageCount() == 0;
+
         auto&& [result, set] = pPool->Allocate();
 
+        /// full pool leaves the free list until one of its sets is freed
+        if (pPool->IsOutOfMemory()) {
+            auto&& pIt = std::find(bucket.m_available.rbegin(), bucket.m_available.rend(), pPool);
+            if (pIt != bucket.m_available.rend()) {
+                bucket.m_available.erase(std::next(pIt).base());
+            }
+        }
+
+        if (result == VK_SUCCESS && wasEmpty) {
+            --bucket.m_emptyPools;
+        }
+
         switch (result) {
             case VK_SUCCESS:
                 /// all good, return
                 return set;
             case VK_ERROR_FRAGMENTED_POOL:
-                VK_ERROR("DescriptorManager::AllocateDescriptorSet(): descriptor pool is fragmented!");
+                VK_ERROR("DescriptorManager::AllocateDescriptorSet() : descriptor pool is fragmented!" + PoolKeyToString(key));
                 return Types::DescriptorSet();
             case VK_ERROR_OUT_OF_POOL_MEMORY:
                 if (!reallocate) {
-                    VK_ERROR("DescriptorManager::AllocateDescriptorSet(): out of memory descriptor pool! Trying to reallocate pool...");
-                    return AllocateDescriptorSet(layout, requestTypes, true);
+                    VK_ERROR("DescriptorManager::AllocateDescriptorSet() : out of memory descriptor pool! Trying to reallocate pool..." + PoolKeyToString(key));
+                    return AllocateDescriptorSet(shard, key, true);
                 }
                 else {
-                    VK_ERROR("DescriptorManager::AllocateDescriptorSet(): out of memory descriptor pool!");
+                    VK_ERROR("DescriptorManager::AllocateDescriptorSet() : out of memory descriptor pool!" + PoolKeyToString(key));
                 }
                 EVK_FALLTHROUGH;
             default:
-                VK_ERROR("DescriptorManager::AllocateDescriptorSet() : failed to allocate vulkan descriptor set!"
+                VK_ERROR("DescriptorManager::AllocateDescriptorSet() : failed to allocate vulkan descriptor set!" + PoolKeyToString(key) +
                          "\n\tReason: " + Tools::Convert::result_to_string(result) +
                          "\n\tDescription: " + Tools::Convert::result_to_description(result));
                 /// unrecoverable error
@@ -53,11 +220,20 @@ namespace EvoVulkan::Core {
     void EvoVulkan::Core::DescriptorManager::Reset() {
         VK_INFO("DescriptorManager::Reset() : reset all descriptor pools!");
 
-        for (auto&& pPool : m_pools) {
-            delete pPool;
-        }
+        for (auto&& shard : m_shards) {
+            std::lock_guard<std::mutex> lock(shard.m_mutex);
+
+            ReleaseThreadCaches(shard);
+
+            for (auto&& [pPool, info] : shard.m_pools) {
+                delete pPool;
+            }
+
+            m_destroyedPools += shard.m_pools.size();
 
-        m_pools.clear();
+            shard.m_pools.clear();
+            shard.m_buckets.clear();
+        }
     }
 
     bool EvoVulkan::Core::DescriptorManager::FreeDescriptorSet(Types::DescriptorSet* descriptorSet) {
@@ -66,71 +242,271 @@ namespace EvoVulkan::Core {
             return false;
         }
 
+        if (descriptorSet->pBuffer) {
+            if (descriptorSet->pBuffer != m_descriptorBuffer) {
+                VK_ERROR("DescriptorManager::FreeDescriptorSet() : descriptor buffer isn't owned by manager!");
+                return false;
+            }
+
+            return m_descriptorBuffer->Free(*descriptorSet);
+        }
+
         /// берем не по ссылке, чтобы случайно не затереть при вызове Reset
         Types::DescriptorPool* pool = descriptorSet->pPool;
 
+        /// sets of the pools cached by this thread are freed without the shard
+        if (auto&& pCache = GetThreadCache(false)) {
+            std::lock_guard<std::mutex> lock(pCache->m_mutex);
+
+            if (pCache->m_owned.count(pool)) {
+                if (pool->GetLayout() != descriptorSet->layout) {
+                    VK_ERROR("DescriptorManager::FreeDescriptorSet() : layouts are different! Something went wrong!");
+                    return false;
+                }
+
+                if (pool->Free(*descriptorSet) != VK_SUCCESS) {
+                    VK_ERROR("DescriptorManager::FreeDescriptorSet() : failed to free descriptor set!");
+                }
+
+                descriptorSet->Reset();
+
+                return true;
+            }
+        }
+
+        /// the set can be allocated by other thread, its pool is found by the layout
+        auto&& shard = GetShard(descriptorSet->layout);
+        std::lock_guard<std::mutex> lock(shard.m_mutex);
+
+        auto&& pPoolIt = shard.m_pools.find(pool);
+        if (pPoolIt == shard.m_pools.end()) {
+            VK_ERROR("DescriptorManager::FreeDescriptorSet() : descriptor pool isn't owned by manager!");
+            return false;
+        }
+
         if (pool->GetLayout() != descriptorSet->layout) {
             VK_ERROR("DescriptorManager::FreeDescriptorSet() : layouts are different! Something went wrong!");
             return false;
         }
 
+        /// pool of other thread's cache stays there, the owner keeps allocating from it
+        if (auto&& pOwner = pPoolIt->second.m_owner) {
+            std::lock_guard<std::mutex> ownerLock(pOwner->m_mutex);
+
+            if (pool->Free(*descriptorSet) != VK_SUCCESS) {
+                VK_ERROR("DescriptorManager::FreeDescriptorSet() : failed to free descriptor set!");
+            }
+
+            descriptorSet->Reset();
+
+            return true;
+        }
+
+        auto&& bucket = *pPoolIt->second.m_bucket;
+        const bool wasFull = pool->IsOutOfMemory();
+
         if (pool->Free(*descriptorSet) != VK_SUCCESS) {
             VK_ERROR("DescriptorManager::FreeDescriptorSet() : failed to free descriptor set!");
         }
 
         descriptorSet->Reset();
 
-        if (pool->GetUsageCount() == 0) {
-            VK_LOG("DescriptorPool::FreeDescriptorSet() : free empty descriptor pool. Total: " + std::to_string(m_pools.size() - 1));
-            m_pools.erase(pool);
-            delete pool;
+        if (wasFull && !pool->IsOutOfMemory()) {
+            bucket.m_available.emplace_back(pool);
+        }
+
+        /// a few empty pools are kept, otherwise pool would be recreated by the next allocation
+        if (pool->GetUsageCount() == 0 && ++bucket.m_emptyPools > m_emptyPoolsLimit) {
+            VK_LOG("DescriptorManager::FreeDescriptorSet() : free empty descriptor pool. \n\tLayout: " +
+                   Tools::PointerToString(pool->GetLayout()) + "\n\tPools of the key: " + std::to_string(bucket.m_poolsCount - 1));
+            DestroyDescriptorPool(shard, pool, bucket);
         }
 
         return true;
     }
 
+    bool DescriptorManager::EnableBindless(uint32_t capacity) {
+        if (m_bindless) {
+            VK_WARN("DescriptorManager::EnableBindless() : bindless mode is already enabled!");
+            return true;
+        }
+
+        /// the set of bindless textures is allocated from pool, it can't be bound together with descriptor buffers
+        if (m_descriptorBuffer) {
+            VK_ERROR("DescriptorManager::EnableBindless() : bindless mode isn't compatible with descriptor buffer!");
+            return false;
+        }
+
+        m_bindless = BindlessTextures::Create(m_device, capacity, m_framesInFlight);
+
+        return m_bindless != nullptr;
+    }
+
+    void DescriptorManager::SetFramesInFlight(uint32_t count) {
+        m_framesInFlight = count;
+
+        if (m_bindless) {
+            m_bindless->SetFramesInFlight(count);
+        }
+    }
+
+    void DescriptorManager::TrimEmptyPools() {
+        size_t count = 0;
+
+        for (auto&& shard : m_shards) {
+            std::lock_guard<std::mutex> lock(shard.m_mutex);
+
+            /// pools of exited threads would stay in their caches
+            ReleaseThreadCaches(shard);
+
+            std::vector<std::pair<Types::DescriptorPool*, PoolBucket*>> emptyPools;
+
+            for (auto&& [pPool, info] : shard.m_pools) {
+                if (pPool->GetUsageCount() == 0) {
+                    emptyPools.emplace_back(pPool, info.m_bucket);
+                }
+            }
+
+            for (auto&& [pPool, pBucket] : emptyPools) {
+                DestroyDescriptorPool(shard, pPool, *pBucket);
+            }
+
+            std::erase_if(shard.m_buckets, [](auto&& bucket) {
+                return bucket.second.m_poolsCount == 0;
+            });
+
+            count += emptyPools.size();
+        }
+
+        if (count > 0) {
+            VK_LOG("DescriptorManager::TrimEmptyPools() : empty descriptor pools are destroyed. Count: " + std::to_string(count));
+        }
+    }
+
+    size_t DescriptorManager::GetPoolsCount() const {
+        size_t count = 0;
+
+        for (auto&& shard : m_shards) {
+            std::lock_guard<std::mutex> lock(shard.m_mutex);
+            count += shard.m_pools.size();
+        }
+
+        return count;
+    }
+
     void DescriptorManager::Free() {
         VK_LOG("DescriptorManager::Free() : free descriptor manager pointer...");
 
-        if (!m_pools.empty()) {
-            std::string str;
-            uint32_t index = 0;
-            for (const auto& pool : m_pools) {
+        std::string str;
+        uint32_t index = 0;
+        for (auto&& shard : m_shards) {
+            std::lock_guard<std::mutex> lock(shard.m_mutex);
+
+            for (const auto& [pool, info] : shard.m_pools) {
+                /// empty pools are kept by the manager
+                if (pool->GetUsageCount() == 0) {
+                    continue;
+                }
+
                 str += "\n\t[" + std::to_string(index) + "] = " + std::to_string(pool->GetUsageCount()) + " descriptor sets";
                 ++index;
             }
+        }
 
+        if (!str.empty()) {
             VK_WARN("DescriptorManager::Free() : not all descriptor pools have been freed!" + str);
         }
 
+        VK_LOG("DescriptorManager::Free() : descriptor pools statistics. \n\tLive: " + std::to_string(GetPoolsCount()) +
+               "\n\tCreated: " + std::to_string(m_createdPools) + "\n\tDestroyed: " + std::to_string(m_destroyedPools));
+
         Reset();
 
+        EVSafeFreeObject(m_bindless);
+        EVSafeFreeObject(m_descriptorBuffer);
+
         delete this;
     }
 
     DescriptorManager *DescriptorManager::Create(const EvoVulkan::Types::Device *device) {
+        static std::atomic<uint64_t> managersCount = 0;
+
         auto&& manager = new DescriptorManager();
         manager->m_device = device;
+        manager->m_id = ++managersCount;
+
+        if (device->IsDescriptorBufferEnabled()) {
+            if (!(manager->m_descriptorBuffer = DescriptorBuffer::Create(device, DescriptorBufferSize))) {
+                VK_ERROR("DescriptorManager::Create() : failed to create descriptor buffer!");
+                delete manager;
+                return nullptr;
+            }
+        }
+
         return manager;
     }
 
-    Types::DescriptorPool *DescriptorManager::AllocateDescriptorPool(VkDescriptorSetLayout layout, const RequestTypes &requestTypes) {
-        auto&& pool = Types::DescriptorPool::Create(*m_device, 1000, layout, requestTypes);
+    DescriptorManager::Shard& DescriptorManager::GetShard(VkDescriptorSetLayout layout) {
+        /// handles are aligned pointers or sequential ids, so low bits are mixed by fibonacci hashing
+        const uint64_t hash = (uint64_t)layout * 0x9E3779B97F4A7C15ull;
+        return m_shards[hash >> (64 - ShardsBits)];
+    }
+
+    DescriptorManager::PoolKey DescriptorManager::MakePoolKey(VkDescriptorSetLayout layout, const RequestTypes& requestTypes) {
+        PoolKey key = { layout, requestTypes };
+
+        /// order and duplicates don't change the pool
+        std::sort(key.m_requestTypes.begin(), key.m_requestTypes.end());
+        key.m_requestTypes.erase(std::unique(key.m_requestTypes.begin(), key.m_requestTypes.end()), key.m_requestTypes.end());
+
+        return key;
+    }
+
+    std::string DescriptorManager::PoolKeyToString(const PoolKey& key) {
+        std::string types;
+        for (auto&& type : key.m_requestTypes) {
+            types += (types.empty() ? "" : ", ") + std::to_string(type);
+        }
+
+        return "\n\tLayout: " + Tools::PointerToString(key.m_layout) + "\n\tRequest types: [" + types + "]";
+    }
+
+    DescriptorManager::PoolBuckets::value_type& DescriptorManager::GetBucket(Shard& shard, const PoolKey& key) {
+        return *shard.m_buckets.try_emplace(key).first;
+    }
+
+    Types::DescriptorPool *DescriptorManager::AllocateDescriptorPool(Shard& shard, const PoolKey& key, PoolBucket& bucket) {
+        /// the first pools of a layout are small, most of layouts have a few sets
+        auto&& pool = Types::DescriptorPool::Create(*m_device, bucket.m_nextSets, key.m_layout, key.m_requestTypes,
+            m_device->GetDescriptorSetLayoutSizes(key.m_layout));
 
         if (pool) {
-            m_pools.insert(pool);
+            bucket.m_nextSets = EVK_MIN(bucket.m_nextSets * 2, MaxSetsPerPool);
+
+            shard.m_pools.emplace(pool, PoolInfo { &bucket, nullptr });
+            bucket.m_available.emplace_back(pool);
+            ++bucket.m_poolsCount;
+            ++bucket.m_emptyPools;
+            ++m_createdPools;
         }
 
         return pool;
     }
 
-    Types::DescriptorPool *DescriptorManager::FindDescriptorPool(VkDescriptorSetLayout layout, const RequestTypes &requestTypes) {
-        for (auto&& pool : m_pools) {
-            if (!pool->IsOutOfMemory() && layout == pool->GetLayout() && pool->Equal(requestTypes)) {
-                return pool;
-            }
+    void DescriptorManager::DestroyDescriptorPool(Shard& shard, Types::DescriptorPool* pPool, PoolBucket& bucket) {
+        auto&& pIt = std::find(bucket.m_available.begin(), bucket.m_available.end(), pPool);
+        if (pIt != bucket.m_available.end()) {
+            bucket.m_available.erase(pIt);
         }
 
-        return nullptr;
+        if (pPool->GetUsageCount() == 0) {
+            --bucket.m_emptyPools;
+        }
+
+        --bucket.m_poolsCount;
+        ++m_destroyedPools;
+
+        shard.m_pools.erase(pPool);
+        delete pPool;
     }
-}
\ No newline at end of file
+}
@@ -0,0 +1,116 @@
+//
+// Created by Monika on 18.10.2026.
+//
+
+#include <EvoVulkan/DescriptorWriter.h>
+#include <EvoVulkan/DescriptorBuffer.h>
+#include <EvoVulkan/Types/Device.h>
+#include <EvoVulkan/Tools/VulkanDebug.h>
+
+namespace EvoVulkan::Core {
+    DescriptorWriter::~DescriptorWriter() {
+        if (!m_writes.empty()) {
+            VK_WARN("DescriptorWriter::~DescriptorWriter() : writes weren't flushed! Count: " + std::to_string(m_writes.size()));
+        }
+    }
+
+    DescriptorWriter& DescriptorWriter::WriteImage(const Types::DescriptorSet& descriptorSet, uint32_t binding, VkDescriptorType type,
+        const VkDescriptorImageInfo& imageInfo, uint32_t arrayElement)
+    {
+        if (descriptorSet.pBuffer) {
+            descriptorSet.pBuffer->WriteImage(descriptorSet, binding, arrayElement, type, imageInfo);
+            return *this;
+        }
+
+        VkWriteDescriptorSet write = {};
+        write.sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        write.dstSet          = descriptorSet.descriptorSet;
+        write.dstBinding      = binding;
+        write.dstArrayElement = arrayElement;
+        write.descriptorType  = type;
+        write.descriptorCount = 1;
+
+        m_writes.emplace_back(write);
+        m_infoIndices.emplace_back(m_imageInfos.size());
+        m_imageInfos.emplace_back(imageInfo);
+
+        return *this;
+    }
+
+    DescriptorWriter& DescriptorWriter::WriteBuffer(const Types::DescriptorSet& descriptorSet, uint32_t binding, VkDescriptorType type,
+        const VkDescriptorBufferInfo& bufferInfo, uint32_t arrayElement)
+    {
+        if (descriptorSet.pBuffer) {
+            descriptorSet.pBuffer->WriteBuffer(descriptorSet, binding, arrayElement, type, bufferInfo);
+            return *this;
+        }
+
+        VkWriteDescriptorSet write = {};
+        write.sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        write.dstSet          = descriptorSet.descriptorSet;
+        write.dstBinding      = binding;
+        write.dstArrayElement = arrayElement;
+        write.descriptorType  = type;
+        write.descriptorCount = 1;
+
+        m_writes.emplace_back(write);
+        m_infoIndices.emplace_back(m_bufferInfos.size());
+        m_bufferInfos.emplace_back(bufferInfo);
+
+        return *this;
+    }
+
+    void DescriptorWriter::Flush() {
+        if (m_writes.empty()) {
+            return;
+        }
+
+        for (size_t i = 0; i < m_writes.size(); ++i) {
+            auto&& write = m_writes[i];
+
+            switch (write.descriptorType) {
+                case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+                case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+                case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+                case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+                    write.pBufferInfo = &m_bufferInfos[m_infoIndices[i]];
+                    break;
+                default:
+                    write.pImageInfo = &m_imageInfos[m_infoIndices[i]];
+                    break;
+            }
+        }
+
+        vkUpdateDescriptorSets(*m_device, static_cast<uint32_t>(m_writes.size()), m_writes.data(), 0, nullptr);
+
+        Clear();
+    }
+
+    void DescriptorWriter::Clear() {
+        m_writes.clear();
+        m_infoIndices.clear();
+        m_imageInfos.clear();
+        m_bufferInfos.clear();
+    }
+
+    bool DescriptorWriter::UpdateWithTemplate(const Types::DescriptorSet& descriptorSet, const void* pData) const {
+        if (!descriptorSet.Valid() || descriptorSet.pBuffer) {
+            VK_ERROR("DescriptorWriter::UpdateWithTemplate() : descriptor set is invalid or it's in descriptor buffer!");
+            return false;
+        }
+
+        return UpdateWithTemplate(descriptorSet.descriptorSet, descriptorSet.layout, pData);
+    }
+
+    bool DescriptorWriter::UpdateWithTemplate(VkDescriptorSet descriptorSet, VkDescriptorSetLayout layout, const void* pData) const {
+        VkDescriptorUpdateTemplate updateTemplate = m_device->GetDescriptorUpdateTemplate(layout);
+        if (updateTemplate == VK_NULL_HANDLE) {
+            VK_ERROR("DescriptorWriter::UpdateWithTemplate() : failed to get descriptor update template!");
+            return false;
+        }
+
+        vkUpdateDescriptorSetWithTemplate(*m_device, descriptorSet, updateTemplate, pData);
+
+        return true;
+    }
+}
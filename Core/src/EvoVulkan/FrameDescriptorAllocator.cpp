@@ -0,0 +1,146 @@
+//
+// Created by Monika on 18.10.2026.
+//
+
+#include <EvoVulkan/FrameDescriptorAllocator.h>
+#include <EvoVulkan/Types/Device.h>
+#include <EvoVulkan/Types/DescriptorPool.h>
+#include <EvoVulkan/Tools/VulkanDebug.h>
+#include <EvoVulkan/Tools/VulkanConverter.h>
+#include <EvoVulkan/Tools/VulkanInitializers.h>
+
+namespace EvoVulkan::Core {
+    FrameDescriptorAllocator::~FrameDescriptorAllocator() {
+        for (auto&& frame : m_frames) {
+            for (auto&& pool : frame.m_pools) {
+                vkDestroyDescriptorPool(*m_device, pool, nullptr);
+            }
+        }
+
+        m_frames.clear();
+    }
+
+    FrameDescriptorAllocator* FrameDescriptorAllocator::Create(const Types::Device* pDevice, uint32_t framesInFlight, uint32_t setsPerPool) {
+        /// layouts of descriptor buffer can't be allocated from pools
+        if (pDevice->IsDescriptorBufferEnabled()) {
+            VK_ERROR("FrameDescriptorAllocator::Create() : frame descriptor allocator isn't compatible with descriptor buffer!");
+            return nullptr;
+        }
+
+        if (framesInFlight == 0 || setsPerPool == 0) {
+            VK_ERROR("FrameDescriptorAllocator::Create() : invalid arguments!");
+            return nullptr;
+        }
+
+        VK_LOG("FrameDescriptorAllocator::Create() : create frame descriptor allocator... \n\tFrames in flight: " +
+            std::to_string(framesInFlight) + "\n\tSets per pool: " + std::to_string(setsPerPool));
+
+        auto&& pAllocator = new FrameDescriptorAllocator();
+
+        pAllocator->m_device      = pDevice;
+        pAllocator->m_setsPerPool = setsPerPool;
+        pAllocator->m_frames.resize(framesInFlight);
+
+        return pAllocator;
+    }
+
+    void FrameDescriptorAllocator::BeginFrame(uint32_t frame) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_frame = frame % static_cast<uint32_t>(m_frames.size());
+
+        auto&& pools = m_frames[m_frame];
+
+        /// pools after the current one weren't used since the last reset
+        for (uint32_t i = 0; i < pools.m_pools.size() && i <= pools.m_current; ++i) {
+            vkResetDescriptorPool(*m_device, pools.m_pools[i], 0);
+        }
+
+        pools.m_current = 0;
+        pools.m_sets = 0;
+    }
+
+    VkDescriptorSet FrameDescriptorAllocator::Allocate(VkDescriptorSetLayout layout) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        auto&& pools = m_frames[m_frame];
+
+        VkDescriptorSet descriptorSet = VK_NULL_HANDLE;
+
+        while (true) {
+            const bool isNewPool = pools.m_current == pools.m_pools.size();
+
+            if (isNewPool) {
+                VkDescriptorPool pool = CreatePool();
+                if (pool == VK_NULL_HANDLE) {
+                    VK_ERROR("FrameDescriptorAllocator::Allocate() : failed to create descriptor pool!");
+                    return VK_NULL_HANDLE;
+                }
+
+                pools.m_pools.emplace_back(pool);
+            }
+
+            auto&& allocateInfo = Tools::Initializers::DescriptorSetAllocateInfo(pools.m_pools[pools.m_current], &layout, 1);
+
+            const VkResult result = vkAllocateDescriptorSets(*m_device, &allocateInfo, &descriptorSet);
+            if (result == VK_SUCCESS) {
+                ++pools.m_sets;
+                return descriptorSet;
+            }
+
+            /// the set doesn't fit even into an empty pool
+            if (isNewPool || (result != VK_ERROR_OUT_OF_POOL_MEMORY && result != VK_ERROR_FRAGMENTED_POOL)) {
+                VK_ERROR("FrameDescriptorAllocator::Allocate() : failed to allocate descriptor set!"
+                         "\n\tReason: " + Tools::Convert::result_to_string(result) +
+                         "\n\tDescription: " + Tools::Convert::result_to_description(result));
+                return VK_NULL_HANDLE;
+            }
+
+            /// the pool is full until the next reset
+            ++pools.m_current;
+        }
+    }
+
+    uint32_t FrameDescriptorAllocator::GetSetsCount() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_frames[m_frame].m_sets;
+    }
+
+    size_t FrameDescriptorAllocator::GetPoolsCount() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        size_t count = 0;
+
+        for (auto&& frame : m_frames) {
+            count += frame.m_pools.size();
+        }
+
+        return count;
+    }
+
+    VkDescriptorPool FrameDescriptorAllocator::CreatePool() const {
+        const Types::PoolSizes poolSizes;
+        std::vector<VkDescriptorPoolSize> sizes;
+
+        /// sets of any layout are allocated from the same pools, so all types are sized by common multipliers
+        for (auto&& [type, multiplier] : poolSizes.sizes) {
+            /// requires acceleration structure extension
+            if (type == VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR) {
+                continue;
+            }
+
+            sizes.push_back({ type, EVK_MAX(static_cast<uint32_t>(multiplier * m_setsPerPool), 1u) });
+        }
+
+        /// without VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT, sets are released only by reset
+        auto&& descriptorPoolCI = Tools::Initializers::DescriptorPoolCreateInfo(sizes.size(), sizes.data(), m_setsPerPool);
+
+        VkDescriptorPool pool = VK_NULL_HANDLE;
+
+        if (vkCreateDescriptorPool(*m_device, &descriptorPoolCI, nullptr, &pool) != VK_SUCCESS) {
+            return VK_NULL_HANDLE;
+        }
+
+        return pool;
+    }
+}
@@ -21,7 +21,18 @@ bool EvoVulkan::Memory::Allocator::Init() {
 
     auto instance = m_device->GetInstance();
 
-    vmaAllocationCreateInfo.flags = VMA_ALLOCATOR_CREATE_EXTERNALLY_SYNCHRONIZED_BIT /** disable vma mutex */;
+    /// buffers and images are created by loader threads too, so vma mutex is kept
+    vmaAllocationCreateInfo.flags = 0;
+
+    /// extension is enabled by Device::Create when it's supported, budgets become real instead of estimated
+    if (m_device->IsExtensionSupported(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME)) {
+        vmaAllocationCreateInfo.flags |= VMA_ALLOCATOR_CREATE_EXT_MEMORY_BUDGET_BIT;
+    }
+
+    /// descriptor buffer backend writes buffers into sets by their device addresses
+    if (m_device->IsDescriptorBufferEnabled()) {
+        vmaAllocationCreateInfo.flags |= VMA_ALLOCATOR_CREATE_BUFFER_DEVICE_ADDRESS_BIT;
+    }
     vmaAllocationCreateInfo.physicalDevice = *m_device;
     vmaAllocationCreateInfo.device = *m_device;
     vmaAllocationCreateInfo.preferredLargeHeapBlockSize = 256 * 1024 * 1024;
@@ -145,6 +156,28 @@ uint64_t EvoVulkan::Memory::Allocator::GetCPUMemoryUsage() const {
     return 0;
 }
 
+EvoVulkan::Memory::HeapBudget EvoVulkan::Memory::Allocator::GetDeviceLocalBudget() const {
+    HeapBudget budget;
+
+    if (!m_vmaAllocator) {
+        return budget;
+    }
+
+    VmaBudget heaps[VK_MAX_MEMORY_HEAPS] = {};
+    vmaGetHeapBudgets(m_vmaAllocator, heaps);
+
+    const auto memoryProperties = m_device->GetMemoryProperties();
+
+    for (uint32_t i = 0; i < memoryProperties.memoryHeapCount; ++i) {
+        if (memoryProperties.memoryHeaps[i].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) {
+            budget.m_usage  += heaps[i].usage;
+            budget.m_budget += heaps[i].budget;
+        }
+    }
+
+    return budget;
+}
+
 EvoVulkan::Memory::Buffer EvoVulkan::Memory::Allocator::AllocBuffer(const VkBufferCreateInfo &info, VmaMemoryUsage usage) {
     return AllocBuffer(info, usage, static_cast<VmaAllocationCreateFlags>(0));
 }
@@ -161,7 +194,10 @@ EvoVulkan::Memory::Buffer EvoVulkan::Memory::Allocator::AllocBuffer(const VkBuff
     allocInfo.pool = nullptr;
     allocInfo.pUserData = nullptr;
 
-    const auto result = vmaCreateBuffer(m_vmaAllocator, &info, &allocInfo, &buffer.m_buffer, &buffer.m_allocation, nullptr);
+    VkBufferCreateInfo bufferInfo = info;
+    bufferInfo.usage = GetBufferUsage(info.usage);
+
+    const auto result = vmaCreateBuffer(m_vmaAllocator, &bufferInfo, &allocInfo, &buffer.m_buffer, &buffer.m_allocation, nullptr);
     if (result != VK_SUCCESS) {
         VK_ERROR("Allocator::AllocBuffer() : failed to create buffer! "
                  "\n\tReason: " + Tools::Convert::result_to_string(result) +
@@ -173,6 +209,18 @@ EvoVulkan::Memory::Buffer EvoVulkan::Memory::Allocator::AllocBuffer(const VkBuff
     return buffer;
 }
 
+VkBufferUsageFlags EvoVulkan::Memory::Allocator::GetBufferUsage(VkBufferUsageFlags usage) const {
+    constexpr VkBufferUsageFlags descriptorUsage =
+        VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT |
+        VK_BUFFER_USAGE_UNIFORM_TEXEL_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_TEXEL_BUFFER_BIT;
+
+    if (m_device->IsDescriptorBufferEnabled() && (usage & descriptorUsage)) {
+        usage |= VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+    }
+
+    return usage;
+}
+
 void EvoVulkan::Memory::Allocator::FreeBuffer(EvoVulkan::Memory::Buffer &info) {
     vmaDestroyBuffer(m_vmaAllocator, info.m_buffer, info.m_allocation);
 
@@ -0,0 +1,167 @@
+//
+// Created by Monika on 18.10.2026.
+//
+
+#include <EvoVulkan/Memory/StagingRing.h>
+
+namespace EvoVulkan::Memory {
+    StagingRing::~StagingRing() {
+        if (!m_entries.empty()) {
+            VK_WARN("StagingRing::Destroy() : " + std::to_string(m_entries.size()) + " regions are not freed!");
+        }
+
+        if (m_mapped) {
+            vmaUnmapMemory(*m_allocator, m_buffer.m_allocation);
+            m_mapped = nullptr;
+        }
+
+        if (m_buffer.m_buffer != VK_NULL_HANDLE) {
+            m_allocator->FreeBuffer(m_buffer);
+        }
+
+        m_allocator = nullptr;
+    }
+
+    StagingRing* StagingRing::Create(Allocator* pAllocator, VkDeviceSize size) {
+        VK_GRAPH("StagingRing::Create() : creating staging ring with size " + std::to_string(size) + "...");
+
+        if (!pAllocator || size == 0) {
+            VK_ERROR("StagingRing::Create() : invalid arguments!");
+            return nullptr;
+        }
+
+        auto&& pRing = new StagingRing();
+        pRing->m_allocator = pAllocator;
+        pRing->m_size = size;
+
+        auto&& bufferCreateInfo = Tools::Initializers::BufferCreateInfo(VK_BUFFER_USAGE_TRANSFER_SRC_BIT, size);
+
+        pRing->m_buffer = pAllocator->AllocBuffer(bufferCreateInfo, VMA_MEMORY_USAGE_CPU_ONLY);
+        if (pRing->m_buffer.m_buffer == VK_NULL_HANDLE) {
+            VK_ERROR("StagingRing::Create() : failed to allocate buffer!");
+            delete pRing;
+            return nullptr;
+        }
+
+        void* pMapped = nullptr;
+        if (auto&& result = vmaMapMemory(*pAllocator, pRing->m_buffer.m_allocation, &pMapped); result != VK_SUCCESS) {
+            VK_ERROR("StagingRing::Create() : failed to map memory! Reason: " + Tools::Convert::result_to_description(result));
+            delete pRing;
+            return nullptr;
+        }
+
+        pRing->m_mapped = static_cast<uint8_t*>(pMapped);
+
+        return pRing;
+    }
+
+    bool StagingRing::Allocate(VkDeviceSize size, VkDeviceSize alignment, StagingRegion& region) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (size == 0 || size > m_size) {
+            return false;
+        }
+
+        alignment = EVK_MAX(alignment, static_cast<VkDeviceSize>(1));
+
+        const VkDeviceSize aligned = (m_head + alignment - 1) / alignment * alignment;
+        VkDeviceSize offset = 0;
+
+        if (m_entries.empty()) {
+            m_head = m_tail = 0;
+            offset = 0;
+        }
+        else if (m_head == m_tail) {
+            /// everything is in use
+            return false;
+        }
+        else if (m_head > m_tail) {
+            /// free space is [head, size) and [0, tail)
+            if (aligned + size <= m_size) {
+                offset = aligned;
+            }
+            else if (size <= m_tail) {
+                offset = 0;
+            }
+            else {
+                return false;
+            }
+        }
+        else {
+            /// free space is [head, tail)
+            if (aligned + size > m_tail) {
+                return false;
+            }
+            offset = aligned;
+        }
+
+        Entry entry;
+        entry.m_id    = m_nextId++;
+        entry.m_begin = m_head;
+        entry.m_end   = (offset + size) % m_size;
+
+        m_used += entry.m_end > entry.m_begin ? entry.m_end - entry.m_begin : m_size - entry.m_begin + entry.m_end;
+        m_highWaterMark = EVK_MAX(m_highWaterMark, m_used);
+
+        m_head = entry.m_end;
+        m_entries.emplace_back(entry);
+
+        region.m_buffer = m_buffer.m_buffer;
+        region.m_offset = offset;
+        region.m_size   = size;
+        region.m_data   = m_mapped + offset;
+        region.m_id     = entry.m_id;
+
+        return true;
+    }
+
+    void StagingRing::Free(const StagingRegion& region) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        auto&& pIt = std::find_if(m_entries.begin(), m_entries.end(), [&region](const Entry& entry) {
+            return entry.m_id == region.m_id;
+        });
+
+        if (pIt == m_entries.end()) {
+            VK_ERROR("StagingRing::Free() : region isn't allocated from the ring!");
+            return;
+        }
+
+        pIt->m_released = true;
+
+        while (!m_entries.empty() && m_entries.front().m_released) {
+            auto&& entry = m_entries.front();
+            m_used -= entry.m_end > entry.m_begin ? entry.m_end - entry.m_begin : m_size - entry.m_begin + entry.m_end;
+            m_tail = entry.m_end;
+            m_entries.pop_front();
+        }
+
+        if (m_entries.empty()) {
+            m_head = m_tail = m_used = 0;
+        }
+    }
+
+    void StagingRing::Flush() {
+        vmaFlushAllocation(*m_allocator, m_buffer.m_allocation, 0, VK_WHOLE_SIZE);
+    }
+
+    VkDeviceSize StagingRing::GetUsed() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_used;
+    }
+
+    VkDeviceSize StagingRing::GetHighWaterMark() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_highWaterMark;
+    }
+
+    uint64_t StagingRing::GetStallsCount() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_stalls;
+    }
+
+    uint64_t StagingRing::GetSpillsCount() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_spills;
+    }
+}
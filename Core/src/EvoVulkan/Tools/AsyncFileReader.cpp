@@ -0,0 +1,506 @@
+//
+// Created by Monika on 18.10.2026.
+//
+
+#include <EvoVulkan/Tools/AsyncFileReader.h>
+#include <EvoVulkan/Tools/VulkanDebug.h>
+
+#ifdef EVK_IO_URING
+    #include <linux/io_uring.h>
+    #include <sys/syscall.h>
+    #include <sys/mman.h>
+    #include <sys/uio.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+namespace EvoVulkan::Tools {
+    AsyncFileReader::~AsyncFileReader() {
+        std::vector<FileReadTicket> tickets;
+        for (auto&& [ticket, batch] : m_batches) {
+            tickets.emplace_back(ticket);
+        }
+
+        /// destinations may be freed right after, so reads can't be left in flight
+        for (auto&& ticket : tickets) {
+            Wait(ticket);
+        }
+
+        DestroyRing();
+
+        if (m_ownPool) {
+            delete m_pool;
+        }
+        m_pool = nullptr;
+    }
+
+    AsyncFileReader* AsyncFileReader::Create(uint32_t queueDepth, ThreadPool* pPool) {
+        auto&& pReader = new AsyncFileReader();
+
+        if (pReader->InitRing(queueDepth)) {
+            VK_LOG("AsyncFileReader::Create() : files will be read by io_uring with " + std::to_string(pReader->m_entries) + " entries");
+            return pReader;
+        }
+
+        if (!(pReader->m_pool = pPool)) {
+            pReader->m_pool = ThreadPool::Create();
+            pReader->m_ownPool = true;
+        }
+
+        VK_LOG("AsyncFileReader::Create() : files will be read by " + std::to_string(pReader->m_pool->GetThreadsCount()) + " threads");
+
+        return pReader;
+    }
+
+    bool AsyncFileReader::InitRing(EVK_UNUSED uint32_t queueDepth) {
+    #ifdef EVK_IO_URING
+        io_uring_params params = { };
+
+        const auto ring = static_cast<int32_t>(syscall(__NR_io_uring_setup, queueDepth, &params));
+        if (ring < 0) {
+            return false;
+        }
+
+        m_ring = ring;
+        m_entries = params.sq_entries;
+
+        /// IORING_OP_READ is available since 5.6, the same as probing
+        std::vector<uint8_t> probeData(sizeof(io_uring_probe) + IORING_OP_LAST * sizeof(io_uring_probe_op), 0);
+        auto&& pProbe = reinterpret_cast<io_uring_probe*>(probeData.data());
+
+        if (syscall(__NR_io_uring_register, m_ring, IORING_REGISTER_PROBE, pProbe, IORING_OP_LAST) < 0 ||
+            pProbe->last_op < IORING_OP_READ || !(pProbe->ops[IORING_OP_READ].flags & IO_URING_OP_SUPPORTED)
+        ) {
+            VK_WARN("AsyncFileReader::InitRing() : io_uring doesn't support reads, kernel is too old!");
+            DestroyRing();
+            return false;
+        }
+
+        m_sqRingSize = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+        m_cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+
+        const bool singleMap = params.features & IORING_FEAT_SINGLE_MMAP;
+        if (singleMap) {
+            m_sqRingSize = m_cqRingSize = EVK_MAX(m_sqRingSize, m_cqRingSize);
+        }
+
+        m_sqRing = mmap(nullptr, m_sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ring, IORING_OFF_SQ_RING);
+        if (m_sqRing == MAP_FAILED) {
+            m_sqRing = nullptr;
+            DestroyRing();
+            return false;
+        }
+
+        if (singleMap) {
+            m_cqRing = m_sqRing;
+        }
+        else if ((m_cqRing = mmap(nullptr, m_cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ring, IORING_OFF_CQ_RING)) == MAP_FAILED) {
+            m_cqRing = nullptr;
+            DestroyRing();
+            return false;
+        }
+
+        m_sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+        m_sqes = mmap(nullptr, m_sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ring, IORING_OFF_SQES);
+        if (m_sqes == MAP_FAILED) {
+            m_sqes = nullptr;
+            DestroyRing();
+            return false;
+        }
+
+        auto&& pSq = static_cast<uint8_t*>(m_sqRing);
+        auto&& pCq = static_cast<uint8_t*>(m_cqRing);
+
+        m_sqHead  = reinterpret_cast<uint32_t*>(pSq + params.sq_off.head);
+        m_sqTail  = reinterpret_cast<uint32_t*>(pSq + params.sq_off.tail);
+        m_sqMask  = reinterpret_cast<uint32_t*>(pSq + params.sq_off.ring_mask);
+        m_sqArray = reinterpret_cast<uint32_t*>(pSq + params.sq_off.array);
+        m_cqHead  = reinterpret_cast<uint32_t*>(pCq + params.cq_off.head);
+        m_cqTail  = reinterpret_cast<uint32_t*>(pCq + params.cq_off.tail);
+        m_cqMask  = reinterpret_cast<uint32_t*>(pCq + params.cq_off.ring_mask);
+        m_cqes    = pCq + params.cq_off.cqes;
+
+        return true;
+    #else
+        return false;
+    #endif
+    }
+
+    void AsyncFileReader::DestroyRing() {
+    #ifdef EVK_IO_URING
+        if (m_sqes) {
+            munmap(m_sqes, m_sqesSize);
+            m_sqes = nullptr;
+        }
+
+        if (m_cqRing && m_cqRing != m_sqRing) {
+            munmap(m_cqRing, m_cqRingSize);
+        }
+        m_cqRing = nullptr;
+
+        if (m_sqRing) {
+            munmap(m_sqRing, m_sqRingSize);
+            m_sqRing = nullptr;
+        }
+
+        if (m_ring >= 0) {
+            close(m_ring);
+            m_ring = -1;
+        }
+    #endif
+    }
+
+    bool AsyncFileReader::RegisterBuffer(EVK_UNUSED void* pData, EVK_UNUSED uint64_t size) {
+    #ifdef EVK_IO_URING
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (!IsUring() || m_registered) {
+            return false;
+        }
+
+        iovec buffer = { pData, static_cast<size_t>(size) };
+
+        /// pages are pinned, it may fail because of RLIMIT_MEMLOCK, reads are still possible without it
+        if (syscall(__NR_io_uring_register, m_ring, IORING_REGISTER_BUFFERS, &buffer, 1) < 0) {
+            VK_WARN("AsyncFileReader::RegisterBuffer() : failed to register buffer! Size: " + std::to_string(size));
+            return false;
+        }
+
+        m_registered = static_cast<uint8_t*>(pData);
+        m_registeredSize = size;
+
+        return true;
+    #else
+        return false;
+    #endif
+    }
+
+    FileReadTicket AsyncFileReader::Submit(std::span<const FileReadRequest> requests) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        const FileReadTicket ticket = m_nextTicket++;
+
+        if (!IsUring()) {
+            auto&& batch = m_batches[ticket];
+            batch.m_pending = requests.size();
+
+            for (auto&& request : requests) {
+                m_pool->Enqueue([this, request, ticket]() {
+                    ReadFallback(request, ticket);
+                });
+            }
+
+            return ticket;
+        }
+
+    #ifdef EVK_IO_URING
+        Batch batch;
+        std::unordered_map<std::string, int32_t> files;
+
+        for (auto&& request : requests) {
+            if (files.count(request.m_path) == 0) {
+                const int32_t file = open(request.m_path.c_str(), O_RDONLY | O_CLOEXEC);
+                if (file < 0) {
+                    VK_ERROR("AsyncFileReader::Submit() : failed to open file! \n\tPath: " + request.m_path);
+
+                    for (auto&& opened : batch.m_files) {
+                        close(opened);
+                    }
+
+                    return 0;
+                }
+
+                files[request.m_path] = file;
+                batch.m_files.emplace_back(file);
+            }
+        }
+
+        for (auto&& request : requests) {
+            for (uint64_t offset = 0; offset < request.m_size; offset += ReadSize) {
+                auto&& pOperation = new Operation();
+                pOperation->m_ticket      = ticket;
+                pOperation->m_file        = files[request.m_path];
+                pOperation->m_offset      = request.m_offset + offset;
+                pOperation->m_size        = EVK_MIN(request.m_size - offset, ReadSize);
+                pOperation->m_destination = static_cast<uint8_t*>(request.m_destination) + offset;
+
+                m_queued.emplace_back(pOperation);
+                ++batch.m_pending;
+            }
+        }
+
+        if (batch.m_pending == 0) {
+            for (auto&& file : batch.m_files) {
+                close(file);
+            }
+            batch.m_files.clear();
+        }
+
+        m_batches[ticket] = std::move(batch);
+
+        SubmitQueued();
+    #endif
+
+        return ticket;
+    }
+
+    void AsyncFileReader::SubmitQueued() {
+    #ifdef EVK_IO_URING
+        const uint32_t head = std::atomic_ref<uint32_t>(*m_sqHead).load(std::memory_order_acquire);
+        uint32_t tail = *m_sqTail;
+        uint32_t count = 0;
+
+        /// completion queue is twice bigger, in flight reads are limited by submission queue to not overflow it
+        while (!m_queued.empty() && tail - head < m_entries && m_inFlight + m_unsubmitted < m_entries) {
+            Operation* pOperation = m_queued.front();
+            m_queued.pop_front();
+
+            const uint32_t index = tail & *m_sqMask;
+
+            auto&& entry = static_cast<io_uring_sqe*>(m_sqes)[index];
+            memset(&entry, 0, sizeof(io_uring_sqe));
+
+            const bool fixed = m_registered && pOperation->m_destination >= m_registered &&
+                pOperation->m_destination + pOperation->m_size <= m_registered + m_registeredSize;
+
+            entry.opcode    = fixed ? IORING_OP_READ_FIXED : IORING_OP_READ;
+            entry.fd        = pOperation->m_file;
+            entry.off       = pOperation->m_offset;
+            entry.addr      = reinterpret_cast<uint64_t>(pOperation->m_destination);
+            entry.len       = static_cast<uint32_t>(pOperation->m_size);
+            entry.buf_index = 0;
+            entry.user_data = reinterpret_cast<uint64_t>(pOperation);
+
+            m_sqArray[index] = index;
+
+            ++tail;
+            ++count;
+        }
+
+        if (count > 0) {
+            std::atomic_ref<uint32_t>(*m_sqTail).store(tail, std::memory_order_release);
+            m_unsubmitted += count;
+        }
+
+        while (m_unsubmitted > 0) {
+            const auto submitted = syscall(__NR_io_uring_enter, m_ring, m_unsubmitted, 0, 0, nullptr, 0);
+            if (submitted >= 0) {
+                m_unsubmitted -= static_cast<uint32_t>(submitted);
+                m_inFlight += static_cast<uint32_t>(submitted);
+
+                if (submitted == 0) {
+                    break;
+                }
+
+                continue;
+            }
+
+            /// entries stay in the ring, they are submitted again after completions are reaped
+            if (errno == EINTR || errno == EAGAIN || errno == EBUSY) {
+                return;
+            }
+
+            VK_ERROR("AsyncFileReader::SubmitQueued() : failed to submit reads! Error: " + std::to_string(errno));
+
+            /// entries which weren't consumed by kernel are taken back and failed, otherwise their tickets are never complete
+            const uint32_t consumed = std::atomic_ref<uint32_t>(*m_sqHead).load(std::memory_order_acquire);
+            const uint32_t published = *m_sqTail;
+
+            for (uint32_t i = consumed; i != published; ++i) {
+                auto&& entry = static_cast<io_uring_sqe*>(m_sqes)[m_sqArray[i & *m_sqMask]];
+                Complete(reinterpret_cast<Operation*>(entry.user_data), false);
+            }
+
+            std::atomic_ref<uint32_t>(*m_sqTail).store(consumed, std::memory_order_release);
+            m_unsubmitted = 0;
+
+            m_condition.notify_all();
+
+            return;
+        }
+    #endif
+    }
+
+    bool AsyncFileReader::WaitCompletions() {
+    #ifdef EVK_IO_URING
+        const auto result = syscall(__NR_io_uring_enter, m_ring, 0, 1, IORING_ENTER_GETEVENTS, nullptr, 0);
+        if (result < 0 && errno != EINTR) {
+            VK_ERROR("AsyncFileReader::WaitCompletions() : failed to wait reads! Error: " + std::to_string(errno));
+            return false;
+        }
+
+        return true;
+    #else
+        return false;
+    #endif
+    }
+
+    void AsyncFileReader::Reap() {
+    #ifdef EVK_IO_URING
+        /// the thread which is blocked in kernel reaps by itself, otherwise its completion could be taken and it would sleep forever
+        if (m_reaping) {
+            return;
+        }
+
+        uint32_t head = *m_cqHead;
+        const uint32_t tail = std::atomic_ref<uint32_t>(*m_cqTail).load(std::memory_order_acquire);
+
+        for (; head != tail; ++head) {
+            auto&& completion = static_cast<io_uring_cqe*>(m_cqes)[head & *m_cqMask];
+            auto&& pOperation = reinterpret_cast<Operation*>(completion.user_data);
+
+            --m_inFlight;
+
+            if (completion.res == -EAGAIN || completion.res == -EINTR) {
+                m_queued.emplace_back(pOperation);
+            }
+            else if (completion.res <= 0) {
+                VK_ERROR("AsyncFileReader::Reap() : failed to read file! Error: " + std::to_string(-completion.res));
+                Complete(pOperation, false);
+            }
+            else if (static_cast<uint64_t>(completion.res) < pOperation->m_size) {
+                /// short read, the rest is read again
+                pOperation->m_offset      += completion.res;
+                pOperation->m_destination += completion.res;
+                pOperation->m_size        -= completion.res;
+                m_queued.emplace_back(pOperation);
+            }
+            else {
+                Complete(pOperation, true);
+            }
+        }
+
+        std::atomic_ref<uint32_t>(*m_cqHead).store(head, std::memory_order_release);
+    #endif
+    }
+
+    void AsyncFileReader::Complete(Operation* pOperation, bool success) {
+        auto&& batch = m_batches[pOperation->m_ticket];
+
+        if (!success) {
+            batch.m_failed = true;
+        }
+
+        --batch.m_pending;
+
+    #ifdef EVK_IO_URING
+        if (batch.m_pending == 0) {
+            for (auto&& file : batch.m_files) {
+                close(file);
+            }
+            batch.m_files.clear();
+        }
+    #endif
+
+        delete pOperation;
+    }
+
+    void AsyncFileReader::ReadFallback(const FileReadRequest& request, FileReadTicket ticket) {
+        std::ifstream file(request.m_path, std::ios::binary | std::ios::in);
+
+        bool success = file.is_open();
+        if (success) {
+            file.seekg(static_cast<std::streamoff>(request.m_offset));
+            file.read(static_cast<char*>(request.m_destination), static_cast<std::streamsize>(request.m_size));
+            success = file.gcount() == static_cast<std::streamsize>(request.m_size);
+        }
+
+        if (!success) {
+            VK_ERROR("AsyncFileReader::ReadFallback() : failed to read file! \n\tPath: " + request.m_path);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            auto&& batch = m_batches[ticket];
+            if (!success) {
+                batch.m_failed = true;
+            }
+            --batch.m_pending;
+        }
+        m_condition.notify_all();
+    }
+
+    bool AsyncFileReader::IsComplete(FileReadTicket ticket) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (IsUring()) {
+            SubmitQueued();
+            Reap();
+        }
+
+        auto&& pIt = m_batches.find(ticket);
+        return pIt == m_batches.end() || pIt->second.m_pending == 0;
+    }
+
+    bool AsyncFileReader::Wait(FileReadTicket ticket) {
+        if (ticket == 0) {
+            return true;
+        }
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        if (m_batches.count(ticket) == 0) {
+            /// already waited
+            return true;
+        }
+
+        /// batches may be added by other threads while the lock is released, so it's found every time
+        while (m_batches[ticket].m_pending > 0) {
+            if (IsUring()) {
+                SubmitQueued();
+                Reap();
+
+                if (m_batches[ticket].m_pending == 0) {
+                    break;
+                }
+
+                /// only one thread sleeps in kernel, others are notified when it has reaped completions
+                if (m_reaping) {
+                    m_condition.wait(lock);
+                    continue;
+                }
+
+                /// nothing is consumed by kernel yet (submission was busy), there is nothing to wait
+                if (m_inFlight == 0) {
+                    lock.unlock();
+                    std::this_thread::yield();
+                    lock.lock();
+                    continue;
+                }
+
+                /// the lock isn't held while blocked, so other threads can submit and check their reads
+                m_reaping = true;
+                lock.unlock();
+
+                const bool waited = WaitCompletions();
+
+                lock.lock();
+                m_reaping = false;
+
+                Reap();
+                m_condition.notify_all();
+
+                if (!waited) {
+                    return false;
+                }
+
+                continue;
+            }
+
+            /// the calling thread helps workers instead of sleeping
+            lock.unlock();
+            const bool executed = m_pool->RunJob();
+            lock.lock();
+
+            if (!executed) {
+                m_condition.wait(lock, [this, ticket]() { return m_batches[ticket].m_pending == 0; });
+            }
+        }
+
+        const bool success = !m_batches[ticket].m_failed;
+        m_batches.erase(ticket);
+
+        return success;
+    }
+}
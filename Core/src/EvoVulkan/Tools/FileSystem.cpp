@@ -3,7 +3,100 @@
 //
 
 #include <EvoVulkan/Tools/FileSystem.h>
+#include <EvoVulkan/Tools/VulkanDebug.h>
+
+#ifdef EVK_WIN32
+    #include <windows.h>
+#else
+    #include <sys/mman.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
 
 namespace EvoVulkan::Tools {
+    MappedFile::~MappedFile() {
+    #ifdef EVK_WIN32
+        if (m_data) {
+            UnmapViewOfFile(m_data);
+        }
+
+        if (m_mapping) {
+            CloseHandle(m_mapping);
+        }
+
+        if (m_file && m_file != INVALID_HANDLE_VALUE) {
+            CloseHandle(m_file);
+        }
+    #else
+        if (m_data) {
+            munmap(const_cast<uint8_t*>(m_data), m_size);
+        }
+
+        if (m_file >= 0) {
+            close(m_file);
+        }
+    #endif
+
+        m_data = nullptr;
+        m_size = 0;
+    }
+
+    MappedFile* MappedFile::Open(const std::string& path) {
+        auto&& pFile = new MappedFile();
+
+    #ifdef EVK_WIN32
+        pFile->m_file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (pFile->m_file == INVALID_HANDLE_VALUE) {
+            VK_ERROR("MappedFile::Open() : failed to open file! \n\tPath: " + path);
+            delete pFile;
+            return nullptr;
+        }
+
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(pFile->m_file, &size) || size.QuadPart == 0) {
+            VK_ERROR("MappedFile::Open() : file is empty! \n\tPath: " + path);
+            delete pFile;
+            return nullptr;
+        }
+        pFile->m_size = static_cast<uint64_t>(size.QuadPart);
+
+        pFile->m_mapping = CreateFileMappingA(pFile->m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!pFile->m_mapping) {
+            VK_ERROR("MappedFile::Open() : failed to create file mapping! \n\tPath: " + path);
+            delete pFile;
+            return nullptr;
+        }
+
+        pFile->m_data = static_cast<const uint8_t*>(MapViewOfFile(pFile->m_mapping, FILE_MAP_READ, 0, 0, 0));
+    #else
+        if ((pFile->m_file = open(path.c_str(), O_RDONLY)) < 0) {
+            VK_ERROR("MappedFile::Open() : failed to open file! \n\tPath: " + path);
+            delete pFile;
+            return nullptr;
+        }
+
+        struct stat info = { };
+        if (fstat(pFile->m_file, &info) != 0 || info.st_size == 0) {
+            VK_ERROR("MappedFile::Open() : file is empty! \n\tPath: " + path);
+            delete pFile;
+            return nullptr;
+        }
+        pFile->m_size = static_cast<uint64_t>(info.st_size);
+
+        void* pData = mmap(nullptr, pFile->m_size, PROT_READ, MAP_PRIVATE, pFile->m_file, 0);
+        if (pData != MAP_FAILED) {
+            /// payloads are read once from the beginning to the end
+            madvise(pData, pFile->m_size, MADV_SEQUENTIAL);
+            pFile->m_data = static_cast<const uint8_t*>(pData);
+        }
+    #endif
+
+        if (!pFile->m_data) {
+            VK_ERROR("MappedFile::Open() : failed to map file! \n\tPath: " + path);
+            delete pFile;
+            return nullptr;
+        }
 
-}
\ No newline at end of file
+        return pFile;
+    }
+}
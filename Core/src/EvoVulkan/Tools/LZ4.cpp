@@ -0,0 +1,216 @@
+//
+// Created by Monika on 18.10.2026.
+//
+
+#include <EvoVulkan/Tools/LZ4.h>
+
+namespace EvoVulkan::Tools::LZ4 {
+    /// format limits: last 5 bytes are literals, last match starts 12 bytes before the end
+    static constexpr uint64_t LastLiterals = 5;
+    static constexpr uint64_t MatchFindLimit = 12;
+    static constexpr uint64_t MinMatch = 4;
+    static constexpr uint64_t MaxDistance = 65535;
+    static constexpr uint32_t HashLog = 12;
+
+    static uint32_t Read32(const uint8_t* p) {
+        uint32_t value;
+        memcpy(&value, p, sizeof(value));
+        return value;
+    }
+
+    static uint32_t Hash(uint32_t sequence) {
+        return (sequence * 2654435761u) >> (32 - HashLog);
+    }
+
+    /// writes 255 bytes of extra length, returns nullptr if there is no space
+    static uint8_t* WriteLength(uint8_t* pDst, const uint8_t* pDstEnd, uint64_t length) {
+        while (length >= 255) {
+            if (pDst >= pDstEnd) {
+                return nullptr;
+            }
+            *pDst++ = 255;
+            length -= 255;
+        }
+
+        if (pDst >= pDstEnd) {
+            return nullptr;
+        }
+        *pDst++ = static_cast<uint8_t>(length);
+
+        return pDst;
+    }
+
+    static uint8_t* WriteSequence(uint8_t* pDst, const uint8_t* pDstEnd, const uint8_t* pLiterals, uint64_t literals, uint64_t offset, uint64_t match) {
+        if (pDst >= pDstEnd) {
+            return nullptr;
+        }
+
+        uint8_t* pToken = pDst++;
+        *pToken = static_cast<uint8_t>(EVK_MIN(literals, 15ull) << 4);
+
+        if (literals >= 15 && !(pDst = WriteLength(pDst, pDstEnd, literals - 15))) {
+            return nullptr;
+        }
+
+        if (static_cast<uint64_t>(pDstEnd - pDst) < literals) {
+            return nullptr;
+        }
+        memcpy(pDst, pLiterals, literals);
+        pDst += literals;
+
+        /// the last sequence has only literals
+        if (match == 0) {
+            return pDst;
+        }
+
+        if (pDstEnd - pDst < 2) {
+            return nullptr;
+        }
+        *pDst++ = static_cast<uint8_t>(offset & 0xFF);
+        *pDst++ = static_cast<uint8_t>(offset >> 8);
+
+        match -= MinMatch;
+        *pToken |= static_cast<uint8_t>(EVK_MIN(match, 15ull));
+
+        if (match >= 15 && !(pDst = WriteLength(pDst, pDstEnd, match - 15))) {
+            return nullptr;
+        }
+
+        return pDst;
+    }
+
+    uint64_t GetBound(uint64_t size) {
+        return size + size / 255 + 16;
+    }
+
+    uint64_t Compress(const uint8_t* pSrc, uint64_t srcSize, uint8_t* pDst, uint64_t dstCapacity) {
+        const uint8_t* pDstEnd = pDst + dstCapacity;
+        uint8_t* pOut = pDst;
+
+        uint64_t anchor = 0;
+
+        if (srcSize > MatchFindLimit) {
+            /// positions + 1, zero is empty
+            std::vector<uint32_t> table(1u << HashLog, 0);
+
+            const uint64_t matchFindEnd = srcSize - MatchFindLimit;
+            const uint64_t matchEnd = srcSize - LastLiterals;
+
+            uint64_t position = 0;
+
+            while (position < matchFindEnd) {
+                const uint32_t sequence = Read32(pSrc + position);
+                const uint32_t hash = Hash(sequence);
+                const uint64_t candidate = table[hash];
+
+                table[hash] = static_cast<uint32_t>(position + 1);
+
+                if (candidate == 0 || position - (candidate - 1) > MaxDistance || Read32(pSrc + candidate - 1) != sequence) {
+                    ++position;
+                    continue;
+                }
+
+                const uint64_t reference = candidate - 1;
+
+                uint64_t length = MinMatch;
+                while (position + length < matchEnd && pSrc[reference + length] == pSrc[position + length]) {
+                    ++length;
+                }
+
+                pOut = WriteSequence(pOut, pDstEnd, pSrc + anchor, position - anchor, position - reference, length);
+                if (!pOut) {
+                    return 0;
+                }
+
+                position += length;
+                anchor = position;
+            }
+        }
+
+        pOut = WriteSequence(pOut, pDstEnd, pSrc + anchor, srcSize - anchor, 0, 0);
+        if (!pOut) {
+            return 0;
+        }
+
+        return static_cast<uint64_t>(pOut - pDst);
+    }
+
+    bool Decompress(const uint8_t* pSrc, uint64_t srcSize, uint8_t* pDst, uint64_t dstSize) {
+        const uint8_t* pIn = pSrc;
+        const uint8_t* pInEnd = pSrc + srcSize;
+        uint8_t* pOut = pDst;
+        uint8_t* pOutEnd = pDst + dstSize;
+
+        while (pIn < pInEnd) {
+            const uint8_t token = *pIn++;
+
+            uint64_t literals = token >> 4;
+            if (literals == 15) {
+                uint8_t byte;
+                do {
+                    if (pIn >= pInEnd) {
+                        return false;
+                    }
+                    byte = *pIn++;
+                    literals += byte;
+                } while (byte == 255);
+            }
+
+            if (static_cast<uint64_t>(pInEnd - pIn) < literals || static_cast<uint64_t>(pOutEnd - pOut) < literals) {
+                return false;
+            }
+
+            memcpy(pOut, pIn, literals);
+            pIn += literals;
+            pOut += literals;
+
+            /// the last sequence has only literals
+            if (pIn == pInEnd) {
+                break;
+            }
+
+            if (pInEnd - pIn < 2) {
+                return false;
+            }
+
+            const uint64_t offset = static_cast<uint64_t>(pIn[0]) | (static_cast<uint64_t>(pIn[1]) << 8);
+            pIn += 2;
+
+            if (offset == 0 || offset > static_cast<uint64_t>(pOut - pDst)) {
+                return false;
+            }
+
+            uint64_t match = token & 15;
+            if (match == 15) {
+                uint8_t byte;
+                do {
+                    if (pIn >= pInEnd) {
+                        return false;
+                    }
+                    byte = *pIn++;
+                    match += byte;
+                } while (byte == 255);
+            }
+            match += MinMatch;
+
+            if (static_cast<uint64_t>(pOutEnd - pOut) < match) {
+                return false;
+            }
+
+            const uint8_t* pMatch = pOut - offset;
+
+            if (offset >= match) {
+                memcpy(pOut, pMatch, match);
+                pOut += match;
+            }
+            else {
+                /// overlapped match repeats the last offset bytes
+                for (uint64_t i = 0; i < match; ++i) {
+                    *pOut++ = pMatch[i];
+                }
+            }
+        }
+
+        return pOut == pOutEnd;
+    }
+}
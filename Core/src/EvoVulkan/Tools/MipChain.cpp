@@ -0,0 +1,711 @@
+//
+// Created by Monika on 18.10.2026.
+//
+
+#include <EvoVulkan/Tools/MipChain.h>
+#include <EvoVulkan/Tools/VulkanTools.h>
+#include <EvoVulkan/Tools/ThreadPool.h>
+
+#include <limits>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #define EVK_MIP_X86
+    #include <immintrin.h>
+
+    /// AVX2 and F16C kernels are compiled for their targets and chosen by CPUID at runtime
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #include <intrin.h>
+        #define EVK_MIP_TARGET(features)
+    #else
+        #include <cpuid.h>
+        #define EVK_MIP_TARGET(features) __attribute__((target(features)))
+    #endif
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define EVK_MIP_SSE2
+    #include <emmintrin.h>
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #define EVK_MIP_NEON
+    #include <arm_neon.h>
+#endif
+
+namespace EvoVulkan::Tools {
+    namespace MipChainKernels {
+        enum class Kind : uint8_t {
+            UNorm8, SRGB8, Float16
+        };
+
+        struct Layout {
+            Kind     m_kind     = Kind::UNorm8;
+            uint32_t m_channels = 0;
+            /// index of linear alpha in sRGB texel, equal to channels if there is no alpha
+            uint32_t m_alpha    = 0;
+        };
+
+        struct Row {
+            const uint8_t* m_src0     = nullptr;
+            const uint8_t* m_src1     = nullptr;
+            uint8_t*       m_dst      = nullptr;
+            uint32_t       m_srcWidth = 0;
+            uint32_t       m_dstWidth = 0;
+        };
+
+        struct CpuFeatures {
+            bool m_avx2 = false;
+            bool m_f16c = false;
+        };
+
+        static const CpuFeatures& GetCpuFeatures() {
+            static const CpuFeatures features = []() {
+                CpuFeatures result;
+
+            #if defined(EVK_MIP_X86) && defined(_MSC_VER) && !defined(__clang__)
+                int info[4] = { };
+                __cpuid(info, 0);
+                const int maxLeaf = info[0];
+
+                __cpuid(info, 1);
+                /// registers of AVX have to be saved by OS
+                const bool avx = (info[2] & (1 << 27)) && (info[2] & (1 << 28)) && (_xgetbv(0) & 0x6) == 0x6;
+                result.m_f16c = avx && (info[2] & (1 << 29));
+
+                if (avx && maxLeaf >= 7) {
+                    __cpuidex(info, 7, 0);
+                    result.m_avx2 = info[1] & (1 << 5);
+                }
+            #elif defined(EVK_MIP_X86)
+                __builtin_cpu_init();
+
+                /// avx is reported only if OS saves its registers
+                const bool avx = __builtin_cpu_supports("avx");
+                result.m_avx2 = avx && __builtin_cpu_supports("avx2");
+
+                unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+                if (avx && __get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+                    result.m_f16c = ecx & bit_F16C;
+                }
+            #endif
+
+                return result;
+            }();
+
+            return features;
+        }
+
+        static bool GetLayout(VkFormat format, Layout& layout) {
+            switch (format) {
+                case VK_FORMAT_R8_UNORM: layout = { Kind::UNorm8, 1, 1 }; return true;
+                case VK_FORMAT_R8G8_UNORM: layout = { Kind::UNorm8, 2, 2 }; return true;
+                case VK_FORMAT_R8G8B8A8_UNORM:
+                case VK_FORMAT_B8G8R8A8_UNORM: layout = { Kind::UNorm8, 4, 4 }; return true;
+                case VK_FORMAT_R8_SRGB: layout = { Kind::SRGB8, 1, 1 }; return true;
+                case VK_FORMAT_R8G8_SRGB: layout = { Kind::SRGB8, 2, 2 }; return true;
+                case VK_FORMAT_R8G8B8A8_SRGB:
+                case VK_FORMAT_B8G8R8A8_SRGB: layout = { Kind::SRGB8, 4, 3 }; return true;
+                case VK_FORMAT_R16G16B16A16_SFLOAT: layout = { Kind::Float16, 4, 4 }; return true;
+                default:
+                    return false;
+            }
+        }
+
+        //!=============================================================================================================
+
+        struct SRGBTables {
+            /// buckets of linear values, each one is narrower than a step of encoded value
+            static constexpr int32_t EncodeTableSize = 4096;
+
+            SRGBTables() {
+                for (uint32_t i = 0; i < 256; ++i) {
+                    const float value = static_cast<float>(i) / 255.f;
+                    m_decode[i] = value <= 0.04045f ? value / 12.92f : std::pow((value + 0.055f) / 1.055f, 2.4f);
+                }
+
+                /// encoded value is the count of bounds below linear one, so it's rounded in linear space
+                for (uint32_t i = 0; i < 255; ++i) {
+                    m_bounds[i] = (m_decode[i] + m_decode[i + 1]) * 0.5f;
+                }
+
+                /// the last bound is never passed, so 255 isn't exceeded
+                m_bounds[255] = std::numeric_limits<float>::max();
+
+                for (int32_t i = 0; i < EncodeTableSize; ++i) {
+                    const float value = static_cast<float>(i) / static_cast<float>(EncodeTableSize);
+                    m_encode[i] = static_cast<int32_t>(std::upper_bound(m_bounds.begin(), m_bounds.begin() + 255, value) - m_bounds.begin());
+                }
+            }
+
+            /// the code of bucket's beginning is corrected by one comparison
+            EVK_NODISCARD uint8_t Encode(float value) const {
+                const int32_t index = EVK_CLAMP(static_cast<int32_t>(value * static_cast<float>(EncodeTableSize)), EncodeTableSize - 1, 0);
+                const int32_t code = m_encode[index];
+                return static_cast<uint8_t>(value >= m_bounds[code] ? code + 1 : code);
+            }
+
+            std::array<float, 256>               m_decode = { };
+            std::array<float, 256>               m_bounds = { };
+            std::array<int32_t, EncodeTableSize> m_encode = { };
+        };
+
+        static const SRGBTables& GetSRGBTables() {
+            static const SRGBTables tables;
+            return tables;
+        }
+
+        static float HalfToFloat(uint16_t half) {
+            const uint32_t sign = static_cast<uint32_t>(half & 0x8000u) << 16;
+            const uint32_t exponent = (half >> 10) & 0x1Fu;
+            const uint32_t mantissa = half & 0x3FFu;
+
+            if (exponent == 0) {
+                const float value = std::ldexp(static_cast<float>(mantissa), -24);
+                return sign ? -value : value;
+            }
+
+            uint32_t bits = sign | (mantissa << 13);
+            bits |= exponent == 31 ? 0x7F800000u : (exponent + 112) << 23;
+
+            float value;
+            memcpy(&value, &bits, sizeof(float));
+            return value;
+        }
+
+        static uint16_t FloatToHalf(float value) {
+            uint32_t bits;
+            memcpy(&bits, &value, sizeof(float));
+
+            const uint32_t sign = (bits >> 16) & 0x8000u;
+            const uint32_t rawExponent = (bits >> 23) & 0xFFu;
+            uint32_t mantissa = bits & 0x7FFFFFu;
+
+            if (rawExponent == 0xFF) {
+                return static_cast<uint16_t>(sign | 0x7C00u | (mantissa ? 0x200u : 0u));
+            }
+
+            const int32_t exponent = static_cast<int32_t>(rawExponent) - 127 + 15;
+
+            if (exponent >= 31) {
+                return static_cast<uint16_t>(sign | 0x7C00u);
+            }
+
+            /// round to nearest even, overflow of mantissa goes to exponent
+            if (exponent <= 0) {
+                if (exponent < -10) {
+                    return static_cast<uint16_t>(sign);
+                }
+
+                mantissa |= 0x800000u;
+                const uint32_t shift = static_cast<uint32_t>(14 - exponent);
+                uint32_t half = mantissa >> shift;
+                const uint32_t rest = mantissa & ((1u << shift) - 1);
+                const uint32_t middle = 1u << (shift - 1);
+                if (rest > middle || (rest == middle && (half & 1u))) {
+                    ++half;
+                }
+                return static_cast<uint16_t>(sign | half);
+            }
+
+            uint32_t half = (static_cast<uint32_t>(exponent) << 10) | (mantissa >> 13);
+            const uint32_t rest = mantissa & 0x1FFFu;
+            if (rest > 0x1000u || (rest == 0x1000u && (half & 1u))) {
+                ++half;
+            }
+
+            return static_cast<uint16_t>(sign | half);
+        }
+
+        //!=============================================================================================================
+
+    #if defined(EVK_MIP_X86)
+        /// texels of R8 and RGBA8 rows which have both source texels, returns count of written ones
+        EVK_MIP_TARGET("avx2")
+        static uint32_t DownsampleUNorm8AVX2(const uint8_t* pSrc0, const uint8_t* pSrc1, uint8_t* pDst, uint32_t count, uint32_t channels) {
+            const __m256i round = _mm256_set1_epi16(2);
+            const __m256i lowBytes = _mm256_set1_epi16(0x00FF);
+
+            uint32_t x = 0;
+
+            if (channels == 1) {
+                for (; x + 16 <= count; x += 16) {
+                    const __m256i row0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pSrc0 + x * 2));
+                    const __m256i row1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pSrc1 + x * 2));
+
+                    /// neighbour texels are the low and the high byte of every word
+                    __m256i sum = _mm256_add_epi16(
+                        _mm256_add_epi16(_mm256_and_si256(row0, lowBytes), _mm256_srli_epi16(row0, 8)),
+                        _mm256_add_epi16(_mm256_and_si256(row1, lowBytes), _mm256_srli_epi16(row1, 8))
+                    );
+                    sum = _mm256_srli_epi16(_mm256_add_epi16(sum, round), 2);
+
+                    const __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(sum, sum), _MM_SHUFFLE(3, 1, 2, 0));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + x), _mm256_castsi256_si128(packed));
+                }
+            }
+            else if (channels == 4) {
+                for (; x + 4 <= count; x += 4) {
+                    const __m256i row0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pSrc0 + x * 8));
+                    const __m256i row1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pSrc1 + x * 8));
+
+                    /// texels 0-3 and 4-7 widened to 16 bits, rows are summed
+                    const __m256i low = _mm256_add_epi16(
+                        _mm256_cvtepu8_epi16(_mm256_castsi256_si128(row0)),
+                        _mm256_cvtepu8_epi16(_mm256_castsi256_si128(row1))
+                    );
+                    const __m256i high = _mm256_add_epi16(
+                        _mm256_cvtepu8_epi16(_mm256_extracti128_si256(row0, 1)),
+                        _mm256_cvtepu8_epi16(_mm256_extracti128_si256(row1, 1))
+                    );
+
+                    /// neighbour texels are in one lane, sums are in the low half of every lane
+                    const __m256i lowPairs = _mm256_add_epi16(low, _mm256_srli_si256(low, 8));
+                    const __m256i highPairs = _mm256_add_epi16(high, _mm256_srli_si256(high, 8));
+
+                    __m256i sum = _mm256_unpacklo_epi64(lowPairs, highPairs);
+                    sum = _mm256_permute4x64_epi64(sum, _MM_SHUFFLE(3, 1, 2, 0));
+                    sum = _mm256_srli_epi16(_mm256_add_epi16(sum, round), 2);
+
+                    const __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(sum, sum), _MM_SHUFFLE(3, 1, 2, 0));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + x * 4), _mm256_castsi256_si128(packed));
+                }
+            }
+
+            return x;
+        }
+
+        /**
+         * 8 channel values of sRGB row are made from 16 bytes of each source row: bytes are decoded and encoded
+         * by gathers from the tables, alpha (the last channel of RGBA) is averaged as is.
+         * Returns count of written texels.
+         */
+        EVK_MIP_TARGET("avx2")
+        static uint32_t DownsampleSRGB8AVX2(const Row& row, uint32_t channels, uint32_t alpha, const SRGBTables& tables) {
+            const uint32_t count = EVK_MIN(row.m_srcWidth / 2, row.m_dstWidth) * channels;
+            const bool hasAlpha = alpha < channels;
+
+            const __m256 quarter = _mm256_set1_ps(0.25f);
+            const __m256 round = _mm256_set1_ps(2.f);
+            const __m256 scale = _mm256_set1_ps(static_cast<float>(SRGBTables::EncodeTableSize));
+            const __m256i maxIndex = _mm256_set1_epi32(SRGBTables::EncodeTableSize - 1);
+            const __m256i zero = _mm256_setzero_si256();
+
+            uint32_t i = 0;
+
+            for (; i + 8 <= count; i += 8) {
+                __m256 linear = _mm256_setzero_ps();
+                __m256 raw = _mm256_setzero_ps();
+
+                for (const uint8_t* pSrc : { row.m_src0, row.m_src1 }) {
+                    const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc + i * 2));
+                    const __m256i lowIndices = _mm256_cvtepu8_epi32(bytes);
+                    const __m256i highIndices = _mm256_cvtepu8_epi32(_mm_srli_si128(bytes, 8));
+
+                    const __m256 values[2][2] = {
+                        { _mm256_i32gather_ps(tables.m_decode.data(), lowIndices, 4), _mm256_i32gather_ps(tables.m_decode.data(), highIndices, 4) },
+                        { _mm256_cvtepi32_ps(lowIndices), _mm256_cvtepi32_ps(highIndices) }
+                    };
+
+                    __m256 sums[2];
+
+                    /// values of neighbour texels are summed, then texels are put in order
+                    for (uint32_t v = 0; v < (hasAlpha ? 2u : 1u); ++v) {
+                        auto&& low = values[v][0];
+                        auto&& high = values[v][1];
+
+                        if (channels == 1) {
+                            sums[v] = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(_mm256_hadd_ps(low, high)), _MM_SHUFFLE(3, 1, 2, 0)));
+                        }
+                        else if (channels == 2) {
+                            const __m256 pairs = _mm256_add_ps(
+                                _mm256_shuffle_ps(low, high, _MM_SHUFFLE(1, 0, 1, 0)),
+                                _mm256_shuffle_ps(low, high, _MM_SHUFFLE(3, 2, 3, 2))
+                            );
+                            sums[v] = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(pairs), _MM_SHUFFLE(3, 1, 2, 0)));
+                        }
+                        else {
+                            sums[v] = _mm256_add_ps(_mm256_permute2f128_ps(low, high, 0x20), _mm256_permute2f128_ps(low, high, 0x31));
+                        }
+                    }
+
+                    linear = _mm256_add_ps(linear, sums[0]);
+
+                    if (hasAlpha) {
+                        raw = _mm256_add_ps(raw, sums[1]);
+                    }
+                }
+
+                linear = _mm256_mul_ps(linear, quarter);
+
+                __m256i index = _mm256_cvttps_epi32(_mm256_mul_ps(linear, scale));
+                index = _mm256_max_epi32(_mm256_min_epi32(index, maxIndex), zero);
+
+                __m256i code = _mm256_i32gather_epi32(tables.m_encode.data(), index, 4);
+                const __m256 bound = _mm256_i32gather_ps(tables.m_bounds.data(), code, 4);
+                /// mask of passed bound is -1
+                code = _mm256_sub_epi32(code, _mm256_castps_si256(_mm256_cmp_ps(linear, bound, _CMP_GE_OQ)));
+
+                if (hasAlpha) {
+                    const __m256i alphaValue = _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_add_ps(raw, round), quarter));
+                    code = _mm256_blend_epi32(code, alphaValue, 0x88);
+                }
+
+                const __m256i words = _mm256_packus_epi32(code, code);
+                const __m256i bytes = _mm256_packus_epi16(words, words);
+
+                const int32_t first = _mm_cvtsi128_si32(_mm256_castsi256_si128(bytes));
+                const int32_t second = _mm_cvtsi128_si32(_mm256_extracti128_si256(bytes, 1));
+
+                memcpy(row.m_dst + i, &first, sizeof(int32_t));
+                memcpy(row.m_dst + i + 4, &second, sizeof(int32_t));
+            }
+
+            return i / channels;
+        }
+
+        EVK_MIP_TARGET("f16c")
+        static void DownsampleFloat16F16C(const Row& row) {
+            auto&& pSrc0 = reinterpret_cast<const uint16_t*>(row.m_src0);
+            auto&& pSrc1 = reinterpret_cast<const uint16_t*>(row.m_src1);
+            auto&& pDst = reinterpret_cast<uint16_t*>(row.m_dst);
+
+            const __m128 quarter = _mm_set1_ps(0.25f);
+
+            for (uint32_t x = 0; x < row.m_dstWidth; ++x) {
+                const uint32_t x0 = x * 2 * 4;
+                const uint32_t x1 = EVK_MIN(x * 2 + 1, row.m_srcWidth - 1) * 4;
+
+                const __m128 sum = _mm_add_ps(
+                    _mm_add_ps(
+                        _mm_cvtph_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(pSrc0 + x0))),
+                        _mm_cvtph_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(pSrc0 + x1)))
+                    ),
+                    _mm_add_ps(
+                        _mm_cvtph_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(pSrc1 + x0))),
+                        _mm_cvtph_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(pSrc1 + x1)))
+                    )
+                );
+
+                const __m128i half = _mm_cvtps_ph(_mm_mul_ps(sum, quarter), _MM_FROUND_TO_NEAREST_INT);
+                _mm_storel_epi64(reinterpret_cast<__m128i*>(pDst + x * 4), half);
+            }
+        }
+    #endif
+
+        /// texels which have both source texels, returns count of written ones
+        static uint32_t DownsampleUNorm8SIMD(const uint8_t* pSrc0, const uint8_t* pSrc1, uint8_t* pDst, uint32_t count, uint32_t channels) {
+            uint32_t x = 0;
+
+        #if defined(EVK_MIP_X86)
+            if (GetCpuFeatures().m_avx2) {
+                x = DownsampleUNorm8AVX2(pSrc0, pSrc1, pDst, count, channels);
+            }
+        #endif
+
+        #if defined(EVK_MIP_SSE2)
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i round = _mm_set1_epi16(2);
+
+            if (channels == 1) {
+                const __m128i lowBytes = _mm_set1_epi16(0x00FF);
+
+                for (; x + 8 <= count; x += 8) {
+                    const __m128i row0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc0 + x * 2));
+                    const __m128i row1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc1 + x * 2));
+
+                    __m128i sum = _mm_add_epi16(
+                        _mm_add_epi16(_mm_and_si128(row0, lowBytes), _mm_srli_epi16(row0, 8)),
+                        _mm_add_epi16(_mm_and_si128(row1, lowBytes), _mm_srli_epi16(row1, 8))
+                    );
+                    sum = _mm_srli_epi16(_mm_add_epi16(sum, round), 2);
+
+                    _mm_storel_epi64(reinterpret_cast<__m128i*>(pDst + x), _mm_packus_epi16(sum, sum));
+                }
+            }
+            else if (channels == 2) {
+                for (; x + 4 <= count; x += 4) {
+                    const __m128i row0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc0 + x * 4));
+                    const __m128i row1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc1 + x * 4));
+
+                    const __m128i low = _mm_add_epi16(_mm_unpacklo_epi8(row0, zero), _mm_unpacklo_epi8(row1, zero));
+                    const __m128i high = _mm_add_epi16(_mm_unpackhi_epi8(row0, zero), _mm_unpackhi_epi8(row1, zero));
+
+                    /// texel is a dword, sums of neighbours are in the even dwords
+                    const __m128i lowPairs = _mm_shuffle_epi32(_mm_add_epi16(low, _mm_srli_epi64(low, 32)), _MM_SHUFFLE(3, 1, 2, 0));
+                    const __m128i highPairs = _mm_shuffle_epi32(_mm_add_epi16(high, _mm_srli_epi64(high, 32)), _MM_SHUFFLE(3, 1, 2, 0));
+
+                    __m128i sum = _mm_unpacklo_epi64(lowPairs, highPairs);
+                    sum = _mm_srli_epi16(_mm_add_epi16(sum, round), 2);
+
+                    _mm_storel_epi64(reinterpret_cast<__m128i*>(pDst + x * 2), _mm_packus_epi16(sum, sum));
+                }
+            }
+            else if (channels == 4) {
+                for (; x + 2 <= count; x += 2) {
+                    const __m128i row0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc0 + x * 8));
+                    const __m128i row1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc1 + x * 8));
+
+                    const __m128i low = _mm_add_epi16(_mm_unpacklo_epi8(row0, zero), _mm_unpacklo_epi8(row1, zero));
+                    const __m128i high = _mm_add_epi16(_mm_unpackhi_epi8(row0, zero), _mm_unpackhi_epi8(row1, zero));
+
+                    const __m128i lowPair = _mm_add_epi16(low, _mm_srli_si128(low, 8));
+                    const __m128i highPair = _mm_add_epi16(high, _mm_srli_si128(high, 8));
+
+                    __m128i sum = _mm_unpacklo_epi64(lowPair, highPair);
+                    sum = _mm_srli_epi16(_mm_add_epi16(sum, round), 2);
+
+                    _mm_storel_epi64(reinterpret_cast<__m128i*>(pDst + x * 4), _mm_packus_epi16(sum, sum));
+                }
+            }
+        #elif defined(EVK_MIP_NEON)
+            if (channels == 1) {
+                for (; x + 8 <= count; x += 8) {
+                    /// pairwise addition sums neighbour texels
+                    const uint16x8_t sum = vaddq_u16(vpaddlq_u8(vld1q_u8(pSrc0 + x * 2)), vpaddlq_u8(vld1q_u8(pSrc1 + x * 2)));
+                    vst1_u8(pDst + x, vrshrn_n_u16(sum, 2));
+                }
+            }
+            else if (channels == 2) {
+                for (; x + 8 <= count; x += 8) {
+                    /// channels are deinterleaved, so neighbours are summed pairwise as in R8
+                    const uint8x16x2_t row0 = vld2q_u8(pSrc0 + x * 4);
+                    const uint8x16x2_t row1 = vld2q_u8(pSrc1 + x * 4);
+
+                    uint8x8x2_t result;
+                    result.val[0] = vrshrn_n_u16(vaddq_u16(vpaddlq_u8(row0.val[0]), vpaddlq_u8(row1.val[0])), 2);
+                    result.val[1] = vrshrn_n_u16(vaddq_u16(vpaddlq_u8(row0.val[1]), vpaddlq_u8(row1.val[1])), 2);
+
+                    vst2_u8(pDst + x * 2, result);
+                }
+            }
+            else if (channels == 4) {
+                for (; x + 2 <= count; x += 2) {
+                    const uint8x16_t row0 = vld1q_u8(pSrc0 + x * 8);
+                    const uint8x16_t row1 = vld1q_u8(pSrc1 + x * 8);
+
+                    const uint16x8_t low = vaddl_u8(vget_low_u8(row0), vget_low_u8(row1));
+                    const uint16x8_t high = vaddl_u8(vget_high_u8(row0), vget_high_u8(row1));
+
+                    const uint16x4_t lowPair = vadd_u16(vget_low_u16(low), vget_high_u16(low));
+                    const uint16x4_t highPair = vadd_u16(vget_low_u16(high), vget_high_u16(high));
+
+                    /// rounding shift adds 2 before division
+                    vst1_u8(pDst + x * 4, vrshrn_n_u16(vcombine_u16(lowPair, highPair), 2));
+                }
+            }
+        #endif
+
+            return x;
+        }
+
+        static void DownsampleUNorm8(const Row& row, uint32_t channels) {
+            uint32_t x = DownsampleUNorm8SIMD(row.m_src0, row.m_src1, row.m_dst, EVK_MIN(row.m_srcWidth / 2, row.m_dstWidth), channels);
+
+            for (; x < row.m_dstWidth; ++x) {
+                const uint32_t x0 = x * 2 * channels;
+                const uint32_t x1 = EVK_MIN(x * 2 + 1, row.m_srcWidth - 1) * channels;
+
+                for (uint32_t c = 0; c < channels; ++c) {
+                    const uint32_t sum = row.m_src0[x0 + c] + row.m_src0[x1 + c] + row.m_src1[x0 + c] + row.m_src1[x1 + c];
+                    row.m_dst[x * channels + c] = static_cast<uint8_t>((sum + 2) >> 2);
+                }
+            }
+        }
+
+        static void DownsampleSRGB8(const Row& row, uint32_t channels, uint32_t alpha) {
+            auto&& tables = GetSRGBTables();
+
+            uint32_t x = 0;
+
+        #if defined(EVK_MIP_X86)
+            if (GetCpuFeatures().m_avx2) {
+                x = DownsampleSRGB8AVX2(row, channels, alpha, tables);
+            }
+        #endif
+
+            for (; x < row.m_dstWidth; ++x) {
+                const uint32_t x0 = x * 2 * channels;
+                const uint32_t x1 = EVK_MIN(x * 2 + 1, row.m_srcWidth - 1) * channels;
+
+                for (uint32_t c = 0; c < channels; ++c) {
+                    if (c == alpha) {
+                        const uint32_t sum = row.m_src0[x0 + c] + row.m_src0[x1 + c] + row.m_src1[x0 + c] + row.m_src1[x1 + c];
+                        row.m_dst[x * channels + c] = static_cast<uint8_t>((sum + 2) >> 2);
+                        continue;
+                    }
+
+                    const float sum =
+                        tables.m_decode[row.m_src0[x0 + c]] + tables.m_decode[row.m_src0[x1 + c]] +
+                        tables.m_decode[row.m_src1[x0 + c]] + tables.m_decode[row.m_src1[x1 + c]];
+
+                    row.m_dst[x * channels + c] = tables.Encode(sum * 0.25f);
+                }
+            }
+        }
+
+        static void DownsampleFloat16(const Row& row) {
+        #if defined(EVK_MIP_X86)
+            if (GetCpuFeatures().m_f16c) {
+                DownsampleFloat16F16C(row);
+                return;
+            }
+        #endif
+
+            auto&& pSrc0 = reinterpret_cast<const uint16_t*>(row.m_src0);
+            auto&& pSrc1 = reinterpret_cast<const uint16_t*>(row.m_src1);
+            auto&& pDst = reinterpret_cast<uint16_t*>(row.m_dst);
+
+            for (uint32_t x = 0; x < row.m_dstWidth; ++x) {
+                const uint32_t x0 = x * 2 * 4;
+                const uint32_t x1 = EVK_MIN(x * 2 + 1, row.m_srcWidth - 1) * 4;
+
+            #if defined(EVK_MIP_NEON) && defined(__aarch64__)
+                const float32x4_t sum = vaddq_f32(
+                    vaddq_f32(vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(pSrc0 + x0))), vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(pSrc0 + x1)))),
+                    vaddq_f32(vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(pSrc1 + x0))), vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(pSrc1 + x1))))
+                );
+
+                vst1_u16(pDst + x * 4, vreinterpret_u16_f16(vcvt_f16_f32(vmulq_n_f32(sum, 0.25f))));
+            #else
+                for (uint32_t c = 0; c < 4; ++c) {
+                    const float sum =
+                        HalfToFloat(pSrc0[x0 + c]) + HalfToFloat(pSrc0[x1 + c]) +
+                        HalfToFloat(pSrc1[x0 + c]) + HalfToFloat(pSrc1[x1 + c]);
+
+                    pDst[x * 4 + c] = FloatToHalf(sum * 0.25f);
+                }
+            #endif
+            }
+        }
+
+        static void DownsampleRows(const Layout& layout, const uint8_t* pSrc, uint8_t* pDst,
+            uint32_t srcWidth, uint32_t srcHeight, uint32_t dstWidth, uint32_t firstRow, uint32_t lastRow)
+        {
+            const uint32_t texelSize = layout.m_kind == Kind::Float16 ? layout.m_channels * 2 : layout.m_channels;
+            const VkDeviceSize srcPitch = static_cast<VkDeviceSize>(srcWidth) * texelSize;
+            const VkDeviceSize dstPitch = static_cast<VkDeviceSize>(dstWidth) * texelSize;
+
+            for (uint32_t y = firstRow; y < lastRow; ++y) {
+                Row row;
+                row.m_src0     = pSrc + srcPitch * (y * 2);
+                row.m_src1     = pSrc + srcPitch * EVK_MIN(y * 2 + 1, srcHeight - 1);
+                row.m_dst      = pDst + dstPitch * y;
+                row.m_srcWidth = srcWidth;
+                row.m_dstWidth = dstWidth;
+
+                switch (layout.m_kind) {
+                    case Kind::UNorm8: DownsampleUNorm8(row, layout.m_channels); break;
+                    case Kind::SRGB8: DownsampleSRGB8(row, layout.m_channels, layout.m_alpha); break;
+                    case Kind::Float16: DownsampleFloat16(row); break;
+                }
+            }
+        }
+    }
+
+    //!=================================================================================================================
+
+    bool MipChain::IsSupported(VkFormat format) {
+        MipChainKernels::Layout layout;
+        return MipChainKernels::GetLayout(format, layout);
+    }
+
+    bool MipChain::Generate(const uint8_t* pixels, VkFormat format, uint32_t width, uint32_t height, uint32_t mipLevels, ThreadPool* pPool) {
+        Clear();
+
+        MipChainKernels::Layout layout;
+        if (!MipChainKernels::GetLayout(format, layout)) {
+            VK_ERROR("MipChain::Generate() : unsupported format! Format: " + std::to_string(static_cast<int32_t>(format)));
+            return false;
+        }
+
+        if (!pixels || width == 0 || height == 0) {
+            VK_ERROR("MipChain::Generate() : invalid arguments!");
+            return false;
+        }
+
+        const uint32_t maxLevels = static_cast<uint32_t>(std::floor(std::log2(EVK_MAX(width, height)))) + 1;
+        mipLevels = mipLevels == 0 ? maxLevels : EVK_MIN(mipLevels, maxLevels);
+
+        const uint32_t texelSize = GetTexelSize(format);
+
+        /// offsets are aligned as buffer offsets of copy regions
+        constexpr VkDeviceSize alignment = 16;
+
+        VkDeviceSize size = 0;
+        for (uint32_t level = 0; level < mipLevels; ++level) {
+            MipLevel mipLevel;
+            mipLevel.m_width  = EVK_MAX(width >> level, 1u);
+            mipLevel.m_height = EVK_MAX(height >> level, 1u);
+            mipLevel.m_offset = size;
+            mipLevel.m_size   = static_cast<VkDeviceSize>(mipLevel.m_width) * mipLevel.m_height * texelSize;
+
+            size += (mipLevel.m_size + alignment - 1) / alignment * alignment;
+            m_levels.emplace_back(mipLevel);
+        }
+
+        m_format = format;
+        m_data.resize(size);
+
+        memcpy(m_data.data(), pixels, m_levels.front().m_size);
+
+        if (mipLevels == 1) {
+            return true;
+        }
+
+        /**
+         * Levels are split in bands of the same count of rows. Band b reads rows of bands 2b and 2b+1
+         * of the previous level, so it's started by the last of them instead of waiting the whole level.
+         */
+        constexpr uint32_t minTexelsPerBand = 64 * 64;
+        const uint32_t bandRows = EVK_MAX(minTexelsPerBand / m_levels[1].m_width, 1u);
+
+        std::vector<uint32_t> firstBands(mipLevels + 1, 0);
+        for (uint32_t level = 1; level < mipLevels; ++level) {
+            firstBands[level + 1] = firstBands[level] + (m_levels[level].m_height + bandRows - 1) / bandRows;
+        }
+
+        auto&& getBandsCount = [&firstBands](uint32_t level) {
+            return firstBands[level + 1] - firstBands[level];
+        };
+
+        std::vector<std::atomic<uint32_t>> dependencies(firstBands[mipLevels]);
+        for (uint32_t level = 2; level < mipLevels; ++level) {
+            for (uint32_t band = 0; band < getBandsCount(level); ++band) {
+                dependencies[firstBands[level] + band] = EVK_MIN(getBandsCount(level - 1) - band * 2, 2u);
+            }
+        }
+
+        ThreadPool::Group group(pPool);
+
+        std::function<void(uint32_t, uint32_t)> runBand = [&](uint32_t level, uint32_t band) {
+            auto&& src = m_levels[level - 1];
+            auto&& dst = m_levels[level];
+
+            const uint32_t firstRow = band * bandRows;
+            const uint32_t lastRow = EVK_MIN(firstRow + bandRows, dst.m_height);
+
+            MipChainKernels::DownsampleRows(layout, m_data.data() + src.m_offset, m_data.data() + dst.m_offset,
+                src.m_width, src.m_height, dst.m_width, firstRow, lastRow);
+
+            const uint32_t next = band / 2;
+
+            if (level + 1 < mipLevels && next < getBandsCount(level + 1) && --dependencies[firstBands[level + 1] + next] == 0) {
+                group.Run([&runBand, level, next]() { runBand(level + 1, next); });
+            }
+        };
+
+        for (uint32_t band = 0; band < getBandsCount(1); ++band) {
+            group.Run([&runBand, band]() { runBand(1, band); });
+        }
+
+        group.Wait();
+
+        return true;
+    }
+
+    void MipChain::Clear() {
+        m_format = VK_FORMAT_UNDEFINED;
+        m_levels.clear();
+        m_data.clear();
+    }
+}
@@ -0,0 +1,239 @@
+//
+// Created by Monika on 18.10.2026.
+//
+
+#include <EvoVulkan/Tools/TextureCompressor.h>
+#include <EvoVulkan/Tools/VulkanDebug.h>
+#include <EvoVulkan/Tools/VulkanHelper.h>
+
+#include <cmp_core.h>
+
+namespace EvoVulkan::Tools {
+    namespace TextureCompressorKernels {
+        /// gathers 4x4 RGBA texels, edge texels are repeated for partial blocks
+        static void GatherBlock(const uint8_t* pSrc, uint32_t width, uint32_t height, uint32_t blockX, uint32_t blockY, uint8_t block[64]) {
+            for (uint32_t y = 0; y < 4; ++y) {
+                const uint32_t srcY = EVK_MIN(blockY * 4 + y, height - 1);
+
+                for (uint32_t x = 0; x < 4; ++x) {
+                    const uint32_t srcX = EVK_MIN(blockX * 4 + x, width - 1);
+                    memcpy(block + (y * 4 + x) * 4, pSrc + (static_cast<VkDeviceSize>(srcY) * width + srcX) * 4, 4);
+                }
+            }
+        }
+
+        static bool CompressBlock(BlockCompression compression, const uint8_t block[64], uint8_t* pDst, const void* pOptions) {
+            switch (compression) {
+                case BlockCompression::BC1:
+                    return CompressBlockBC1(block, 16, pDst, pOptions) == 0;
+                case BlockCompression::BC2:
+                    return CompressBlockBC2(block, 16, pDst, pOptions) == 0;
+                case BlockCompression::BC3:
+                    return CompressBlockBC3(block, 16, pDst, pOptions) == 0;
+                case BlockCompression::BC7:
+                    return CompressBlockBC7(block, 16, pDst, pOptions) == 0;
+                case BlockCompression::BC4: {
+                    uint8_t red[16];
+                    for (uint32_t i = 0; i < 16; ++i) {
+                        red[i] = block[i * 4];
+                    }
+                    return CompressBlockBC4(red, 4, pDst, pOptions) == 0;
+                }
+                case BlockCompression::BC5: {
+                    uint8_t red[16], green[16];
+                    for (uint32_t i = 0; i < 16; ++i) {
+                        red[i] = block[i * 4];
+                        green[i] = block[i * 4 + 1];
+                    }
+                    return CompressBlockBC5(red, 4, green, 4, pDst, pOptions) == 0;
+                }
+                default:
+                    return false;
+            }
+        }
+
+        static void DestroyOptions(BlockCompression compression, void* pOptions) {
+            switch (compression) {
+                case BlockCompression::BC1: DestroyOptionsBC1(pOptions); break;
+                case BlockCompression::BC2: DestroyOptionsBC2(pOptions); break;
+                case BlockCompression::BC3: DestroyOptionsBC3(pOptions); break;
+                case BlockCompression::BC4: DestroyOptionsBC4(pOptions); break;
+                case BlockCompression::BC5: DestroyOptionsBC5(pOptions); break;
+                case BlockCompression::BC7: DestroyOptionsBC7(pOptions); break;
+                default:
+                    break;
+            }
+        }
+
+        /// options are created per Compress() call, so concurrent calls don't share them
+        static void* CreateOptions(BlockCompression compression, float quality, bool sRGB) {
+            void* pOptions = nullptr;
+            bool result = false;
+
+            switch (compression) {
+                case BlockCompression::BC1:
+                    result = CreateOptionsBC1(&pOptions) == 0 && SetQualityBC1(pOptions, quality) == 0 && SetSrgbBC1(pOptions, sRGB) == 0;
+                    break;
+                case BlockCompression::BC2:
+                    result = CreateOptionsBC2(&pOptions) == 0 && SetQualityBC2(pOptions, quality) == 0 && SetSrgbBC2(pOptions, sRGB) == 0;
+                    break;
+                case BlockCompression::BC3:
+                    result = CreateOptionsBC3(&pOptions) == 0 && SetQualityBC3(pOptions, quality) == 0 && SetSrgbBC3(pOptions, sRGB) == 0;
+                    break;
+                case BlockCompression::BC4:
+                    result = CreateOptionsBC4(&pOptions) == 0 && SetQualityBC4(pOptions, quality) == 0;
+                    break;
+                case BlockCompression::BC5:
+                    result = CreateOptionsBC5(&pOptions) == 0 && SetQualityBC5(pOptions, quality) == 0;
+                    break;
+                case BlockCompression::BC7:
+                    result = CreateOptionsBC7(&pOptions) == 0 && SetQualityBC7(pOptions, quality) == 0;
+                    break;
+                default:
+                    break;
+            }
+
+            if (!result && pOptions) {
+                DestroyOptions(compression, pOptions);
+                pOptions = nullptr;
+            }
+
+            return pOptions;
+        }
+    }
+
+    //!=================================================================================================================
+
+    TextureCompressor::~TextureCompressor() {
+        EVSafeFreeObject(m_pool);
+    }
+
+    TextureCompressor* TextureCompressor::Create(uint32_t threadsCount) {
+        if (threadsCount == 0) {
+            threadsCount = EVK_MAX(std::thread::hardware_concurrency(), 1u) - 1;
+        }
+
+        VK_GRAPH("TextureCompressor::Create() : creating texture compressor with " + std::to_string(threadsCount) + " threads...");
+
+        auto&& pCompressor = new TextureCompressor();
+        pCompressor->m_pool = ThreadPool::Create(threadsCount);
+
+        return pCompressor;
+    }
+
+    bool TextureCompressor::Compress(const MipChain& source, BlockCompression compression, MipChain& result) {
+        result.Clear();
+
+        if (!source.Valid()) {
+            VK_ERROR("TextureCompressor::Compress() : source is empty!");
+            return false;
+        }
+
+        if (source.GetFormat() != VK_FORMAT_R8G8B8A8_UNORM && source.GetFormat() != VK_FORMAT_R8G8B8A8_SRGB) {
+            VK_ERROR("TextureCompressor::Compress() : unsupported source format! Format: " + std::to_string(static_cast<int32_t>(source.GetFormat())));
+            return false;
+        }
+
+        const bool sRGB = source.GetFormat() == VK_FORMAT_R8G8B8A8_SRGB;
+
+        void* pOptions = TextureCompressorKernels::CreateOptions(compression, m_quality, sRGB);
+        if (!pOptions) {
+            VK_ERROR("TextureCompressor::Compress() : failed to create compression options!");
+            return false;
+        }
+
+        /// offsets are aligned as buffer offsets of copy regions
+        constexpr VkDeviceSize alignment = 16;
+
+        VkDeviceSize size = 0;
+        for (auto&& sourceLevel : source.GetLevels()) {
+            MipLevel level;
+            level.m_width  = sourceLevel.m_width;
+            level.m_height = sourceLevel.m_height;
+            level.m_offset = size;
+            level.m_size   = GetCompressedSize(compression, level.m_width, level.m_height);
+
+            size += (level.m_size + alignment - 1) / alignment * alignment;
+            result.m_levels.emplace_back(level);
+        }
+
+        result.m_format = GetFormat(compression, sRGB);
+        result.m_data.resize(size);
+
+        const uint32_t blockSize = GetBlockSize(compression);
+
+        std::atomic<bool> failed = false;
+        std::vector<std::function<void()>> jobs;
+
+        for (uint32_t i = 0; i < source.GetLevelsCount(); ++i) {
+            auto&& level = result.m_levels[i];
+
+            const uint8_t* pSrc = source.GetData(i);
+            uint8_t* pDst = result.m_data.data() + level.m_offset;
+
+            const uint32_t width = level.m_width;
+            const uint32_t height = level.m_height;
+            const uint32_t blocksX = (width + 3) / 4;
+            const uint32_t blocksY = (height + 3) / 4;
+
+            for (uint32_t blockY = 0; blockY < blocksY; ++blockY) {
+                jobs.emplace_back([=, &failed]() {
+                    uint8_t block[64];
+                    uint8_t* pRow = pDst + static_cast<VkDeviceSize>(blockY) * blocksX * blockSize;
+
+                    for (uint32_t blockX = 0; blockX < blocksX; ++blockX) {
+                        TextureCompressorKernels::GatherBlock(pSrc, width, height, blockX, blockY, block);
+
+                        if (!TextureCompressorKernels::CompressBlock(compression, block, pRow + blockX * blockSize, pOptions)) {
+                            failed = true;
+                            return;
+                        }
+                    }
+                });
+            }
+        }
+
+        m_pool->Execute(std::move(jobs));
+
+        TextureCompressorKernels::DestroyOptions(compression, pOptions);
+
+        if (failed) {
+            VK_ERROR("TextureCompressor::Compress() : failed to compress blocks!");
+            result.Clear();
+            return false;
+        }
+
+        return true;
+    }
+
+    void TextureCompressor::SetQuality(float quality) {
+        m_quality = EVK_MAX(0.f, EVK_MIN(quality, 1.f));
+    }
+
+    VkFormat TextureCompressor::GetFormat(BlockCompression compression, bool sRGB) {
+        switch (compression) {
+            case BlockCompression::BC1: return sRGB ? VK_FORMAT_BC1_RGBA_SRGB_BLOCK : VK_FORMAT_BC1_RGBA_UNORM_BLOCK;
+            case BlockCompression::BC2: return sRGB ? VK_FORMAT_BC2_SRGB_BLOCK : VK_FORMAT_BC2_UNORM_BLOCK;
+            case BlockCompression::BC3: return sRGB ? VK_FORMAT_BC3_SRGB_BLOCK : VK_FORMAT_BC3_UNORM_BLOCK;
+            case BlockCompression::BC4: return VK_FORMAT_BC4_UNORM_BLOCK;
+            case BlockCompression::BC5: return VK_FORMAT_BC5_UNORM_BLOCK;
+            case BlockCompression::BC7: return sRGB ? VK_FORMAT_BC7_SRGB_BLOCK : VK_FORMAT_BC7_UNORM_BLOCK;
+            default:
+                return VK_FORMAT_UNDEFINED;
+        }
+    }
+
+    uint32_t TextureCompressor::GetBlockSize(BlockCompression compression) {
+        switch (compression) {
+            case BlockCompression::BC1:
+            case BlockCompression::BC4:
+                return 8;
+            default:
+                return 16;
+        }
+    }
+
+    VkDeviceSize TextureCompressor::GetCompressedSize(BlockCompression compression, uint32_t width, uint32_t height) {
+        return static_cast<VkDeviceSize>((width + 3) / 4) * ((height + 3) / 4) * GetBlockSize(compression);
+    }
+}
@@ -0,0 +1,408 @@
+//
+// Created by Monika on 18.10.2026.
+//
+
+#include <EvoVulkan/Tools/TextureFile.h>
+#include <EvoVulkan/Tools/VulkanDebug.h>
+#include <EvoVulkan/Tools/VulkanHelper.h>
+#include <EvoVulkan/Tools/VulkanTools.h>
+#include <EvoVulkan/Tools/LZ4.h>
+
+namespace EvoVulkan::Tools {
+    static_assert(sizeof(TextureFile::Header) == 48, "header layout is a part of the file format!");
+    static_assert(sizeof(TextureFile::Chunk) == 16, "table layout is a part of the file format!");
+    static_assert(sizeof(MipLevel) == 24, "table layout is a part of the file format!");
+
+    static VkDeviceSize GetChunksOffset(const TextureFile::Header& header) {
+        return sizeof(TextureFile::Header) + static_cast<VkDeviceSize>(header.m_levels) * header.m_layers * sizeof(MipLevel);
+    }
+
+    /// offset of the payload, it's aligned as offsets of copy regions
+    static VkDeviceSize GetPayloadOffset(const TextureFile::Header& header) {
+        const VkDeviceSize tableEnd = GetChunksOffset(header) + static_cast<VkDeviceSize>(header.m_chunksCount) * sizeof(TextureFile::Chunk);
+        return (tableEnd + 15) / 16 * 16;
+    }
+
+    /// size of tightly packed level, zero if the format can't be stored in the container
+    static VkDeviceSize GetLevelSize(VkFormat format, uint32_t width, uint32_t height) {
+        const VkDeviceSize blocks = static_cast<VkDeviceSize>((width + 3) / 4) * ((height + 3) / 4);
+
+        switch (format) {
+            case VK_FORMAT_BC1_RGB_UNORM_BLOCK:
+            case VK_FORMAT_BC1_RGB_SRGB_BLOCK:
+            case VK_FORMAT_BC1_RGBA_UNORM_BLOCK:
+            case VK_FORMAT_BC1_RGBA_SRGB_BLOCK:
+            case VK_FORMAT_BC4_UNORM_BLOCK:
+            case VK_FORMAT_BC4_SNORM_BLOCK:
+                return blocks * 8;
+            case VK_FORMAT_BC2_UNORM_BLOCK:
+            case VK_FORMAT_BC2_SRGB_BLOCK:
+            case VK_FORMAT_BC3_UNORM_BLOCK:
+            case VK_FORMAT_BC3_SRGB_BLOCK:
+            case VK_FORMAT_BC5_UNORM_BLOCK:
+            case VK_FORMAT_BC5_SNORM_BLOCK:
+            case VK_FORMAT_BC6H_UFLOAT_BLOCK:
+            case VK_FORMAT_BC6H_SFLOAT_BLOCK:
+            case VK_FORMAT_BC7_UNORM_BLOCK:
+            case VK_FORMAT_BC7_SRGB_BLOCK:
+                return blocks * 16;
+            default:
+                return static_cast<VkDeviceSize>(width) * height * GetTexelSize(format);
+        }
+    }
+
+    TextureFile::~TextureFile() {
+        EVSafeFreeObject(m_file);
+
+        m_subresources = nullptr;
+        m_chunks = nullptr;
+        m_payload = nullptr;
+        m_storedSize = 0;
+        m_payloadSize = 0;
+    }
+
+    TextureFile* TextureFile::Open(const std::string& path) {
+        auto&& pMappedFile = MappedFile::Open(path);
+        if (!pMappedFile) {
+            VK_ERROR("TextureFile::Open() : failed to map file! \n\tPath: " + path);
+            return nullptr;
+        }
+
+        auto&& pFile = new TextureFile();
+        pFile->m_file = pMappedFile;
+        pFile->m_path = path;
+
+        if (pMappedFile->GetSize() < sizeof(Header)) {
+            VK_ERROR("TextureFile::Open() : file is too small! \n\tPath: " + path);
+            delete pFile;
+            return nullptr;
+        }
+
+        memcpy(&pFile->m_header, pMappedFile->GetData(), sizeof(Header));
+
+        auto&& header = pFile->m_header;
+
+        if (header.m_magic != Magic) {
+            VK_ERROR("TextureFile::Open() : file isn't a texture container! \n\tPath: " + path);
+            delete pFile;
+            return nullptr;
+        }
+
+        if (header.m_version != Version) {
+            VK_ERROR("TextureFile::Open() : unsupported version! \n\tPath: " + path + "\n\tVersion: " + std::to_string(header.m_version));
+            delete pFile;
+            return nullptr;
+        }
+
+        if (header.m_width == 0 || header.m_height == 0 || header.m_levels == 0 || header.m_layers == 0 ||
+            ((header.m_flags & CubeMap) && header.m_layers != 6)
+        ) {
+            VK_ERROR("TextureFile::Open() : invalid header! \n\tPath: " + path);
+            delete pFile;
+            return nullptr;
+        }
+
+        /// the format is passed to vulkan as is, so unknown values mustn't get further
+        if (GetLevelSize(static_cast<VkFormat>(header.m_format), 1, 1) == 0) {
+            VK_ERROR("TextureFile::Open() : unsupported format! \n\tPath: " + path + "\n\tFormat: " + std::to_string(header.m_format));
+            delete pFile;
+            return nullptr;
+        }
+
+        const uint32_t maxLevels = static_cast<uint32_t>(std::floor(std::log2(EVK_MAX(header.m_width, header.m_height)))) + 1;
+        if (header.m_levels > maxLevels) {
+            VK_ERROR("TextureFile::Open() : too many mip levels! \n\tPath: " + path + "\n\tLevels: " + std::to_string(header.m_levels));
+            delete pFile;
+            return nullptr;
+        }
+
+        const auto compression = static_cast<Supercompression>(header.m_compression);
+
+        if (compression == Supercompression::None ? header.m_chunksCount != 0 :
+            (compression != Supercompression::LZ4 || header.m_chunksCount == 0 || header.m_chunkSize == 0)
+        ) {
+            VK_ERROR("TextureFile::Open() : unsupported supercompression! \n\tPath: " + path +
+                "\n\tSupercompression: " + std::to_string(header.m_compression));
+            delete pFile;
+            return nullptr;
+        }
+
+        const VkDeviceSize payloadOffset = GetPayloadOffset(header);
+        if (payloadOffset > pMappedFile->GetSize()) {
+            VK_ERROR("TextureFile::Open() : tables are out of file! \n\tPath: " + path);
+            delete pFile;
+            return nullptr;
+        }
+
+        pFile->m_subresources = reinterpret_cast<const MipLevel*>(pMappedFile->GetData() + sizeof(Header));
+        pFile->m_payload = pMappedFile->GetData() + payloadOffset;
+        pFile->m_storedSize = pMappedFile->GetSize() - payloadOffset;
+        pFile->m_payloadSize = pFile->m_storedSize;
+
+        if (compression != Supercompression::None) {
+            pFile->m_chunks = reinterpret_cast<const Chunk*>(pMappedFile->GetData() + GetChunksOffset(header));
+            pFile->m_payloadSize = 0;
+
+            for (uint32_t i = 0; i < header.m_chunksCount; ++i) {
+                auto&& chunk = pFile->m_chunks[i];
+
+                /// every chunk except the last one is full
+                const bool validSize = i + 1 == header.m_chunksCount ? chunk.m_rawSize <= header.m_chunkSize : chunk.m_rawSize == header.m_chunkSize;
+
+                /// offset is compared with the rest of payload, so the sum can't overflow
+                if (!validSize || chunk.m_size > chunk.m_rawSize || chunk.m_size > pFile->m_storedSize ||
+                    chunk.m_offset > pFile->m_storedSize - chunk.m_size
+                ) {
+                    VK_ERROR("TextureFile::Open() : chunk is out of payload! \n\tPath: " + path + "\n\tIndex: " + std::to_string(i));
+                    delete pFile;
+                    return nullptr;
+                }
+
+                pFile->m_payloadSize += chunk.m_rawSize;
+            }
+        }
+
+        const auto format = static_cast<VkFormat>(header.m_format);
+
+        for (uint64_t i = 0; i < static_cast<uint64_t>(header.m_levels) * header.m_layers; ++i) {
+            auto&& subresource = pFile->m_subresources[i];
+
+            /// subresources are stored level by level, sizes are derived from the header, not trusted
+            const uint32_t level  = static_cast<uint32_t>(i / header.m_layers);
+            const uint32_t width  = EVK_MAX(header.m_width >> level, 1u);
+            const uint32_t height = EVK_MAX(header.m_height >> level, 1u);
+
+            if (subresource.m_width != width || subresource.m_height != height || subresource.m_size != GetLevelSize(format, width, height)) {
+                VK_ERROR("TextureFile::Open() : subresource doesn't match the header! \n\tPath: " + path + "\n\tIndex: " + std::to_string(i));
+                delete pFile;
+                return nullptr;
+            }
+
+            if (subresource.m_offset % 16 != 0 || subresource.m_size > pFile->m_payloadSize ||
+                subresource.m_offset > pFile->m_payloadSize - subresource.m_size
+            ) {
+                VK_ERROR("TextureFile::Open() : subresource is out of payload! \n\tPath: " + path + "\n\tIndex: " + std::to_string(i));
+                delete pFile;
+                return nullptr;
+            }
+        }
+
+        return pFile;
+    }
+
+    bool TextureFile::Save(const std::string& path, std::span<const MipChain* const> layers, bool cubeMap, Supercompression compression) {
+        if (layers.empty() || !layers.front() || !layers.front()->Valid()) {
+            VK_ERROR("TextureFile::Save() : nothing to save! \n\tPath: " + path);
+            return false;
+        }
+
+        auto&& base = *layers.front();
+
+        if (cubeMap && (layers.size() != 6 || base.GetWidth() != base.GetHeight())) {
+            VK_ERROR("TextureFile::Save() : cube map needs six square faces! \n\tPath: " + path);
+            return false;
+        }
+
+        for (auto&& pLayer : layers) {
+            if (!pLayer || pLayer->GetFormat() != base.GetFormat() || pLayer->GetWidth() != base.GetWidth() ||
+                pLayer->GetHeight() != base.GetHeight() || pLayer->GetLevelsCount() != base.GetLevelsCount()
+            ) {
+                VK_ERROR("TextureFile::Save() : layers have different format or size! \n\tPath: " + path);
+                return false;
+            }
+        }
+
+        Header header;
+        header.m_format = static_cast<uint32_t>(base.GetFormat());
+        header.m_width  = base.GetWidth();
+        header.m_height = base.GetHeight();
+        header.m_levels = base.GetLevelsCount();
+        header.m_layers = static_cast<uint32_t>(layers.size());
+        header.m_flags  = cubeMap ? CubeMap : None;
+
+        std::vector<MipLevel> subresources;
+        subresources.reserve(header.m_levels * header.m_layers);
+
+        VkDeviceSize payloadSize = 0;
+        for (uint32_t level = 0; level < header.m_levels; ++level) {
+            for (auto&& pLayer : layers) {
+                MipLevel subresource = pLayer->GetLevel(level);
+                subresource.m_offset = payloadSize;
+                payloadSize += (subresource.m_size + 15) / 16 * 16;
+                subresources.emplace_back(subresource);
+            }
+        }
+
+        /// unpacked payload, padding between subresources is zeroed
+        std::vector<uint8_t> payload(payloadSize, 0);
+        for (uint32_t level = 0, index = 0; level < header.m_levels; ++level) {
+            for (auto&& pLayer : layers) {
+                memcpy(payload.data() + subresources[index++].m_offset, pLayer->GetData(level), pLayer->GetLevel(level).m_size);
+            }
+        }
+
+        std::vector<Chunk> chunks;
+        std::vector<uint8_t> stored;
+
+        if (compression == Supercompression::LZ4) {
+            header.m_compression = static_cast<uint32_t>(compression);
+            header.m_chunkSize   = ChunkSize;
+            header.m_chunksCount = static_cast<uint32_t>((payloadSize + ChunkSize - 1) / ChunkSize);
+
+            std::vector<uint8_t> buffer(LZ4::GetBound(ChunkSize));
+
+            for (VkDeviceSize offset = 0; offset < payloadSize; offset += ChunkSize) {
+                Chunk chunk;
+                chunk.m_offset  = stored.size();
+                chunk.m_rawSize = static_cast<uint32_t>(EVK_MIN(payloadSize - offset, static_cast<VkDeviceSize>(ChunkSize)));
+
+                const uint8_t* pRaw = payload.data() + offset;
+                const uint64_t size = LZ4::Compress(pRaw, chunk.m_rawSize, buffer.data(), buffer.size());
+
+                /// incompressible chunks are stored as is
+                if (size == 0 || size >= chunk.m_rawSize) {
+                    chunk.m_size = chunk.m_rawSize;
+                    stored.insert(stored.end(), pRaw, pRaw + chunk.m_rawSize);
+                }
+                else {
+                    chunk.m_size = static_cast<uint32_t>(size);
+                    stored.insert(stored.end(), buffer.data(), buffer.data() + size);
+                }
+
+                chunks.emplace_back(chunk);
+            }
+        }
+        else if (compression != Supercompression::None) {
+            VK_ERROR("TextureFile::Save() : unsupported supercompression! \n\tPath: " + path);
+            return false;
+        }
+        else {
+            stored = std::move(payload);
+        }
+
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            VK_ERROR("TextureFile::Save() : failed to open file! \n\tPath: " + path);
+            return false;
+        }
+
+        const VkDeviceSize tablesEnd = GetChunksOffset(header) + chunks.size() * sizeof(Chunk);
+        const std::array<char, 16> padding = { };
+
+        file.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+        file.write(reinterpret_cast<const char*>(subresources.data()), static_cast<std::streamsize>(subresources.size() * sizeof(MipLevel)));
+        file.write(reinterpret_cast<const char*>(chunks.data()), static_cast<std::streamsize>(chunks.size() * sizeof(Chunk)));
+        file.write(padding.data(), static_cast<std::streamsize>(GetPayloadOffset(header) - tablesEnd));
+        file.write(reinterpret_cast<const char*>(stored.data()), static_cast<std::streamsize>(stored.size()));
+
+        if (!file.good()) {
+            VK_ERROR("TextureFile::Save() : failed to write file! \n\tPath: " + path);
+            return false;
+        }
+
+        VK_LOG("TextureFile::Save() : texture has been saved. \n\tPath: " + path +
+            "\n\tPayload size: " + std::to_string(payloadSize) + "\n\tStored size: " + std::to_string(stored.size()));
+
+        return true;
+    }
+
+    bool TextureFile::Save(const std::string& path, const MipChain& mipChain, Supercompression compression) {
+        const MipChain* pMipChain = &mipChain;
+        return Save(path, std::span<const MipChain* const>(&pMipChain, 1), false, compression);
+    }
+
+    bool TextureFile::Unpack(uint8_t* pDestination, ThreadPool* pPool) const {
+        if (!m_chunks) {
+            memcpy(pDestination, m_payload, m_payloadSize);
+            return true;
+        }
+
+        std::atomic<bool> failed = false;
+
+        auto&& unpackChunk = [this, pDestination, &failed](uint32_t index) {
+            auto&& chunk = m_chunks[index];
+
+            const uint8_t* pSrc = m_payload + chunk.m_offset;
+            uint8_t* pDst = pDestination + static_cast<VkDeviceSize>(index) * m_header.m_chunkSize;
+
+            if (chunk.m_size == chunk.m_rawSize) {
+                memcpy(pDst, pSrc, chunk.m_rawSize);
+            }
+            else if (!LZ4::Decompress(pSrc, chunk.m_size, pDst, chunk.m_rawSize)) {
+                failed = true;
+            }
+        };
+
+        if (pPool && m_header.m_chunksCount > 1) {
+            std::vector<std::function<void()>> jobs;
+            jobs.reserve(m_header.m_chunksCount);
+
+            for (uint32_t i = 0; i < m_header.m_chunksCount; ++i) {
+                jobs.emplace_back([&unpackChunk, i]() { unpackChunk(i); });
+            }
+
+            pPool->Execute(std::move(jobs));
+        }
+        else {
+            for (uint32_t i = 0; i < m_header.m_chunksCount && !failed; ++i) {
+                unpackChunk(i);
+            }
+        }
+
+        if (failed) {
+            VK_ERROR("TextureFile::Unpack() : failed to decompress payload!");
+            return false;
+        }
+
+        return true;
+    }
+
+    bool TextureFile::UnpackRange(uint8_t* pDestination, VkDeviceSize offset, VkDeviceSize size) const {
+        if (offset + size > m_payloadSize) {
+            VK_ERROR("TextureFile::UnpackRange() : range is out of payload!");
+            return false;
+        }
+
+        if (!m_chunks) {
+            memcpy(pDestination, m_payload + offset, size);
+            return true;
+        }
+
+        const VkDeviceSize chunkSize = m_header.m_chunkSize;
+        std::vector<uint8_t> chunkData;
+
+        for (VkDeviceSize index = offset / chunkSize; index * chunkSize < offset + size; ++index) {
+            auto&& chunk = m_chunks[index];
+
+            const VkDeviceSize chunkBegin = index * chunkSize;
+            const VkDeviceSize begin = EVK_MAX(offset, chunkBegin);
+            const VkDeviceSize end = EVK_MIN(offset + size, chunkBegin + chunk.m_rawSize);
+            const uint8_t* pSrc = m_payload + chunk.m_offset;
+
+            if (chunk.m_size == chunk.m_rawSize) {
+                memcpy(pDestination + (begin - offset), pSrc + (begin - chunkBegin), end - begin);
+                continue;
+            }
+
+            /// whole chunk is decompressed in place, bounds of the range are decompressed through temporary memory
+            if (begin == chunkBegin && end == chunkBegin + chunk.m_rawSize) {
+                if (!LZ4::Decompress(pSrc, chunk.m_size, pDestination + (begin - offset), chunk.m_rawSize)) {
+                    VK_ERROR("TextureFile::UnpackRange() : failed to decompress chunk! Index: " + std::to_string(index));
+                    return false;
+                }
+                continue;
+            }
+
+            chunkData.resize(chunk.m_rawSize);
+
+            if (!LZ4::Decompress(pSrc, chunk.m_size, chunkData.data(), chunk.m_rawSize)) {
+                VK_ERROR("TextureFile::UnpackRange() : failed to decompress chunk! Index: " + std::to_string(index));
+                return false;
+            }
+
+            memcpy(pDestination + (begin - offset), chunkData.data() + (begin - chunkBegin), end - begin);
+        }
+
+        return true;
+    }
+}
@@ -0,0 +1,172 @@
+//
+// Created by Monika on 18.10.2026.
+//
+
+#include <EvoVulkan/Tools/ThreadPool.h>
+
+namespace EvoVulkan::Tools {
+    ThreadPool::~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_condition.notify_all();
+
+        for (auto&& thread : m_threads) {
+            if (thread.joinable()) {
+                thread.join();
+            }
+        }
+        m_threads.clear();
+    }
+
+    ThreadPool* ThreadPool::Create(uint32_t threadsCount) {
+        if (threadsCount == 0) {
+            threadsCount = EVK_MAX(std::thread::hardware_concurrency(), 1u) - 1;
+        }
+
+        auto&& pPool = new ThreadPool();
+
+        for (uint32_t i = 0; i < threadsCount; ++i) {
+            pPool->m_threads.emplace_back(&ThreadPool::ThreadLoop, pPool);
+        }
+
+        return pPool;
+    }
+
+    struct ThreadPool::Group::State {
+        /// runs one job of the group, returns false if there are no jobs
+        bool RunJob() {
+            std::function<void()> job;
+
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (m_jobs.empty()) {
+                    return false;
+                }
+
+                job = std::move(m_jobs.front());
+                m_jobs.pop_front();
+            }
+
+            job();
+
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                --m_unfinished;
+            }
+            m_condition.notify_all();
+
+            return true;
+        }
+
+        std::deque<std::function<void()>> m_jobs;
+        uint64_t                          m_unfinished = 0;
+
+        std::mutex                        m_mutex;
+        std::condition_variable           m_condition;
+    };
+
+    ThreadPool::Group::Group(ThreadPool* pPool)
+        : m_state(std::make_shared<State>())
+        , m_pool(pPool)
+    { }
+
+    ThreadPool::Group::~Group() {
+        Wait();
+    }
+
+    void ThreadPool::Group::Run(std::function<void()>&& job) {
+        {
+            std::lock_guard<std::mutex> lock(m_state->m_mutex);
+            m_state->m_jobs.emplace_back(std::move(job));
+            ++m_state->m_unfinished;
+        }
+        /// the waiting thread runs jobs which are added by other jobs
+        m_state->m_condition.notify_all();
+
+        /// a worker takes any job of the group, the ticket is empty if the group has already run all of them
+        if (m_pool && !m_pool->m_threads.empty()) {
+            m_pool->Enqueue([state = m_state]() {
+                state->RunJob();
+            });
+        }
+    }
+
+    void ThreadPool::Group::Wait() {
+        while (true) {
+            while (m_state->RunJob()) {
+                /// the calling thread runs jobs of its group
+            }
+
+            std::unique_lock<std::mutex> lock(m_state->m_mutex);
+            m_state->m_condition.wait(lock, [this]() {
+                return m_state->m_unfinished == 0 || !m_state->m_jobs.empty();
+            });
+
+            if (m_state->m_unfinished == 0) {
+                return;
+            }
+        }
+    }
+
+    void ThreadPool::Execute(std::vector<std::function<void()>>&& jobs) {
+        if (jobs.empty()) {
+            return;
+        }
+
+        Group group(this);
+
+        for (auto&& job : jobs) {
+            group.Run(std::move(job));
+        }
+
+        group.Wait();
+    }
+
+    void ThreadPool::Enqueue(std::function<void()>&& job) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_jobs.emplace_back(std::move(job));
+        }
+        m_condition.notify_one();
+    }
+
+    void ThreadPool::ThreadLoop() {
+        while (true) {
+            std::function<void()> job;
+
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_condition.wait(lock, [this]() { return m_stop || !m_jobs.empty(); });
+
+                if (m_stop) {
+                    return;
+                }
+
+                job = std::move(m_jobs.front());
+                m_jobs.pop_front();
+            }
+
+            job();
+        }
+    }
+
+    bool ThreadPool::RunJob() {
+        std::function<void()> job;
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_jobs.empty()) {
+                return false;
+            }
+
+            job = std::move(m_jobs.front());
+            m_jobs.pop_front();
+        }
+
+        job();
+
+        return true;
+    }
+}
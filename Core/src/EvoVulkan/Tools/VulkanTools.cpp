@@ -43,6 +43,26 @@ namespace EvoVulkan::Tools {
         }
     }
 
+    VkPipelineLayout CreatePipelineLayout(const VkDevice& device, const std::vector<VkDescriptorSetLayout>& setLayouts, const std::vector<VkPushConstantRange>& pushConstants) {
+        for (auto&& pushConstant : pushConstants) {
+            if (pushConstant.stageFlags == 0) {
+                VK_ERROR("Tools::CreatePipelineLayout() : push constant does not contains any stages!");
+                return VK_NULL_HANDLE;
+            }
+        }
+
+        VkPipelineLayoutCreateInfo pPipelineLayoutCreateInfo = Initializers::PipelineLayoutCreateInfo(
+            setLayouts.data(), static_cast<uint32_t>(setLayouts.size()), pushConstants);
+
+        VkPipelineLayout pipelineLayout = VK_NULL_HANDLE;
+        if (vkCreatePipelineLayout(device, &pPipelineLayoutCreateInfo, nullptr, &pipelineLayout) != VK_SUCCESS) {
+            VK_ERROR("Tools::CreatePipelineLayout() : failed to create pipeline layout!");
+            return VK_NULL_HANDLE;
+        }
+
+        return pipelineLayout;
+    }
+
     VkPipelineLayout CreatePipelineLayout(const VkDevice& device, uint32_t setLayoutCount, VkDescriptorSetLayout descriptorSetLayout, const std::vector<VkPushConstantRange>& pushConstants) {
         for (auto&& pushConstant : pushConstants) {
             if (pushConstant.stageFlags == 0) {
@@ -146,9 +166,11 @@ namespace EvoVulkan::Tools {
 
         vkDestroySemaphore(device, sync->m_presentComplete, nullptr);
         vkDestroySemaphore(device, sync->m_renderComplete, nullptr);
+        vkDestroyFence(device, sync->m_inFlight, nullptr);
 
         sync->m_presentComplete = VK_NULL_HANDLE;
         sync->m_renderComplete  = VK_NULL_HANDLE;
+        sync->m_inFlight        = VK_NULL_HANDLE;
     }
 
     Types::Synchronization CreateSynchronization(const VkDevice& device) {
@@ -172,6 +194,14 @@ namespace EvoVulkan::Tools {
             VK_ERROR("Tools::CreateSynchronization() : failed to create render semaphore!");
             return {};
         }
+        // Create a fence used to know when the frame slot can be reused by CPU
+        // Created signaled, so the first wait on the slot will not block
+        VkFenceCreateInfo fenceCreateInfo = Initializers::FenceCreateInfo(VK_FENCE_CREATE_SIGNALED_BIT);
+        result = vkCreateFence(device, &fenceCreateInfo, nullptr, &sync.m_inFlight);
+        if (result != VK_SUCCESS) {
+            VK_ERROR("Tools::CreateSynchronization() : failed to create in-flight fence!");
+            return {};
+        }
 
         return sync;
     }
@@ -106,35 +106,71 @@ namespace EvoVulkan::Types {
         if (!m_isBegin) {
             return false;
         }
+
+        /// commands will be submitted with the whole batch
+        if (m_batched) {
+            return true;
+        }
+
         m_isBegin = false;
 
         vkEndCommandBuffer(m_buffer);
 
+        /// secondary buffers are executed by primary ones
+        if (IsSecondary()) {
+            return true;
+        }
+
         VkSubmitInfo submitInfo = {};
         submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
         submitInfo.commandBufferCount = 1;
         submitInfo.pCommandBuffers = &m_buffer;
 
-        auto result = vkQueueSubmit(m_device->GetQueues()->GetGraphicsQueue(), 1, &submitInfo, VK_NULL_HANDLE);
+        VkFence fence = VK_NULL_HANDLE;
+        VkFenceCreateInfo fenceCreateInfo = Tools::Initializers::FenceCreateInfo();
+        if (vkCreateFence(*m_device, &fenceCreateInfo, nullptr, &fence) != VK_SUCCESS) {
+            VK_ERROR("CmdBuffer::End() : failed to create fence!");
+            return false;
+        }
+
+        auto result = m_device->GetQueues()->Submit(m_device->GetQueues()->GetGraphicsQueue(), 1, &submitInfo, fence);
         if (result != VK_SUCCESS) {
             VK_ERROR("CmdBuffer::End() : failed to queue submit!");
+            vkDestroyFence(*m_device, fence, nullptr);
             return false;
         }
 
-        vkQueueWaitIdle(m_device->GetQueues()->GetGraphicsQueue());
+        /// wait only for this buffer, not for the whole queue
+        result = vkWaitForFences(*m_device, 1, &fence, VK_TRUE, UINT64_MAX);
+        vkDestroyFence(*m_device, fence, nullptr);
+
+        if (result != VK_SUCCESS) {
+            VK_ERROR("CmdBuffer::End() : failed to wait fence!");
+            return false;
+        }
 
         return true;
     }
 
     bool CmdBuffer::Begin(const VkCommandBufferUsageFlagBits &usage) {
+        return Begin(static_cast<VkCommandBufferUsageFlags>(usage), nullptr);
+    }
+
+    bool CmdBuffer::Begin(VkCommandBufferUsageFlags usage, const VkCommandBufferInheritanceInfo* pInheritance) {
         if (!IsReady()) {
             VK_ERROR("CmdBuffer::Begin() : command buffer isn't ready!");
             return false;
         }
 
+        /// begin would reset commands of other resources
+        if (m_batched && m_isBegin) {
+            return true;
+        }
+
         VkCommandBufferBeginInfo cmdBufInfo = {};
         cmdBufInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
         cmdBufInfo.flags = usage;
+        cmdBufInfo.pInheritanceInfo = pInheritance;
 
         auto result = vkBeginCommandBuffer(m_buffer, &cmdBufInfo);
         if (result != VK_SUCCESS) {
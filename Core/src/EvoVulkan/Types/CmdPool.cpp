@@ -25,6 +25,14 @@ bool EvoVulkan::Types::CmdPool::IsReady() const {
 }
 
 EvoVulkan::Types::CmdPool *EvoVulkan::Types::CmdPool::Create(EvoVulkan::Types::Device *device) {
+    return Create(device, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT, device->GetQueues()->GetGraphicsIndex());
+}
+
+EvoVulkan::Types::CmdPool *EvoVulkan::Types::CmdPool::Create(
+    EvoVulkan::Types::Device *device,
+    VkCommandPoolCreateFlags flags,
+    uint32_t queueFamilyIndex)
+{
     VK_GRAPH("CmdPool::Create() : creating vulkan command pool...");
 
     if (!device->IsReady()) {
@@ -36,8 +44,8 @@ EvoVulkan::Types::CmdPool *EvoVulkan::Types::CmdPool::Create(EvoVulkan::Types::D
 
     VkCommandPoolCreateInfo cmdPoolInfo = {};
     cmdPoolInfo.sType                   = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
-    cmdPoolInfo.queueFamilyIndex        = device->GetQueues()->GetGraphicsIndex();
-    cmdPoolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+    cmdPoolInfo.queueFamilyIndex        = queueFamilyIndex;
+    cmdPoolInfo.flags                   = flags;
 
     VkResult vkRes = vkCreateCommandPool(*device, &cmdPoolInfo, nullptr, &cmdPool);
     if (vkRes != VK_SUCCESS) {
@@ -48,9 +56,21 @@ EvoVulkan::Types::CmdPool *EvoVulkan::Types::CmdPool::Create(EvoVulkan::Types::D
 
     auto* commandPool = new CmdPool();
     {
-        commandPool->m_pool   = cmdPool;
-        commandPool->m_device = device;
+        commandPool->m_pool             = cmdPool;
+        commandPool->m_device           = device;
+        commandPool->m_queueFamilyIndex = queueFamilyIndex;
     }
 
     return commandPool;
 }
+
+bool EvoVulkan::Types::CmdPool::Reset() {
+    VkResult vkRes = vkResetCommandPool(*m_device, m_pool, 0);
+    if (vkRes != VK_SUCCESS) {
+        VK_ERROR("CmdPool::Reset() : failed to reset command pool! Reason: "
+            + Tools::Convert::result_to_description(vkRes));
+        return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,188 @@
+//
+// Created by Monika on 18.10.2026.
+//
+
+#include <EvoVulkan/Types/CmdRecorder.h>
+
+#include <EvoVulkan/Types/Device.h>
+#include <EvoVulkan/Tools/VulkanDebug.h>
+
+namespace EvoVulkan::Types {
+    CmdRecorder::~CmdRecorder() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_condition.notify_all();
+
+        for (auto&& thread : m_threads) {
+            if (thread.joinable()) {
+                thread.join();
+            }
+        }
+        m_threads.clear();
+
+        for (auto&& worker : m_workers) {
+            for (auto&& pBuffer : worker.m_buffers) {
+                delete pBuffer;
+            }
+            worker.m_buffers.clear();
+
+            EVSafeFreeObject(worker.m_pool);
+        }
+        m_workers.clear();
+
+        m_device = nullptr;
+    }
+
+    CmdRecorder* CmdRecorder::Create(Device* device, uint32_t threadsCount) {
+        VK_GRAPH("CmdRecorder::Create() : creating command recorder with " + std::to_string(threadsCount) + " threads...");
+
+        if (!device || !device->IsReady()) {
+            VK_ERROR("CmdRecorder::Create() : device isn't ready!");
+            return nullptr;
+        }
+
+        if (threadsCount == 0) {
+            VK_ERROR("CmdRecorder::Create() : threads count must be greater than zero!");
+            return nullptr;
+        }
+
+        auto&& pRecorder = new CmdRecorder();
+        pRecorder->m_device = device;
+        pRecorder->m_workers.resize(threadsCount);
+
+        for (auto&& worker : pRecorder->m_workers) {
+            /// buffers are re-recorded every time, so pool is reset as a whole
+            worker.m_pool = CmdPool::Create(device, VK_COMMAND_POOL_CREATE_TRANSIENT_BIT, device->GetQueues()->GetGraphicsIndex());
+            if (!worker.m_pool) {
+                VK_ERROR("CmdRecorder::Create() : failed to create command pool!");
+                delete pRecorder;
+                return nullptr;
+            }
+        }
+
+        /// the calling thread records the first range by itself
+        for (uint32_t i = 1; i < threadsCount; ++i) {
+            pRecorder->m_threads.emplace_back(&CmdRecorder::ThreadLoop, pRecorder, i);
+        }
+
+        return pRecorder;
+    }
+
+    bool CmdRecorder::Record(const VkCommandBufferInheritanceInfo& inheritance, uint32_t tasksCount, const Task& task) {
+        if (!task) {
+            VK_ERROR("CmdRecorder::Record() : task is invalid!");
+            return false;
+        }
+
+        m_task = &task;
+        m_inheritance = inheritance;
+        m_inheritance.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+        m_tasksCount = tasksCount;
+        m_recorded.assign(tasksCount, VK_NULL_HANDLE);
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_failed = false;
+            m_pending = static_cast<uint32_t>(m_threads.size());
+            ++m_generation;
+        }
+        m_condition.notify_all();
+
+        const bool result = RecordRange(0);
+
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_completeCondition.wait(lock, [this]() { return m_pending == 0; });
+
+            m_task = nullptr;
+
+            if (!result || m_failed) {
+                m_recorded.clear();
+                VK_ERROR("CmdRecorder::Record() : failed to record command buffers!");
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void CmdRecorder::Execute(VkCommandBuffer primary) const {
+        if (m_recorded.empty()) {
+            return;
+        }
+
+        vkCmdExecuteCommands(primary, static_cast<uint32_t>(m_recorded.size()), m_recorded.data());
+    }
+
+    void CmdRecorder::ThreadLoop(uint32_t index) {
+        uint64_t generation = 0;
+
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_condition.wait(lock, [this, generation]() { return m_stop || m_generation != generation; });
+
+                if (m_stop) {
+                    return;
+                }
+
+                generation = m_generation;
+            }
+
+            const bool result = RecordRange(index);
+
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_failed |= !result;
+                --m_pending;
+            }
+            m_completeCondition.notify_one();
+        }
+    }
+
+    bool CmdRecorder::RecordRange(uint32_t index) {
+        auto&& worker = m_workers[index];
+
+        const uint32_t threadsCount = static_cast<uint32_t>(m_workers.size());
+        const uint32_t chunk = (m_tasksCount + threadsCount - 1) / threadsCount;
+        const uint32_t begin = EVK_MIN(index * chunk, m_tasksCount);
+        const uint32_t end = EVK_MIN(begin + chunk, m_tasksCount);
+
+        if (!worker.m_pool->Reset()) {
+            return false;
+        }
+
+        while (worker.m_buffers.size() < end - begin) {
+            auto&& pBuffer = CmdBuffer::Create(m_device, worker.m_pool, VK_COMMAND_BUFFER_LEVEL_SECONDARY);
+            if (!pBuffer) {
+                VK_ERROR("CmdRecorder::RecordRange() : failed to create secondary command buffer!");
+                return false;
+            }
+            worker.m_buffers.emplace_back(pBuffer);
+        }
+
+        const VkCommandBufferUsageFlags usage = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT | VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+
+        for (uint32_t i = begin; i < end; ++i) {
+            auto&& pBuffer = worker.m_buffers[i - begin];
+
+            if (!pBuffer->Begin(usage, &m_inheritance)) {
+                return false;
+            }
+
+            const bool result = (*m_task)(*pBuffer, i);
+
+            pBuffer->End();
+
+            if (!result) {
+                return false;
+            }
+
+            m_recorded[i] = *pBuffer;
+        }
+
+        return true;
+    }
+}
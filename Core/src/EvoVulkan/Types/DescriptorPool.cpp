@@ -45,7 +45,9 @@ namespace EvoVulkan::Types {
         return nullptr;
     }
 
-    DescriptorPool* DescriptorPool::Create(VkDevice device, uint32_t maxSets, VkDescriptorSetLayout layout, const RequestTypes& requestTypes) {
+    DescriptorPool* DescriptorPool::Create(VkDevice device, uint32_t maxSets, VkDescriptorSetLayout layout, const RequestTypes& requestTypes,
+        const std::vector<VkDescriptorPoolSize>& setSizes)
+    {
         if (requestTypes.empty()) {
             VK_ERROR("DescriptorPool::Create() : request types is empty!");
             return nullptr;
@@ -58,10 +60,20 @@ namespace EvoVulkan::Types {
         pool->m_requestTypes = requestTypes;
 
         std::vector<VkDescriptorPoolSize> sizes = {};
-        sizes.reserve(pool->m_poolSizes.sizes.size());
-        for (auto&&[type, multiplier] : pool->m_poolSizes.sizes) {
-            if (Contains(requestTypes, type)) {
-                sizes.push_back({type, static_cast<uint32_t>(multiplier * maxSets)});
+
+        if (!setSizes.empty()) {
+            /// exactly what maxSets sets of the layout need
+            sizes.reserve(setSizes.size());
+            for (auto&& [type, count] : setSizes) {
+                sizes.push_back({type, count * maxSets});
+            }
+        }
+        else {
+            sizes.reserve(pool->m_poolSizes.sizes.size());
+            for (auto&&[type, multiplier] : pool->m_poolSizes.sizes) {
+                if (Contains(requestTypes, type)) {
+                    sizes.push_back({type, EVK_MAX(static_cast<uint32_t>(multiplier * maxSets), 1u)});
+                }
             }
         }
 
@@ -8,13 +8,76 @@
 #include <EvoVulkan/Tools/FileSystem.h>
 #include <EvoVulkan/Tools/VulkanConverter.h>
 #include <EvoVulkan/Tools/DeviceTools.h>
+#include <EvoVulkan/Tools/VulkanInitializers.h>
 
 namespace EvoVulkan::Types {
+#ifdef VK_EXT_host_image_copy
+    /// extensions which VK_EXT_host_image_copy depends on are core only since Vulkan 1.3
+    static const std::array<const char*, 3> HostImageCopyExtensions = {
+        VK_EXT_HOST_IMAGE_COPY_EXTENSION_NAME,
+        VK_KHR_COPY_COMMANDS_2_EXTENSION_NAME,
+        VK_KHR_FORMAT_FEATURE_FLAGS_2_EXTENSION_NAME
+    };
+
+    static bool IsHostImageCopyAvailable(VkPhysicalDevice physicalDevice) {
+        for (auto&& extension : HostImageCopyExtensions) {
+            if (!Tools::IsExtensionSupported(physicalDevice, extension)) {
+                return false;
+            }
+        }
+
+        VkPhysicalDeviceHostImageCopyFeaturesEXT hostImageCopyFeatures = {};
+        hostImageCopyFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_IMAGE_COPY_FEATURES_EXT;
+        hostImageCopyFeatures.pNext = nullptr;
+
+        VkPhysicalDeviceFeatures2 deviceFeatures2 = {};
+        deviceFeatures2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+        deviceFeatures2.pNext = &hostImageCopyFeatures;
+
+        vkGetPhysicalDeviceFeatures2(physicalDevice, &deviceFeatures2);
+
+        return hostImageCopyFeatures.hostImageCopy;
+    }
+#endif
+
+#ifdef VK_EXT_descriptor_buffer
+    /// synchronization2 is core only since Vulkan 1.3, buffer device address and descriptor indexing are core in 1.2
+    static const std::array<const char*, 2> DescriptorBufferExtensions = {
+        VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME,
+        VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME
+    };
+
+    static bool IsDescriptorBufferAvailable(VkPhysicalDevice physicalDevice) {
+        for (auto&& extension : DescriptorBufferExtensions) {
+            if (!Tools::IsExtensionSupported(physicalDevice, extension)) {
+                return false;
+            }
+        }
+
+        VkPhysicalDeviceDescriptorBufferFeaturesEXT descriptorBufferFeatures = {};
+        descriptorBufferFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_FEATURES_EXT;
+        descriptorBufferFeatures.pNext = nullptr;
+
+        VkPhysicalDeviceVulkan12Features vulkan12Features = {};
+        vulkan12Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+        vulkan12Features.pNext = &descriptorBufferFeatures;
+
+        VkPhysicalDeviceFeatures2 deviceFeatures2 = {};
+        deviceFeatures2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+        deviceFeatures2.pNext = &vulkan12Features;
+
+        vkGetPhysicalDeviceFeatures2(physicalDevice, &deviceFeatures2);
+
+        return descriptorBufferFeatures.descriptorBuffer && vulkan12Features.bufferDeviceAddress;
+    }
+#endif
+
     Device::Device(Instance *pInstance, FamilyQueues* pQueues, VkPhysicalDevice physicalDevice, VkDevice logicalDevice)
         : m_instance(pInstance)
         , m_familyQueues(pQueues)
         , m_physicalDevice(physicalDevice)
         , m_logicalDevice(logicalDevice)
+        , m_samplerCache(new SamplerCache(logicalDevice))
     { }
 
     Device::~Device() {
@@ -25,6 +88,19 @@ namespace EvoVulkan::Types {
             m_familyQueues = nullptr;
         }
 
+        /// samplers have to be destroyed before the device
+        EVSafeFreeObject(m_samplerCache);
+
+        if (!m_updateTemplates.empty()) {
+            VK_WARN("Device::Destroy() : not all descriptor set layouts have been destroyed! Templates: " + std::to_string(m_updateTemplates.size()));
+
+            for (auto&& [layout, updateTemplate] : m_updateTemplates) {
+                vkDestroyDescriptorUpdateTemplate(m_logicalDevice, updateTemplate, nullptr);
+            }
+
+            m_updateTemplates.clear();
+        }
+
         if (m_logicalDevice) {
             vkDestroyDevice(m_logicalDevice, nullptr);
             m_logicalDevice = VK_NULL_HANDLE;
@@ -73,6 +149,40 @@ namespace EvoVulkan::Types {
             info.extensions.emplace_back(VK_KHR_DEFERRED_HOST_OPERATIONS_EXTENSION_NAME);
         }
 
+        /// extensions could be already requested by the user
+        auto&& addExtension = [&info](const char* extension) {
+            auto&& pIt = std::find_if(info.extensions.begin(), info.extensions.end(), [extension](const char* name) {
+                return strcmp(name, extension) == 0;
+            });
+
+            if (pIt == info.extensions.end()) {
+                info.extensions.emplace_back(extension);
+            }
+        };
+
+    #ifdef VK_EXT_host_image_copy
+        /// feature is enabled by Tools::CreateLogicalDevice, textures are uploaded without staging buffers
+        if (IsHostImageCopyAvailable(physicalDevice)) {
+            for (auto&& extension : HostImageCopyExtensions) {
+                addExtension(extension);
+            }
+        }
+    #endif
+
+    #ifdef VK_EXT_descriptor_buffer
+        /// feature and buffer device address are enabled by Tools::CreateLogicalDevice
+        if (info.descriptorBuffer && IsDescriptorBufferAvailable(physicalDevice)) {
+            for (auto&& extension : DescriptorBufferExtensions) {
+                addExtension(extension);
+            }
+        }
+    #endif
+
+        /// Memory::Allocator reads real heap budgets by it, e.g. for eviction of streamed textures
+        if (Tools::IsExtensionSupported(physicalDevice, VK_EXT_MEMORY_BUDGET_EXTENSION_NAME)) {
+            addExtension(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
+        }
+
         if (physicalDevice == VK_NULL_HANDLE) {
             std::string msg = std::string();
 
@@ -159,6 +269,7 @@ namespace EvoVulkan::Types {
         auto&& pDevice = new Device(info.pInstance, pQueues, physicalDevice, logicalDevice);
 
         pDevice->CheckRayTracing(info.rayTracing);
+        pDevice->CheckDescriptorBuffer(info.descriptorBuffer);
 
         if (!pDevice->Initialize(info.enableSampleShading, info.multisampling, info.sampleCount)) {
             VK_ERROR("Device::Create() : failed to initialize device!");
@@ -178,18 +289,50 @@ namespace EvoVulkan::Types {
         /// Gather physical device memory properties
         vkGetPhysicalDeviceMemoryProperties(m_physicalDevice, &m_memoryProperties);
 
+        VkPhysicalDeviceVulkan12Features vulkan12Features = {};
+        vulkan12Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+        vulkan12Features.pNext = nullptr;
+
+        VkPhysicalDeviceVulkan12Properties vulkan12Properties = {};
+        vulkan12Properties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_PROPERTIES;
+        vulkan12Properties.pNext = nullptr;
+
+        VkPhysicalDeviceProperties2 deviceProperties = {};
+        deviceProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+        deviceProperties.pNext = &vulkan12Properties;
+
+        vkGetPhysicalDeviceProperties2(m_physicalDevice, &deviceProperties);
+
         VkPhysicalDeviceFeatures2 deviceFeatures = {};
         deviceFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
-        deviceFeatures.pNext = nullptr;
+        deviceFeatures.pNext = &vulkan12Features;
 
         vkGetPhysicalDeviceFeatures2(m_physicalDevice, &deviceFeatures);
         {
             m_enableSamplerAnisotropy = deviceFeatures.features.samplerAnisotropy;
+            /// enabled by Tools::CreateLogicalDevice when supported
+            m_timelineSemaphoreSupported = vulkan12Features.timelineSemaphore;
+
+            /// enabled by Tools::CreateLogicalDevice when supported
+            m_descriptorIndexingSupported =
+                vulkan12Features.runtimeDescriptorArray &&
+                vulkan12Features.descriptorBindingPartiallyBound &&
+                vulkan12Features.descriptorBindingSampledImageUpdateAfterBind &&
+                vulkan12Features.descriptorBindingUpdateUnusedWhilePending &&
+                vulkan12Features.shaderSampledImageArrayNonUniformIndexing;
+
+            m_maxBindlessTextures = EVK_MIN(
+                vulkan12Properties.maxDescriptorSetUpdateAfterBindSampledImages,
+                vulkan12Properties.maxPerStageDescriptorUpdateAfterBindSampledImages
+            );
+            m_maxBindlessTextures = EVK_MIN(m_maxBindlessTextures, vulkan12Properties.maxPerStageDescriptorUpdateAfterBindSamplers);
         }
 
         m_maxSamplerAnisotropy = Tools::GetMaxSamplerAnisotropy(m_physicalDevice);
         m_deviceName = Tools::GetDeviceName(m_physicalDevice);
 
+        CheckHostImageCopy();
+
         /// device->m_maxCountMSAASamples = calculate...
         if (m_multisampling) {
             VK_LOG("Device::Initialize() : multisampling is required...");
@@ -288,6 +431,149 @@ namespace EvoVulkan::Types {
         return cmdPool;
     }
 
+    VkDescriptorSetLayout Device::CreateDescriptorSetLayout(const std::vector<VkDescriptorSetLayoutBinding>& bindings) const {
+        auto&& descriptorSetLayoutCI = Tools::Initializers::DescriptorSetLayoutCreateInfo(bindings.data(), static_cast<uint32_t>(bindings.size()));
+
+    #ifdef VK_EXT_descriptor_buffer
+        /// sets of the layout are allocated by Core::DescriptorBuffer
+        if (m_descriptorBufferEnabled) {
+            descriptorSetLayoutCI.flags |= VK_DESCRIPTOR_SET_LAYOUT_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
+        }
+    #endif
+
+        VkDescriptorSetLayout layout = VK_NULL_HANDLE;
+        if (vkCreateDescriptorSetLayout(*this, &descriptorSetLayoutCI, nullptr, &layout) != VK_SUCCESS) {
+            VK_ERROR("Device::CreateDescriptorSetLayout() : failed to create descriptor set layout!");
+            return VK_NULL_HANDLE;
+        }
+
+        std::vector<VkDescriptorPoolSize> sizes;
+        std::vector<VkDescriptorUpdateTemplateEntry> entries;
+
+        for (auto&& binding : bindings) {
+            if (binding.descriptorCount == 0) {
+                continue;
+            }
+
+            entries.push_back({ binding.binding, 0, binding.descriptorCount, binding.descriptorType, 0, 0 });
+
+            auto&& pIt = std::find_if(sizes.begin(), sizes.end(), [&binding](const VkDescriptorPoolSize& size) {
+                return size.type == binding.descriptorType;
+            });
+
+            if (pIt == sizes.end()) {
+                sizes.push_back({ binding.descriptorType, binding.descriptorCount });
+            }
+            else {
+                pIt->descriptorCount += binding.descriptorCount;
+            }
+        }
+
+        /// packed data goes by binding numbers, not by order of the bindings
+        std::sort(entries.begin(), entries.end(), [](auto&& left, auto&& right) {
+            return left.dstBinding < right.dstBinding;
+        });
+
+        size_t offset = 0;
+
+        for (auto&& entry : entries) {
+            switch (entry.descriptorType) {
+                case VK_DESCRIPTOR_TYPE_SAMPLER:
+                case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+                case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+                case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+                case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+                    entry.stride = sizeof(VkDescriptorImageInfo);
+                    break;
+                case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+                case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+                    entry.stride = sizeof(VkBufferView);
+                    break;
+                case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR:
+                    entry.stride = sizeof(VkAccelerationStructureKHR);
+                    break;
+                default:
+                    entry.stride = sizeof(VkDescriptorBufferInfo);
+                    break;
+            }
+
+            /// all infos and handles have the same alignment, so members of the struct aren't padded
+            entry.offset = offset;
+            offset += static_cast<size_t>(entry.stride) * entry.descriptorCount;
+        }
+
+        std::lock_guard<std::mutex> lock(m_layoutsMutex);
+        m_layoutSizes[layout] = std::move(sizes);
+        m_layoutEntries[layout] = std::move(entries);
+
+        return layout;
+    }
+
+    void Device::DestroyDescriptorSetLayout(VkDescriptorSetLayout layout) const {
+        if (layout == VK_NULL_HANDLE) {
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_layoutsMutex);
+            m_layoutSizes.erase(layout);
+            m_layoutEntries.erase(layout);
+
+            if (auto&& pIt = m_updateTemplates.find(layout); pIt != m_updateTemplates.end()) {
+                vkDestroyDescriptorUpdateTemplate(*this, pIt->second, nullptr);
+                m_updateTemplates.erase(pIt);
+            }
+        }
+
+        vkDestroyDescriptorSetLayout(*this, layout, nullptr);
+    }
+
+    std::vector<VkDescriptorPoolSize> Device::GetDescriptorSetLayoutSizes(VkDescriptorSetLayout layout) const {
+        std::lock_guard<std::mutex> lock(m_layoutsMutex);
+
+        if (auto&& pIt = m_layoutSizes.find(layout); pIt != m_layoutSizes.end()) {
+            return pIt->second;
+        }
+
+        return { };
+    }
+
+    VkDescriptorUpdateTemplate Device::GetDescriptorUpdateTemplate(VkDescriptorSetLayout layout) const {
+        /// templates update descriptor sets, descriptor buffer has no them
+        if (m_descriptorBufferEnabled) {
+            return VK_NULL_HANDLE;
+        }
+
+        std::lock_guard<std::mutex> lock(m_layoutsMutex);
+
+        if (auto&& pIt = m_updateTemplates.find(layout); pIt != m_updateTemplates.end()) {
+            return pIt->second;
+        }
+
+        auto&& pEntriesIt = m_layoutEntries.find(layout);
+        if (pEntriesIt == m_layoutEntries.end() || pEntriesIt->second.empty()) {
+            VK_ERROR("Device::GetDescriptorUpdateTemplate() : layout wasn't created by the device or it's empty!");
+            return VK_NULL_HANDLE;
+        }
+
+        VkDescriptorUpdateTemplateCreateInfo templateCI = {};
+        templateCI.sType                      = VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO;
+        templateCI.descriptorUpdateEntryCount = static_cast<uint32_t>(pEntriesIt->second.size());
+        templateCI.pDescriptorUpdateEntries   = pEntriesIt->second.data();
+        templateCI.templateType               = VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET;
+        templateCI.descriptorSetLayout        = layout;
+
+        VkDescriptorUpdateTemplate updateTemplate = VK_NULL_HANDLE;
+        if (vkCreateDescriptorUpdateTemplate(*this, &templateCI, nullptr, &updateTemplate) != VK_SUCCESS) {
+            VK_ERROR("Device::GetDescriptorUpdateTemplate() : failed to create descriptor update template!");
+            return VK_NULL_HANDLE;
+        }
+
+        m_updateTemplates.emplace(layout, updateTemplate);
+
+        return updateTemplate;
+    }
+
     uint8_t Device::GetMSAASamplesCount() const {
         return Tools::Convert::SampleCountToInt(m_maxCountMSAASamples);
     }
@@ -342,6 +628,280 @@ namespace EvoVulkan::Types {
         }
     }
 
+    void Device::CheckDescriptorBuffer(bool isRequested) {
+    #ifdef VK_EXT_descriptor_buffer
+        if (!isRequested) {
+            return;
+        }
+
+        if (!IsDescriptorBufferAvailable(m_physicalDevice)) {
+            VK_LOG("Device::CheckDescriptorBuffer() : descriptor buffer was requested but is not supported!");
+            return;
+        }
+
+        m_getDescriptorSetLayoutSize = reinterpret_cast<PFN_vkGetDescriptorSetLayoutSizeEXT>(vkGetDeviceProcAddr(m_logicalDevice, "vkGetDescriptorSetLayoutSizeEXT"));
+        m_getDescriptorSetLayoutBindingOffset = reinterpret_cast<PFN_vkGetDescriptorSetLayoutBindingOffsetEXT>(vkGetDeviceProcAddr(m_logicalDevice, "vkGetDescriptorSetLayoutBindingOffsetEXT"));
+        m_getDescriptor = reinterpret_cast<PFN_vkGetDescriptorEXT>(vkGetDeviceProcAddr(m_logicalDevice, "vkGetDescriptorEXT"));
+        m_cmdBindDescriptorBuffers = reinterpret_cast<PFN_vkCmdBindDescriptorBuffersEXT>(vkGetDeviceProcAddr(m_logicalDevice, "vkCmdBindDescriptorBuffersEXT"));
+        m_cmdSetDescriptorBufferOffsets = reinterpret_cast<PFN_vkCmdSetDescriptorBufferOffsetsEXT>(vkGetDeviceProcAddr(m_logicalDevice, "vkCmdSetDescriptorBufferOffsetsEXT"));
+
+        if (!m_getDescriptorSetLayoutSize || !m_getDescriptorSetLayoutBindingOffset || !m_getDescriptor ||
+            !m_cmdBindDescriptorBuffers || !m_cmdSetDescriptorBufferOffsets)
+        {
+            VK_WARN("Device::CheckDescriptorBuffer() : failed to get descriptor buffer functions!");
+            return;
+        }
+
+        m_descriptorBufferProps.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_PROPERTIES_EXT;
+        m_descriptorBufferProps.pNext = nullptr;
+
+        VkPhysicalDeviceProperties2 devProps = {};
+        devProps.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+        devProps.pNext = &m_descriptorBufferProps;
+
+        vkGetPhysicalDeviceProperties2(m_physicalDevice, &devProps);
+
+        VK_LOG(std::string("Device::CheckDescriptorBuffer() : VkPhysicalDeviceDescriptorBufferPropertiesEXT: ")
+           .append("\n\tdescriptorBufferOffsetAlignment = " + std::to_string(m_descriptorBufferProps.descriptorBufferOffsetAlignment))
+           .append("\n\tmaxDescriptorBufferBindings = " + std::to_string(m_descriptorBufferProps.maxDescriptorBufferBindings))
+           .append("\n\tcombinedImageSamplerDescriptorSize = " + std::to_string(m_descriptorBufferProps.combinedImageSamplerDescriptorSize))
+           .append("\n\tuniformBufferDescriptorSize = " + std::to_string(m_descriptorBufferProps.uniformBufferDescriptorSize))
+           .append("\n\tstorageBufferDescriptorSize = " + std::to_string(m_descriptorBufferProps.storageBufferDescriptorSize))
+        );
+
+        m_descriptorBufferEnabled = true;
+    #else
+        if (isRequested) {
+            VK_LOG("Device::CheckDescriptorBuffer() : descriptor buffer is not supported by vulkan headers!");
+        }
+    #endif
+    }
+
+    void Device::CheckHostImageCopy() {
+    #ifdef VK_EXT_host_image_copy
+        if (!IsHostImageCopyAvailable(m_physicalDevice)) {
+            VK_LOG("Device::CheckHostImageCopy() : host image copy is not supported!");
+            return;
+        }
+
+        m_copyMemoryToImage = reinterpret_cast<PFN_vkCopyMemoryToImageEXT>(vkGetDeviceProcAddr(m_logicalDevice, "vkCopyMemoryToImageEXT"));
+        m_transitionImageLayout = reinterpret_cast<PFN_vkTransitionImageLayoutEXT>(vkGetDeviceProcAddr(m_logicalDevice, "vkTransitionImageLayoutEXT"));
+
+        if (!m_copyMemoryToImage || !m_transitionImageLayout) {
+            VK_WARN("Device::CheckHostImageCopy() : failed to get host image copy functions!");
+            return;
+        }
+
+        VkPhysicalDeviceHostImageCopyPropertiesEXT hostImageCopyProperties = {};
+        hostImageCopyProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_IMAGE_COPY_PROPERTIES_EXT;
+        hostImageCopyProperties.pNext = nullptr;
+
+        VkPhysicalDeviceProperties2 devProps = {};
+        devProps.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+        devProps.pNext = &hostImageCopyProperties;
+
+        /// the first call returns counts of layouts
+        vkGetPhysicalDeviceProperties2(m_physicalDevice, &devProps);
+
+        std::vector<VkImageLayout> srcLayouts(hostImageCopyProperties.copySrcLayoutCount);
+        std::vector<VkImageLayout> dstLayouts(hostImageCopyProperties.copyDstLayoutCount);
+
+        hostImageCopyProperties.pCopySrcLayouts = srcLayouts.data();
+        hostImageCopyProperties.pCopyDstLayouts = dstLayouts.data();
+
+        vkGetPhysicalDeviceProperties2(m_physicalDevice, &devProps);
+
+        m_hostImageLayouts = dstLayouts;
+        m_hostImageLayouts.insert(m_hostImageLayouts.end(), srcLayouts.begin(), srcLayouts.end());
+
+        /// copying straight into the sampled layout saves one transition
+        for (auto&& layout : { VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_GENERAL }) {
+            if (std::find(dstLayouts.begin(), dstLayouts.end(), layout) != dstLayouts.end()) {
+                m_hostCopyLayout = layout;
+                break;
+            }
+        }
+
+        /// textures are sampled in this layout, so host has to be able to transition them into it
+        m_hostImageCopySupported = m_hostCopyLayout != VK_IMAGE_LAYOUT_UNDEFINED &&
+            IsHostImageLayoutSupported(VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+
+        VK_LOG(std::string("Device::CheckHostImageCopy() : VkPhysicalDeviceHostImageCopyPropertiesEXT: ")
+           .append("\n\tcopySrcLayoutCount = " + std::to_string(srcLayouts.size()))
+           .append("\n\tcopyDstLayoutCount = " + std::to_string(dstLayouts.size()))
+           .append("\n\tidenticalMemoryTypeRequirements = ").append(hostImageCopyProperties.identicalMemoryTypeRequirements ? "True" : "False")
+           .append("\n\tcopy layout = " + std::to_string(static_cast<int32_t>(m_hostCopyLayout)))
+           .append("\n\tsupported = ").append(m_hostImageCopySupported ? "True" : "False")
+        );
+    #endif
+    }
+
+    bool Device::IsHostImageCopySupported(VkFormat format, VkImageUsageFlags usage, VkImageTiling tiling, VkImageCreateFlags flags) const {
+    #ifdef VK_EXT_host_image_copy
+        if (!m_hostImageCopySupported) {
+            return false;
+        }
+
+        VkFormatProperties3 formatProperties3 = {};
+        formatProperties3.sType = VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_3;
+        formatProperties3.pNext = nullptr;
+
+        VkFormatProperties2 formatProperties2 = {};
+        formatProperties2.sType = VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_2;
+        formatProperties2.pNext = &formatProperties3;
+
+        vkGetPhysicalDeviceFormatProperties2(m_physicalDevice, format, &formatProperties2);
+
+        const VkFormatFeatureFlags2 features = tiling == VK_IMAGE_TILING_LINEAR ?
+            formatProperties3.linearTilingFeatures : formatProperties3.optimalTilingFeatures;
+
+        if (!(features & VK_FORMAT_FEATURE_2_HOST_IMAGE_TRANSFER_BIT_EXT)) {
+            return false;
+        }
+
+        VkHostImageCopyDevicePerformanceQueryEXT performanceQuery = {};
+        performanceQuery.sType = VK_STRUCTURE_TYPE_HOST_IMAGE_COPY_DEVICE_PERFORMANCE_QUERY_EXT;
+        performanceQuery.pNext = nullptr;
+
+        VkImageFormatProperties2 imageFormatProperties = {};
+        imageFormatProperties.sType = VK_STRUCTURE_TYPE_IMAGE_FORMAT_PROPERTIES_2;
+        imageFormatProperties.pNext = &performanceQuery;
+
+        VkPhysicalDeviceImageFormatInfo2 imageFormatInfo = {};
+        imageFormatInfo.sType  = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_FORMAT_INFO_2;
+        imageFormatInfo.format = format;
+        imageFormatInfo.type   = VK_IMAGE_TYPE_2D;
+        imageFormatInfo.tiling = tiling;
+        imageFormatInfo.usage  = usage | VK_IMAGE_USAGE_HOST_TRANSFER_BIT_EXT;
+        imageFormatInfo.flags  = flags;
+
+        if (vkGetPhysicalDeviceImageFormatProperties2(m_physicalDevice, &imageFormatInfo, &imageFormatProperties) != VK_SUCCESS) {
+            return false;
+        }
+
+        /// otherwise e.g. compression of the image is disabled, and sampling costs more than the staging copy
+        return performanceQuery.optimalDeviceAccess;
+    #else
+        return false;
+    #endif
+    }
+
+    bool Device::IsHostImageLayoutSupported(VkImageLayout layout) const {
+        if (layout == VK_IMAGE_LAYOUT_UNDEFINED) {
+            return true;
+        }
+
+        return std::find(m_hostImageLayouts.begin(), m_hostImageLayouts.end(), layout) != m_hostImageLayouts.end();
+    }
+
+    bool Device::TransitionImageLayoutOnHost(VkImage image, VkImageLayout oldLayout, VkImageLayout newLayout, const VkImageSubresourceRange& range) const {
+    #ifdef VK_EXT_host_image_copy
+        if (!m_hostImageCopySupported) {
+            VK_ERROR("Device::TransitionImageLayoutOnHost() : host image copy is not supported!");
+            return false;
+        }
+
+        VkHostImageLayoutTransitionInfoEXT transitionInfo = {};
+        transitionInfo.sType            = VK_STRUCTURE_TYPE_HOST_IMAGE_LAYOUT_TRANSITION_INFO_EXT;
+        transitionInfo.image            = image;
+        transitionInfo.oldLayout        = oldLayout;
+        transitionInfo.newLayout        = newLayout;
+        transitionInfo.subresourceRange = range;
+
+        const auto result = m_transitionImageLayout(m_logicalDevice, 1, &transitionInfo);
+        if (result != VK_SUCCESS) {
+            VK_ERROR("Device::TransitionImageLayoutOnHost() : failed to transition image layout! "
+                "\n\tReason: " + Tools::Convert::result_to_string(result) +
+                "\n\tDescription: " + Tools::Convert::result_to_description(result)
+            );
+            return false;
+        }
+
+        return true;
+    #else
+        VK_ERROR("Device::TransitionImageLayoutOnHost() : host image copy is not supported by vulkan headers!");
+        return false;
+    #endif
+    }
+
+#ifdef VK_EXT_descriptor_buffer
+    VkDeviceSize Device::GetDescriptorSetLayoutSize(VkDescriptorSetLayout layout) const {
+        VkDeviceSize size = 0;
+        m_getDescriptorSetLayoutSize(m_logicalDevice, layout, &size);
+        return size;
+    }
+
+    VkDeviceSize Device::GetDescriptorSetLayoutBindingOffset(VkDescriptorSetLayout layout, uint32_t binding) const {
+        VkDeviceSize offset = 0;
+        m_getDescriptorSetLayoutBindingOffset(m_logicalDevice, layout, binding, &offset);
+        return offset;
+    }
+
+    void Device::GetDescriptor(const VkDescriptorGetInfoEXT& info, size_t size, void* pDescriptor) const {
+        m_getDescriptor(m_logicalDevice, &info, size, pDescriptor);
+    }
+
+    void Device::CmdBindDescriptorBuffers(VkCommandBuffer cmd, std::span<const VkDescriptorBufferBindingInfoEXT> buffers) const {
+        m_cmdBindDescriptorBuffers(cmd, static_cast<uint32_t>(buffers.size()), buffers.data());
+    }
+
+    void Device::CmdSetDescriptorBufferOffsets(VkCommandBuffer cmd, VkPipelineBindPoint bindPoint, VkPipelineLayout layout, uint32_t firstSet,
+        std::span<const uint32_t> bufferIndices, std::span<const VkDeviceSize> offsets) const
+    {
+        m_cmdSetDescriptorBufferOffsets(cmd, bindPoint, layout, firstSet, static_cast<uint32_t>(offsets.size()), bufferIndices.data(), offsets.data());
+    }
+#endif
+
+    bool Device::CopyMemoryToImage(VkImage image, VkImageLayout layout, std::span<const VkBufferImageCopy> regions, std::span<const void* const> data) const {
+    #ifdef VK_EXT_host_image_copy
+        if (!m_hostImageCopySupported) {
+            VK_ERROR("Device::CopyMemoryToImage() : host image copy is not supported!");
+            return false;
+        }
+
+        if (regions.size() != data.size()) {
+            VK_ERROR("Device::CopyMemoryToImage() : count of regions and memory pointers is different!");
+            return false;
+        }
+
+        std::vector<VkMemoryToImageCopyEXT> copies;
+        copies.reserve(regions.size());
+
+        for (size_t i = 0; i < regions.size(); ++i) {
+            VkMemoryToImageCopyEXT copy = {};
+            copy.sType             = VK_STRUCTURE_TYPE_MEMORY_TO_IMAGE_COPY_EXT;
+            copy.pHostPointer      = data[i];
+            copy.memoryRowLength   = regions[i].bufferRowLength;
+            copy.memoryImageHeight = regions[i].bufferImageHeight;
+            copy.imageSubresource  = regions[i].imageSubresource;
+            copy.imageOffset       = regions[i].imageOffset;
+            copy.imageExtent       = regions[i].imageExtent;
+            copies.emplace_back(copy);
+        }
+
+        VkCopyMemoryToImageInfoEXT copyInfo = {};
+        copyInfo.sType          = VK_STRUCTURE_TYPE_COPY_MEMORY_TO_IMAGE_INFO_EXT;
+        copyInfo.dstImage       = image;
+        copyInfo.dstImageLayout = layout;
+        copyInfo.regionCount    = static_cast<uint32_t>(copies.size());
+        copyInfo.pRegions       = copies.data();
+
+        const auto result = m_copyMemoryToImage(m_logicalDevice, &copyInfo);
+        if (result != VK_SUCCESS) {
+            VK_ERROR("Device::CopyMemoryToImage() : failed to copy memory to image! "
+                "\n\tReason: " + Tools::Convert::result_to_string(result) +
+                "\n\tDescription: " + Tools::Convert::result_to_description(result)
+            );
+            return false;
+        }
+
+        return true;
+    #else
+        VK_ERROR("Device::CopyMemoryToImage() : host image copy is not supported by vulkan headers!");
+        return false;
+    #endif
+    }
+
     VkFormat Device::GetDepthFormat() const {
         VkFormat depthFormat = VK_FORMAT_UNDEFINED;
 
@@ -376,11 +936,11 @@ namespace EvoVulkan::Types {
         }
 
         if (auto&& pQueue = m_familyQueues->GetGraphicsQueue()) {
-            vkQueueWaitIdle(pQueue);
+            m_familyQueues->WaitIdle(pQueue);
         }
 
         if (auto&& pQueue = m_familyQueues->GetPresentQueue()) {
-            vkQueueWaitIdle(pQueue);
+            m_familyQueues->WaitIdle(pQueue);
         }
     }
 }
@@ -86,9 +86,40 @@ namespace EvoVulkan::Types {
             return false;
         }
 
+        for (auto&& queue : { m_graphicsQueue, m_computeQueue, m_transferQueue, m_presentQueue }) {
+            if (queue != VK_NULL_HANDLE && !m_queueMutexes.contains(queue)) {
+                m_queueMutexes.emplace(queue, std::make_unique<std::mutex>());
+            }
+        }
+
         return true;
     }
 
+    std::mutex& FamilyQueues::GetQueueMutex(VkQueue queue) const {
+        if (auto&& pIt = m_queueMutexes.find(queue); pIt != m_queueMutexes.end()) {
+            return *pIt->second;
+        }
+
+        VK_ERROR("FamilyQueues::GetQueueMutex() : queue isn't owned by family queues!");
+
+        return *m_queueMutexes.at(m_graphicsQueue);
+    }
+
+    VkResult FamilyQueues::Submit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence) const {
+        std::lock_guard<std::mutex> lock(GetQueueMutex(queue));
+        return vkQueueSubmit(queue, submitCount, pSubmits, fence);
+    }
+
+    VkResult FamilyQueues::Present(VkQueue queue, const VkPresentInfoKHR& presentInfo) const {
+        std::lock_guard<std::mutex> lock(GetQueueMutex(queue));
+        return vkQueuePresentKHR(queue, &presentInfo);
+    }
+
+    VkResult FamilyQueues::WaitIdle(VkQueue queue) const {
+        std::lock_guard<std::mutex> lock(GetQueueMutex(queue));
+        return vkQueueWaitIdle(queue);
+    }
+
     bool FamilyQueues::FindIndices() {
         const VkQueueFlagBits askingFlags[3] = { VK_QUEUE_GRAPHICS_BIT, VK_QUEUE_COMPUTE_BIT, VK_QUEUE_TRANSFER_BIT };
         uint32_t queuesIndices[3] = { ~0u, ~0u, ~0u };
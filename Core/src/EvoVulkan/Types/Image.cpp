@@ -3,6 +3,7 @@
 //
 
 #include <EvoVulkan/Types/Image.h>
+#include <EvoVulkan/Types/UploadContext.h>
 
 namespace EvoVulkan::Types {
     ImageCreateInfo::ImageCreateInfo(
@@ -117,13 +118,19 @@ namespace EvoVulkan::Types {
     }
 
     bool Image::TransitionImageLayout(VkImageLayout layout, VkImageAspectFlags aspect, CmdBuffer *pBuffer) const {
-        auto&& copyCmd = pBuffer ? pBuffer : EvoVulkan::Types::CmdBuffer::BeginSingleTime(m_info.pAllocator->GetDevice(), m_info.pPool);
-
         if (m_info.format == VK_FORMAT_D32_SFLOAT_S8_UINT && aspect == VK_IMAGE_ASPECT_DEPTH_BIT) {
             VK_ERROR("Image::TransitionImageLayout() : can't transition depth image layout!");
             return false;
         }
 
+        /// without command buffer the transition would be waited anyway, so host does it without submission,
+        /// with command buffer it's recorded, because it's ordered with other commands of the buffer
+        if (!pBuffer && TransitionImageLayoutOnHost(layout, aspect)) {
+            return true;
+        }
+
+        auto&& copyCmd = pBuffer ? pBuffer : EvoVulkan::Types::CmdBuffer::BeginSingleTime(m_info.pAllocator->GetDevice(), m_info.pPool);
+
         const bool result = EvoVulkan::Tools::TransitionImageLayoutEx(
                 copyCmd, m_image, m_layout,layout,
                 m_info.mipLevels, aspect,m_info.arrayLayers, false
@@ -137,4 +144,45 @@ namespace EvoVulkan::Types {
 
         return result;
     }
+
+    bool Image::TransitionImageLayoutOnHost(EVK_UNUSED VkImageLayout layout, EVK_UNUSED VkImageAspectFlags aspect) const {
+    #ifdef VK_EXT_host_image_copy
+        if (!(m_info.usage & VK_IMAGE_USAGE_HOST_TRANSFER_BIT_EXT)) {
+            return false;
+        }
+
+        auto&& pDevice = m_info.pAllocator->GetDevice();
+        if (!pDevice->IsHostImageLayoutSupported(m_layout) || !pDevice->IsHostImageLayoutSupported(layout)) {
+            return false;
+        }
+
+        VkImageSubresourceRange range = { };
+        range.aspectMask     = aspect;
+        range.baseMipLevel   = 0;
+        range.levelCount     = m_info.mipLevels;
+        range.baseArrayLayer = 0;
+        range.layerCount     = m_info.arrayLayers;
+
+        if (!pDevice->TransitionImageLayoutOnHost(m_image, m_layout, layout, range)) {
+            return false;
+        }
+
+        m_layout = layout;
+
+        return true;
+    #else
+        return false;
+    #endif
+    }
+
+    void Image::TransferOwnership(UploadContext* pContext) const {
+        VkImageSubresourceRange range = { };
+        range.aspectMask     = m_info.aspect;
+        range.baseMipLevel   = 0;
+        range.levelCount     = m_info.mipLevels;
+        range.baseArrayLayer = 0;
+        range.layerCount     = m_info.arrayLayers;
+
+        pContext->TransferOwnership(m_image, m_layout, range);
+    }
 }
\ No newline at end of file
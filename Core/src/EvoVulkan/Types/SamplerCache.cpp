@@ -0,0 +1,123 @@
+//
+// Created by Monika on 18.10.2026.
+//
+
+#include <EvoVulkan/Types/SamplerCache.h>
+#include <EvoVulkan/Tools/VulkanDebug.h>
+
+namespace EvoVulkan::Types {
+    size_t SamplerCache::KeyHash::operator()(const Key& key) const noexcept {
+        /// FNV-1a
+        uint64_t hash = 14695981039346656037ull;
+
+        for (auto&& value : key) {
+            hash ^= value;
+            hash *= 1099511628211ull;
+        }
+
+        return static_cast<size_t>(hash);
+    }
+
+    SamplerCache::~SamplerCache() {
+        if (!m_keys.empty()) {
+            VK_WARN("SamplerCache::~SamplerCache() : samplers weren't released! Count: " + std::to_string(m_keys.size()));
+        }
+
+        for (auto&& [key, entry] : m_entries) {
+            vkDestroySampler(m_device, entry.m_sampler, nullptr);
+        }
+
+        m_entries.clear();
+        m_keys.clear();
+    }
+
+    SamplerCache::Key SamplerCache::MakeKey(const VkSamplerCreateInfo& createInfo) {
+        const auto bits = [](float_t value) -> uint32_t {
+            uint32_t result;
+            std::memcpy(&result, &value, sizeof(result));
+            return result;
+        };
+
+        return Key {
+            static_cast<uint32_t>(createInfo.flags),
+            static_cast<uint32_t>(createInfo.magFilter),
+            static_cast<uint32_t>(createInfo.minFilter),
+            static_cast<uint32_t>(createInfo.mipmapMode),
+            static_cast<uint32_t>(createInfo.addressModeU),
+            static_cast<uint32_t>(createInfo.addressModeV),
+            static_cast<uint32_t>(createInfo.addressModeW),
+            bits(createInfo.mipLodBias),
+            static_cast<uint32_t>(createInfo.anisotropyEnable),
+            bits(createInfo.maxAnisotropy),
+            static_cast<uint32_t>(createInfo.compareEnable),
+            static_cast<uint32_t>(createInfo.compareOp),
+            bits(createInfo.minLod),
+            bits(createInfo.maxLod),
+            static_cast<uint32_t>(createInfo.borderColor),
+            static_cast<uint32_t>(createInfo.unnormalizedCoordinates)
+        };
+    }
+
+    VkSampler SamplerCache::Acquire(const VkSamplerCreateInfo& createInfo) {
+        VkSampler sampler = VK_NULL_HANDLE;
+
+        /// chained structures aren't known by the cache, so the sampler can't be shared
+        if (createInfo.pNext) {
+            if (vkCreateSampler(m_device, &createInfo, nullptr, &sampler) != VK_SUCCESS) {
+                VK_ERROR("SamplerCache::Acquire() : failed to create vulkan sampler!");
+                return VK_NULL_HANDLE;
+            }
+
+            return sampler;
+        }
+
+        const Key key = MakeKey(createInfo);
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (auto&& pIt = m_entries.find(key); pIt != m_entries.end()) {
+            ++pIt->second.m_references;
+            return pIt->second.m_sampler;
+        }
+
+        if (vkCreateSampler(m_device, &createInfo, nullptr, &sampler) != VK_SUCCESS) {
+            VK_ERROR("SamplerCache::Acquire() : failed to create vulkan sampler!");
+            return VK_NULL_HANDLE;
+        }
+
+        m_entries.emplace(key, Entry { sampler, 1 });
+        m_keys.emplace(sampler, key);
+
+        return sampler;
+    }
+
+    void SamplerCache::Release(VkSampler sampler) {
+        if (sampler == VK_NULL_HANDLE) {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        auto&& pKeyIt = m_keys.find(sampler);
+        if (pKeyIt == m_keys.end()) {
+            /// sampler with pNext chain, it isn't shared
+            vkDestroySampler(m_device, sampler, nullptr);
+            return;
+        }
+
+        auto&& pIt = m_entries.find(pKeyIt->second);
+        if (--pIt->second.m_references > 0) {
+            return;
+        }
+
+        vkDestroySampler(m_device, sampler, nullptr);
+
+        m_entries.erase(pIt);
+        m_keys.erase(pKeyIt);
+    }
+
+    size_t SamplerCache::GetSamplersCount() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_entries.size();
+    }
+}
@@ -18,6 +18,7 @@ EvoVulkan::Types::Swapchain::~Swapchain() {
     VK_LOG("Swapchain::Destroy() : destroy vulkan swapchain...");
 
     DestroyBuffers();
+    DestroyRetired();
 
     if (m_swapchain) {
         vkDestroySwapchainKHR(*m_device, m_swapchain, nullptr);
@@ -85,18 +86,24 @@ bool EvoVulkan::Types::Swapchain::ReSetup(uint32_t width, uint32_t height, uint3
         return false;
     }
 
-    //! TODO: see VS example
-    if (surfCaps.currentExtent.width != width || surfCaps.currentExtent.height != height) {
-        VK_ASSERT2(false, "Swapchain::ReSize() : swap chain size different! "
-                              "\n\tWidth  surface: " + std::to_string(surfCaps.currentExtent.width) +
-                              "\n\tHeight surface: " + std::to_string(surfCaps.currentExtent.height) +
-                              "\n\tWidth   window: " + std::to_string(width) +
-                              "\n\tHeight  window: " + std::to_string(height));
-        return false;
-    }
+    /// surface defines its own extent (window was resized or out of date), window sizes can come later
+    if (surfCaps.currentExtent.width != UINT32_MAX) {
+        if (surfCaps.currentExtent.width != width || surfCaps.currentExtent.height != height) {
+            VK_LOG("Swapchain::ReSetup() : window size differs from the surface, surface extent is used!"
+                   "\n\tWidth  surface: " + std::to_string(surfCaps.currentExtent.width) +
+                   "\n\tHeight surface: " + std::to_string(surfCaps.currentExtent.height) +
+                   "\n\tWidth   window: " + std::to_string(width) +
+                   "\n\tHeight  window: " + std::to_string(height));
+        }
 
-    m_surfaceWidth  = surfCaps.currentExtent.width;
-    m_surfaceHeight = surfCaps.currentExtent.height;
+        m_surfaceWidth  = surfCaps.currentExtent.width;
+        m_surfaceHeight = surfCaps.currentExtent.height;
+    }
+    else {
+        /// extent is determined by the swapchain (e.g. wayland), so the window size is used
+        m_surfaceWidth  = EVK_CLAMP(width, surfCaps.maxImageExtent.width, surfCaps.minImageExtent.width);
+        m_surfaceHeight = EVK_CLAMP(height, surfCaps.maxImageExtent.height, surfCaps.minImageExtent.height);
+    }
 
     if (m_surfaceWidth == 0 || m_surfaceHeight == 0) {
         VK_ERROR("Swapchain::ReSetup() : surface size contains zero!");
@@ -172,12 +179,15 @@ bool EvoVulkan::Types::Swapchain::ReSetup(uint32_t width, uint32_t height, uint3
         return false;
     }
 
-    // If we just re-created an existing swapchain, we should destroy the old
-    // swapchain at this point.
+    // If we just re-created an existing swapchain, the old one is retired.
+    // Frames in flight can still use its images, so it will be destroyed
+    // by DestroyRetired() when these frames are complete.
     //! Note: destroying the swapchain also cleans up all its associated
     //! presentable images once the platform is done with them.
-    if (oldSwapchain != VK_NULL_HANDLE)
-        vkDestroySwapchainKHR(*m_device, oldSwapchain, nullptr);
+    if (oldSwapchain != VK_NULL_HANDLE) {
+        m_retired.emplace_back(RetiredSwapchain { oldSwapchain, m_buffers, m_countImages });
+        m_buffers = nullptr;
+    }
 
     //!=================================================================================================================
 
@@ -269,6 +279,32 @@ void EvoVulkan::Types::Swapchain::DestroyBuffers() {
     }
 }
 
+void EvoVulkan::Types::Swapchain::DestroyRetired(uint32_t count) {
+    if (m_retired.empty()) {
+        return;
+    }
+
+    count = EVK_MIN(count, static_cast<uint32_t>(m_retired.size()));
+
+    VK_LOG("Swapchain::DestroyRetired() : destroy " + std::to_string(count) + " retired swapchains...");
+
+    /// swapchains are retired in order, so the oldest ones are complete first
+    for (uint32_t index = 0; index < count; ++index) {
+        auto&& retired = m_retired[index];
+
+        if (retired.m_buffers) {
+            for (uint32_t i = 0; i < retired.m_countImages; ++i) {
+                vkDestroyImageView(*m_device, retired.m_buffers[i].m_view, nullptr);
+            }
+            free(retired.m_buffers);
+        }
+
+        vkDestroySwapchainKHR(*m_device, retired.m_swapchain, nullptr);
+    }
+
+    m_retired.erase(m_retired.begin(), m_retired.begin() + count);
+}
+
 bool EvoVulkan::Types::Swapchain::CreateImages() {
     VkResult result = vkGetSwapchainImagesKHR(*m_device, m_swapchain, &m_countImages, NULL);
     if (result != VK_SUCCESS) {
@@ -379,7 +415,7 @@ VkResult EvoVulkan::Types::Swapchain::QueuePresent(VkQueue queue, uint32_t image
     }
 
     try {
-        return vkQueuePresentKHR(queue, &presentInfo);
+        return m_device->GetQueues()->Present(queue, presentInfo);
     }
     catch (const std::exception& ex) {
         VK_ERROR("Swapchain::QueuePresent() : an exception has been occurred! \n\tMessage: " + std::string(ex.what()));
@@ -7,29 +7,98 @@
 #include <EvoVulkan/Types/VmaBuffer.h>
 #include <EvoVulkan/Types/Device.h>
 #include <EvoVulkan/DescriptorManager.h>
+#include <EvoVulkan/DescriptorWriter.h>
 #include <EvoVulkan/Memory/Allocator.h>
+#include <EvoVulkan/Complexes/MipGenerator.h>
+#include <EvoVulkan/Complexes/BlockEncoder.h>
+#include <EvoVulkan/Complexes/TextureStreamer.h>
 
-uint64_t GetDataSize(uint32_t w, uint32_t h, uint8_t level) {
+uint64_t GetDataSize(uint32_t w, uint32_t h, uint8_t level, uint32_t texelSize) {
     uint64_t dataSize = 0;
     for (uint8_t i = 0; i < level; i++) {
-        dataSize += w * h * 4 * 6;
+        dataSize += static_cast<uint64_t>(w) * h * texelSize * 6;
         w /= 2;
         h /= 2;
     }
     return dataSize;
 }
 
-uint64_t GetImageSize(uint32_t w, uint32_t h, uint8_t level, uint8_t face) {
+/// subresources are ordered by level, then by layer, offsets are relative to the first one
+static std::vector<VkBufferImageCopy> GetCopyRegions(const EvoVulkan::Tools::MipLevel* pSubresources, uint32_t levels, uint32_t layers) {
+    std::vector<VkBufferImageCopy> bufferCopyRegions;
+    bufferCopyRegions.reserve(levels * layers);
+
+    for (uint32_t level = 0; level < levels; ++level) {
+        for (uint32_t layer = 0; layer < layers; ++layer) {
+            auto&& subresource = pSubresources[level * layers + layer];
+
+            VkBufferImageCopy bufferCopyRegion = {};
+            bufferCopyRegion.imageSubresource.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
+            bufferCopyRegion.imageSubresource.mipLevel       = level;
+            bufferCopyRegion.imageSubresource.baseArrayLayer = layer;
+            bufferCopyRegion.imageSubresource.layerCount     = 1;
+            bufferCopyRegion.imageExtent.width               = subresource.m_width;
+            bufferCopyRegion.imageExtent.height              = subresource.m_height;
+            bufferCopyRegion.imageExtent.depth               = 1;
+            bufferCopyRegion.bufferOffset                    = subresource.m_offset;
+            bufferCopyRegions.emplace_back(bufferCopyRegion);
+        }
+    }
+
+    return bufferCopyRegions;
+}
+
+static bool IsSupportedByMipGenerator(VkFormat format, EvoVulkan::Types::UploadContext* pUploadContext) {
+    return pUploadContext && pUploadContext->GetMipGenerator() && pUploadContext->GetMipGenerator()->IsSupported(format);
+}
+
+/// images written by host, transfer source is kept for Texture::GetPixel()
+static constexpr VkImageUsageFlags HostCopyUsage = VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+
+/// with VK_EXT_host_image_copy all levels are copied from host memory, there is no staging buffer and submission
+static bool IsSupportedByHostCopy(EvoVulkan::Types::Device* pDevice, VkFormat format, bool cubeMap, bool cpuUsage) {
+    return pDevice->IsHostImageCopySupported(
+        format, HostCopyUsage,
+        cpuUsage ? VK_IMAGE_TILING_LINEAR : VK_IMAGE_TILING_OPTIMAL,
+        cubeMap ? VK_IMAGE_CREATE_CUBE_COMPATIBLE_BIT : 0
+    );
+}
+
+/// host memory of each copy region, buffer offsets are relative to pData
+static std::vector<const void*> GetHostPointers(const uint8_t* pData, const std::vector<VkBufferImageCopy>& regions) {
+    std::vector<const void*> pointers;
+    pointers.reserve(regions.size());
+
+    for (auto&& region : regions) {
+        pointers.emplace_back(pData + region.bufferOffset);
+    }
+
+    return pointers;
+}
+
+uint64_t GetImageSize(uint32_t w, uint32_t h, uint8_t level, uint8_t face, uint32_t texelSize) {
     for (uint8_t i = 0; i < level; i++) {
         w /= 2;
         h /= 2;
     }
 
-    return (w * h * 4) * face;
+    return (static_cast<uint64_t>(w) * h * texelSize) * face;
 }
 
 EvoVulkan::Types::Texture::~Texture() {
-    if (m_descriptorManager && (m_descriptorSet != VK_NULL_HANDLE)) {
+    if (m_streamer) {
+        m_streamer->Remove(this);
+    }
+
+    EVSafeFreeObject(m_streamSource);
+
+    /// index is reused after frames in flight
+    if (m_descriptorManager && m_descriptorManager->GetBindlessTextures() && m_bindlessIndex != Core::BindlessTextures::InvalidIndex) {
+        m_descriptorManager->GetBindlessTextures()->Remove(m_bindlessIndex);
+        m_bindlessIndex = Core::BindlessTextures::InvalidIndex;
+    }
+
+    if (m_descriptorManager && m_descriptorSet.Valid()) {
         m_descriptorManager->FreeDescriptorSet(&m_descriptorSet);
         m_descriptorManager = nullptr;
     }
@@ -38,8 +107,13 @@ EvoVulkan::Types::Texture::~Texture() {
         return;
     }
 
+    /// image can still be used by the upload batch
+    if (m_uploadContext && m_uploadTicket != 0) {
+        m_uploadContext->Wait(m_uploadTicket);
+    }
+
     if (m_sampler != VK_NULL_HANDLE) {
-        vkDestroySampler(*m_device, m_sampler, nullptr);
+        m_device->GetSamplerCache()->Release(m_sampler);
         m_sampler = VK_NULL_HANDLE;
     }
 
@@ -51,6 +125,14 @@ EvoVulkan::Types::Texture::~Texture() {
     if (m_image.Valid()) {
         m_allocator->FreeImage(m_image);
     }
+
+    /// EndLoad() wasn't called
+    if (m_staging.Valid() && !m_stagingBuffer && m_uploadContext) {
+        m_uploadContext->ReleaseStaging(m_staging);
+    }
+    m_staging = Memory::StagingRegion();
+
+    EVSafeFreeObject(m_stagingBuffer);
 }
 
 EvoVulkan::Types::Texture* EvoVulkan::Types::Texture::LoadCubeMap(
@@ -62,13 +144,20 @@ EvoVulkan::Types::Texture* EvoVulkan::Types::Texture::LoadCubeMap(
     int32_t height,
     const std::array<const uint8_t*, 6> &sides,
     uint32_t mipLevels,
-    bool cpuUsage)
+    bool cpuUsage,
+    UploadContext* pUploadContext)
 {
     if (width <= 0 || height <= 0) {
         VK_ERROR("Texture::LoadCubeMap() : incorrect texture size!");
         return nullptr;
     }
 
+    const uint32_t texelSize = Tools::GetTexelSize(format);
+    if (texelSize == 0) {
+        VK_ERROR("Texture::LoadCubeMap() : unsupported format! Format: " + std::to_string(static_cast<int32_t>(format)));
+        return nullptr;
+    }
+
     if (mipLevels == 0) {
         mipLevels = std::floor(std::log2(EVK_MAX(width, height))) + 1;
     }
@@ -90,20 +179,64 @@ EvoVulkan::Types::Texture* EvoVulkan::Types::Texture::LoadCubeMap(
         texture->m_filter            = VkFilter::VK_FILTER_LINEAR;
         texture->m_cubeMap           = true;
         texture->m_cpuUsage          = cpuUsage;
+        texture->m_uploadContext     = pUploadContext;
+    }
+
+    /// sides contain only the first level, so only cube map without mips is written by host
+    if (mipLevels == 1 && IsSupportedByHostCopy(device, format, true, cpuUsage)) {
+        std::vector<VkBufferImageCopy> regions;
+
+        for (uint32_t face = 0; face < 6; ++face) {
+            VkBufferImageCopy bufferCopyRegion = {};
+            bufferCopyRegion.imageSubresource.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
+            bufferCopyRegion.imageSubresource.mipLevel       = 0;
+            bufferCopyRegion.imageSubresource.baseArrayLayer = face;
+            bufferCopyRegion.imageSubresource.layerCount     = 1;
+            bufferCopyRegion.imageExtent.width               = width;
+            bufferCopyRegion.imageExtent.height              = height;
+            bufferCopyRegion.imageExtent.depth               = 1;
+            regions.emplace_back(bufferCopyRegion);
+        }
+
+        const std::vector<const void*> data(sides.begin(), sides.end());
+
+        if (!texture->CreateOnHost(regions, data, 6, VK_SAMPLER_ADDRESS_MODE_REPEAT)) {
+            VK_ERROR("Texture::LoadCubeMap() : failed to create on host!");
+            delete texture;
+            return nullptr;
+        }
+
+        return texture;
     }
 
-    const VkDeviceSize imageSize = width * height * 4 * 6;
+    const VkDeviceSize layerSize = static_cast<VkDeviceSize>(width) * height * texelSize;
+    /// copy regions below read every mip level of every face
+    const VkDeviceSize stagingSize = GetDataSize(width, height, mipLevels, texelSize);
+
+    Memory::StagingRegion stagingRegion;
+    VmaBuffer* stagingBuffer = nullptr;
 
-    auto&& stagingBuffer = VmaBuffer::Create(allocator, imageSize * 2); // TODO: imageSize * 2? Check correctly or fix
-    if (void* data = stagingBuffer->MapData(); !data || !stagingBuffer) {
+    if (pUploadContext) {
+        stagingRegion = pUploadContext->AllocateStaging(stagingSize);
+    }
+    else if ((stagingBuffer = VmaBuffer::Create(allocator, stagingSize))) {
+        stagingRegion.m_buffer = *stagingBuffer;
+        stagingRegion.m_size   = stagingSize;
+        stagingRegion.m_data   = stagingBuffer->MapData();
+    }
+
+    if (!stagingRegion.Valid()) {
         VK_ERROR("Texture::LoadCubeMap() : failed to map memory!");
+        delete stagingBuffer;
+        delete texture;
         return nullptr;
     }
-    else {
-        const uint64_t layerSize = imageSize / 6;
-        for (uint8_t i = 0; i < 6; ++i) {
-            memcpy(static_cast<uint8_t *>(data) + (layerSize * i), sides[i], layerSize);
-        }
+
+    for (uint8_t i = 0; i < 6; ++i) {
+        memcpy(static_cast<uint8_t*>(stagingRegion.m_data) + (layerSize * i), sides[i], layerSize);
+    }
+
+    if (stagingBuffer) {
         stagingBuffer->Unmap();
     }
 
@@ -124,16 +257,19 @@ EvoVulkan::Types::Texture* EvoVulkan::Types::Texture::LoadCubeMap(
 
     if (!(texture->m_image = Types::Image::Create(imageCI)).Valid()) {
         VK_ERROR("Texture::LoadCubeMap() : failed to create image!");
+        /// staging region of the upload context is freed with its batch
+        delete stagingBuffer;
+        delete texture;
         return nullptr;
     }
 
     std::vector<VkBufferImageCopy> bufferCopyRegions = { };
     for (uint8_t face = 0; face < 6; ++face) {
         for (uint8_t level = 0; level < (uint8_t) mipLevels; ++level) {
-            uint64_t offset = GetDataSize(width, height, level);
+            uint64_t offset = GetDataSize(width, height, level, texelSize);
 
             if (face != 0) {
-                offset += GetImageSize(width, height, level, face);
+                offset += GetImageSize(width, height, level, face, texelSize);
             }
 
             VkBufferImageCopy bufferCopyRegion = {};
@@ -147,12 +283,12 @@ EvoVulkan::Types::Texture* EvoVulkan::Types::Texture::LoadCubeMap(
             bufferCopyRegion.imageExtent.width               = width >> level;
             bufferCopyRegion.imageExtent.height              = height >> level;
             bufferCopyRegion.imageExtent.depth               = 1;
-            bufferCopyRegion.bufferOffset                    = offset;
+            bufferCopyRegion.bufferOffset                    = stagingRegion.m_offset + offset;
             bufferCopyRegions.emplace_back(bufferCopyRegion);
         }
     }
 
-    auto copyCmd = Types::CmdBuffer::BeginSingleTime(device, pool);
+    auto copyCmd = pUploadContext ? pUploadContext->GetCmd() : Types::CmdBuffer::BeginSingleTime(device, pool);
 
     texture->m_image.TransitionImageLayout(VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, copyCmd);
 
@@ -163,7 +299,7 @@ EvoVulkan::Types::Texture* EvoVulkan::Types::Texture::LoadCubeMap(
         /// Copy the cube map faces from the staging buffer to the optimal tiled image
         vkCmdCopyBufferToImage(
                 *copyCmd,
-                *stagingBuffer,
+                stagingRegion.m_buffer,
                 texture->m_image,
                 VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
                 static_cast<uint32_t>(bufferCopyRegions.size()),
@@ -173,19 +309,42 @@ EvoVulkan::Types::Texture* EvoVulkan::Types::Texture::LoadCubeMap(
         copyCmd->End();
     }
 
+    if (pUploadContext && pUploadContext->IsAsync()) {
+        /// upload queue can't use shader stages, final transition is done on graphics queue
+        texture->m_image.TransferOwnership(pUploadContext);
+        copyCmd = pUploadContext->GetGraphicsCmd();
+    }
+
     texture->m_image.TransitionImageLayout(VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, copyCmd);
 
     //!=================================================================================================================
 
-    delete copyCmd;
-    delete stagingBuffer;
+    if (pUploadContext) {
+        texture->m_uploadTicket = pUploadContext->GetCurrentTicket();
+    }
+    else {
+        delete copyCmd;
+        delete stagingBuffer;
+    }
 
     //!=================================================================================================================
 
+    /// commands of the texture are already recorded, so with upload context it's destroyed with the batch
+    auto&& destroyTexture = [texture, pUploadContext]() {
+        if (pUploadContext) {
+            texture->m_uploadTicket = 0;
+            pUploadContext->OnComplete([texture]() { delete texture; });
+        }
+        else {
+            delete texture;
+        }
+    };
+
     texture->m_view = Tools::CreateImageView(texture->m_image, VK_IMAGE_VIEW_TYPE_CUBE, 0);
 
     if (texture->m_view == VK_NULL_HANDLE) {
         VK_ERROR("Texture::LoadCubeMap() : failed to create image view!");
+        destroyTexture();
         return nullptr;
     }
 
@@ -203,7 +362,8 @@ EvoVulkan::Types::Texture* EvoVulkan::Types::Texture::LoadCubeMap(
     );
 
     if (texture->m_sampler == VK_NULL_HANDLE) {
-        VK_ERROR("Texture::Create() : LoadCubeMap to create sampler image!");
+        VK_ERROR("Texture::LoadCubeMap() : failed to create sampler!");
+        destroyTexture();
         return nullptr;
     }
 
@@ -215,6 +375,9 @@ EvoVulkan::Types::Texture* EvoVulkan::Types::Texture::LoadCubeMap(
             texture->m_view,
             texture->m_image.GetLayout()
     };
+
+    texture->UpdateBindless();
+
     return texture;
 }
 
@@ -229,34 +392,307 @@ EvoVulkan::Types::Texture* EvoVulkan::Types::Texture::Load(
         int32_t height,
         uint32_t mipLevels,
         VkFilter filter,
-        bool cpuUsage)
+        bool cpuUsage,
+        UploadContext* pUploadContext)
 {
-    if (width == 0 || height == 0) {
-        VK_ERROR("Texture::Load() : invalid texture! \n\tWidth: " + std::to_string(width) + "\n\tHeight: " + std::to_string(height));
+    if (!pixels) {
+        VK_ERROR("Texture::Load() : pixels is nullptr!");
         return nullptr;
     }
 
-    if (!pixels) {
-        VK_ERROR("Texture::Load() : pixels is nullptr!");
+    /// single level doesn't need any commands, pixels are copied into the image by host without staging memory
+    if (mipLevels == 1 && width > 0 && height > 0 && Tools::GetTexelSize(format) != 0 && IsSupportedByHostCopy(device, format, false, cpuUsage)) {
+        VK_LOG("Texture::Load() : loading new texture by host... \n\tWidth: " +
+               std::to_string(width) + "\n\tHeight: " + std::to_string(height));
+
+        auto&& pTexture = new Texture();
+        {
+            pTexture->m_width             = width;
+            pTexture->m_height            = height;
+            pTexture->m_mipLevels         = 1;
+            pTexture->m_format            = format;
+            pTexture->m_descriptorManager = manager;
+            pTexture->m_allocator         = allocator;
+            pTexture->m_device            = device;
+            pTexture->m_canBeDestroyed    = true;
+            pTexture->m_pool              = pool;
+            pTexture->m_filter            = filter;
+            pTexture->m_cubeMap           = false;
+            pTexture->m_cpuUsage          = cpuUsage;
+            pTexture->m_uploadContext     = pUploadContext;
+        }
+
+        VkBufferImageCopy bufferCopyRegion = {};
+        bufferCopyRegion.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        bufferCopyRegion.imageSubresource.layerCount = 1;
+        bufferCopyRegion.imageExtent.width           = width;
+        bufferCopyRegion.imageExtent.height          = height;
+        bufferCopyRegion.imageExtent.depth           = 1;
+
+        const void* pData = pixels;
+
+        if (!pTexture->CreateOnHost(std::span<const VkBufferImageCopy>(&bufferCopyRegion, 1), std::span<const void* const>(&pData, 1), 1)) {
+            VK_ERROR("Texture::Load() : failed to create on host!");
+            delete pTexture;
+            return nullptr;
+        }
+
+        return pTexture;
+    }
+
+    TextureLoadInfo info;
+    info.format    = format;
+    info.width     = width;
+    info.height    = height;
+    info.mipLevels = mipLevels;
+    info.filter    = filter;
+    info.cpuUsage  = cpuUsage;
+
+    auto&& pTexture = BeginLoad(device, allocator, manager, pool, info, pUploadContext);
+    if (!pTexture) {
         return nullptr;
     }
 
-    if (!device->IsSupportLinearBlitting(format)) {
-        VK_ERROR("Texture::Load() : device does not support linear blitting!");
+    auto&& staging = pTexture->GetStagingData();
+    memcpy(staging.data(), pixels, staging.size());
+
+    if (!pTexture->EndLoad()) {
+        VK_ERROR("Texture::Load() : failed to create!");
+        delete pTexture;
         return nullptr;
     }
 
-    VK_LOG("Texture::Load() : loading new texture... \n\tWidth: " +
-           std::to_string(width) + "\n\tHeight: " +
-           std::to_string(height) + "\n\tMip levels: " +
-           std::to_string(mipLevels) + "\n\tCPU usage: " + std::string(cpuUsage ? "True" : "False"));
+    return pTexture;
+}
+
+EvoVulkan::Types::Texture* EvoVulkan::Types::Texture::BeginLoad(
+        EvoVulkan::Types::Device *device,
+        Memory::Allocator *allocator,
+        Core::DescriptorManager* manager,
+        EvoVulkan::Types::CmdPool *pool,
+        const TextureLoadInfo& info,
+        UploadContext* pUploadContext)
+{
+    if (info.width <= 0 || info.height <= 0) {
+        VK_ERROR("Texture::BeginLoad() : invalid texture! \n\tWidth: " + std::to_string(info.width) + "\n\tHeight: " + std::to_string(info.height));
+        return nullptr;
+    }
+
+    if (Tools::GetTexelSize(info.format) == 0) {
+        VK_ERROR("Texture::BeginLoad() : unsupported format! Format: " + std::to_string(static_cast<int32_t>(info.format)));
+        return nullptr;
+    }
+
+    const uint32_t mipLevels = info.mipLevels == 0 ?
+        static_cast<uint32_t>(std::floor(std::log2(EVK_MAX(info.width, info.height)))) + 1 : info.mipLevels;
+
+    if (mipLevels > 1 && !device->IsSupportLinearBlitting(info.format) && !IsSupportedByMipGenerator(info.format, pUploadContext)) {
+        VK_ERROR("Texture::BeginLoad() : device does not support linear blitting!");
+        return nullptr;
+    }
+
+    VK_LOG("Texture::BeginLoad() : loading new texture... \n\tWidth: " +
+           std::to_string(info.width) + "\n\tHeight: " +
+           std::to_string(info.height) + "\n\tMip levels: " +
+           std::to_string(mipLevels) + "\n\tCPU usage: " + std::string(info.cpuUsage ? "True" : "False"));
+
+    auto&& pTexture = new Texture();
+    {
+        pTexture->m_width             = info.width;
+        pTexture->m_height            = info.height;
+        pTexture->m_mipLevels         = mipLevels;
+        pTexture->m_format            = info.format;
+        pTexture->m_descriptorManager = manager;
+        pTexture->m_allocator         = allocator;
+        pTexture->m_device            = device;
+        pTexture->m_canBeDestroyed    = true;
+        pTexture->m_pool              = pool;
+        pTexture->m_filter            = info.filter;
+        pTexture->m_cubeMap           = false;
+        pTexture->m_cpuUsage          = info.cpuUsage;
+        pTexture->m_uploadContext     = pUploadContext;
+    }
+
+    const VkDeviceSize imageSize = static_cast<VkDeviceSize>(pTexture->m_width) * pTexture->m_height * Tools::GetTexelSize(info.format);
+
+    if (pUploadContext) {
+        /// texture owns the region until EndLoad(), submits between them can't free it
+        pTexture->m_staging = pUploadContext->AllocateStaging(imageSize, nullptr, 16, true);
+        if (!pTexture->m_staging.Valid()) {
+            VK_ERROR("Texture::BeginLoad() : failed to allocate staging memory!");
+            delete pTexture;
+            return nullptr;
+        }
+    }
+    else {
+        pTexture->m_stagingBuffer = VmaBuffer::Create(allocator, imageSize);
+
+        void* pData = pTexture->m_stagingBuffer ? pTexture->m_stagingBuffer->MapData() : nullptr;
+        if (!pData) {
+            VK_ERROR("Texture::BeginLoad() : failed to allocate staging buffer!");
+            delete pTexture;
+            return nullptr;
+        }
+
+        pTexture->m_staging.m_buffer = *pTexture->m_stagingBuffer;
+        pTexture->m_staging.m_offset = 0;
+        pTexture->m_staging.m_size   = imageSize;
+        pTexture->m_staging.m_data   = pData;
+    }
+
+    return pTexture;
+}
+
+bool EvoVulkan::Types::Texture::EndLoad() {
+    if (!m_staging.Valid()) {
+        VK_ERROR("Texture::EndLoad() : loading wasn't begun!");
+        return false;
+    }
+
+    const Memory::StagingRegion staging = m_staging;
+    m_staging = Memory::StagingRegion();
+
+    if (!m_stagingBuffer) {
+        const bool result = Create(staging.m_buffer, staging.m_offset);
+        /// copy is recorded into the current batch, the region is freed with it
+        m_uploadContext->ReleaseStaging(staging);
+        return result;
+    }
+
+    m_stagingBuffer->Flush();
+    m_stagingBuffer->Unmap();
+
+    const bool result = Create(staging.m_buffer, staging.m_offset);
+    EVSafeFreeObject(m_stagingBuffer);
+
+    return result;
+}
+
+std::span<uint8_t> EvoVulkan::Types::Texture::GetStagingData() const {
+    return std::span<uint8_t>(static_cast<uint8_t*>(m_staging.m_data), m_staging.Valid() ? m_staging.m_size : 0);
+}
+
+EvoVulkan::Types::Texture* EvoVulkan::Types::Texture::Load(
+        EvoVulkan::Types::Device *device,
+        Memory::Allocator *allocator,
+        Core::DescriptorManager* manager,
+        EvoVulkan::Types::CmdPool *pool,
+        const Tools::MipChain& mipChain,
+        VkFilter filter,
+        bool cpuUsage,
+        UploadContext* pUploadContext)
+{
+    if (!mipChain.Valid()) {
+        VK_ERROR("Texture::Load() : mip chain is empty!");
+        return nullptr;
+    }
+
+    /// block compressed formats depend on device features
+    VkFormatProperties formatProperties;
+    vkGetPhysicalDeviceFormatProperties(*device, mipChain.GetFormat(), &formatProperties);
+
+    if (!(formatProperties.optimalTilingFeatures & VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT)) {
+        VK_ERROR("Texture::Load() : format isn't supported by device! Format: " + std::to_string(static_cast<int32_t>(mipChain.GetFormat())));
+        return nullptr;
+    }
+
+    VK_LOG("Texture::Load() : loading new texture with precomputed mips... \n\tWidth: " +
+           std::to_string(mipChain.GetWidth()) + "\n\tHeight: " +
+           std::to_string(mipChain.GetHeight()) + "\n\tMip levels: " +
+           std::to_string(mipChain.GetLevelsCount()) + "\n\tCPU usage: " + std::string(cpuUsage ? "True" : "False"));
+
+    auto&& pTexture = new Texture();
+    {
+        pTexture->m_width             = mipChain.GetWidth();
+        pTexture->m_height            = mipChain.GetHeight();
+        pTexture->m_mipLevels         = mipChain.GetLevelsCount();
+        pTexture->m_format            = mipChain.GetFormat();
+        pTexture->m_descriptorManager = manager;
+        pTexture->m_allocator         = allocator;
+        pTexture->m_device            = device;
+        pTexture->m_canBeDestroyed    = true;
+        pTexture->m_pool              = pool;
+        pTexture->m_filter            = filter;
+        pTexture->m_cubeMap           = false;
+        pTexture->m_cpuUsage          = cpuUsage;
+        pTexture->m_uploadContext     = pUploadContext;
+    }
+
+    const std::vector<VkBufferImageCopy> regions = GetCopyRegions(mipChain.GetLevels().data(), mipChain.GetLevelsCount(), 1);
+
+    if (IsSupportedByHostCopy(device, mipChain.GetFormat(), false, cpuUsage)) {
+        if (!pTexture->CreateOnHost(regions, GetHostPointers(mipChain.GetData(), regions), 1)) {
+            VK_ERROR("Texture::Load() : failed to create on host!");
+            delete pTexture;
+            return nullptr;
+        }
+
+        return pTexture;
+    }
+
+    if (pUploadContext) {
+        auto&& region = pUploadContext->AllocateStaging(mipChain.GetSize(), mipChain.GetData());
+        if (!region.Valid()) {
+            VK_ERROR("Texture::Load() : failed to allocate staging memory!");
+            delete pTexture;
+            return nullptr;
+        }
+
+        if (!pTexture->Create(region.m_buffer, region.m_offset, &regions)) {
+            VK_ERROR("Texture::Load() : failed to create!");
+            /// commands of the texture could be already recorded, so it's destroyed with the batch
+            pTexture->m_uploadTicket = 0;
+            pUploadContext->OnComplete([pTexture]() { delete pTexture; });
+            return nullptr;
+        }
+    }
+    else {
+        auto&& stagingBuffer = VmaBuffer::Create(allocator, mipChain.GetSize(), (void*)mipChain.GetData());
+        if (!stagingBuffer) {
+            VK_ERROR("Texture::Load() : failed to allocate staging buffer!");
+            delete pTexture;
+            return nullptr;
+        }
+
+        const bool result = pTexture->Create(*stagingBuffer, 0, &regions);
+        delete stagingBuffer;
+
+        if (!result) {
+            VK_ERROR("Texture::Load() : failed to create!");
+            delete pTexture;
+            return nullptr;
+        }
+    }
+
+    return pTexture;
+}
+
+EvoVulkan::Types::Texture* EvoVulkan::Types::Texture::CompressOnGPU(
+        EvoVulkan::Types::Device *device,
+        Memory::Allocator *allocator,
+        Core::DescriptorManager* manager,
+        EvoVulkan::Types::CmdPool *pool,
+        VkImageView source,
+        uint32_t width, uint32_t height,
+        Complexes::BlockEncoder* pEncoder,
+        Tools::BlockCompression compression,
+        bool sRGB, float quality, VkFilter filter,
+        UploadContext* pUploadContext)
+{
+    if (!pEncoder || !pEncoder->IsSupported(compression)) {
+        VK_ERROR("Texture::CompressOnGPU() : compression isn't supported by encoder!");
+        return nullptr;
+    }
+
+    VK_LOG("Texture::CompressOnGPU() : compressing texture... \n\tWidth: " +
+           std::to_string(width) + "\n\tHeight: " + std::to_string(height));
 
     auto&& pTexture = new Texture();
     {
         pTexture->m_width             = width;
         pTexture->m_height            = height;
-        pTexture->m_mipLevels         = mipLevels;
-        pTexture->m_format            = format;
+        pTexture->m_mipLevels         = 1;
+        pTexture->m_format            = Tools::TextureCompressor::GetFormat(compression, sRGB);
         pTexture->m_descriptorManager = manager;
         pTexture->m_allocator         = allocator;
         pTexture->m_device            = device;
@@ -264,57 +700,610 @@ EvoVulkan::Types::Texture* EvoVulkan::Types::Texture::Load(
         pTexture->m_pool              = pool;
         pTexture->m_filter            = filter;
         pTexture->m_cubeMap           = false;
+        pTexture->m_cpuUsage          = false;
+        pTexture->m_uploadContext     = pUploadContext;
+    }
+
+    auto&& imageCI = Types::ImageCreateInfo(
+        allocator, pool,
+        width, height, 1,
+        VK_IMAGE_ASPECT_COLOR_BIT,
+        pTexture->m_format,
+        VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT /** usage */,
+        1 /** sample count */,
+        false /** cpu usage */,
+        1 /** mip levels */,
+        1 /** layers count */
+    );
+
+    if (!(pTexture->m_image = Types::Image::Create(imageCI)).Valid()) {
+        VK_ERROR("Texture::CompressOnGPU() : failed to create image!");
+        delete pTexture;
+        return nullptr;
+    }
+
+    /// compute is available only on graphics queue
+    auto&& encodeCmd = pUploadContext ? pUploadContext->GetGraphicsCmd() : Types::CmdBuffer::BeginSingleTime(device, pool);
+
+    pTexture->m_image.TransitionImageLayout(VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, encodeCmd);
+
+    if (!pEncoder->Encode(encodeCmd, source, width, height, compression, quality, pTexture->m_image, 0, pUploadContext)) {
+        VK_ERROR("Texture::CompressOnGPU() : failed to encode blocks!");
+
+        if (pUploadContext) {
+            /// transition is already recorded
+            pUploadContext->OnComplete([pTexture]() { delete pTexture; });
+        }
+        else {
+            delete encodeCmd;
+            delete pTexture;
+        }
+
+        return nullptr;
+    }
+
+    pTexture->m_image.TransitionImageLayout(VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, encodeCmd);
+
+    //!=================================================================================================================
+
+    if (pUploadContext) {
+        pTexture->m_uploadTicket = pUploadContext->GetCurrentTicket();
+    }
+    else {
+        delete encodeCmd;
+    }
+
+    //!=================================================================================================================
+
+    /// encoding is already recorded, so the image is released only with the batch
+    auto&& destroyTexture = [pTexture, pUploadContext]() {
+        if (pUploadContext) {
+            pTexture->m_uploadTicket = 0;
+            pUploadContext->OnComplete([pTexture]() { delete pTexture; });
+        }
+        else {
+            delete pTexture;
+        }
+    };
+
+    pTexture->m_view = Tools::CreateImageView(pTexture->m_image, VK_IMAGE_VIEW_TYPE_2D, 0);
+
+    if (pTexture->m_view == VK_NULL_HANDLE) {
+        VK_ERROR("Texture::CompressOnGPU() : failed to create image view!");
+        destroyTexture();
+        return nullptr;
+    }
+
+    pTexture->m_sampler = Tools::CreateSampler(
+        device,
+        1,
+        filter /** min filter */,
+        filter /** mag filter */,
+        VK_SAMPLER_ADDRESS_MODE_MIRRORED_REPEAT,
+        VK_COMPARE_OP_NEVER
+    );
+
+    if (pTexture->m_sampler == VK_NULL_HANDLE) {
+        VK_ERROR("Texture::CompressOnGPU() : failed to create sampler!");
+        destroyTexture();
+        return nullptr;
+    }
+
+    //! make a texture descriptor
+    pTexture->m_descriptor = {
+        pTexture->m_sampler,
+        pTexture->m_view,
+        pTexture->m_image.GetLayout()
+    };
+
+    pTexture->UpdateBindless();
+
+    return pTexture;
+}
+
+EvoVulkan::Types::Texture* EvoVulkan::Types::Texture::Load(
+        EvoVulkan::Types::Device *device,
+        Memory::Allocator *allocator,
+        Core::DescriptorManager* manager,
+        EvoVulkan::Types::CmdPool *pool,
+        const Tools::TextureFile& file,
+        VkFilter filter,
+        bool cpuUsage,
+        UploadContext* pUploadContext,
+        Tools::ThreadPool* pThreadPool)
+{
+    if (file.IsCubeMap() ? file.GetLayersCount() != 6 : file.GetLayersCount() != 1) {
+        VK_ERROR("Texture::Load() : texture arrays aren't supported! Layers: " + std::to_string(file.GetLayersCount()));
+        return nullptr;
+    }
+
+    VkFormatProperties formatProperties;
+    vkGetPhysicalDeviceFormatProperties(*device, file.GetFormat(), &formatProperties);
+
+    if (!(formatProperties.optimalTilingFeatures & VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT)) {
+        VK_ERROR("Texture::Load() : format isn't supported by device! Format: " + std::to_string(static_cast<int32_t>(file.GetFormat())));
+        return nullptr;
+    }
+
+    VK_LOG("Texture::Load() : loading new texture from container... \n\tWidth: " +
+           std::to_string(file.GetWidth()) + "\n\tHeight: " +
+           std::to_string(file.GetHeight()) + "\n\tMip levels: " +
+           std::to_string(file.GetLevelsCount()) + "\n\tCube map: " + std::string(file.IsCubeMap() ? "True" : "False"));
+
+    auto&& pTexture = new Texture();
+    {
+        pTexture->m_width             = file.GetWidth();
+        pTexture->m_height            = file.GetHeight();
+        pTexture->m_mipLevels         = file.GetLevelsCount();
+        pTexture->m_format            = file.GetFormat();
+        pTexture->m_descriptorManager = manager;
+        pTexture->m_allocator         = allocator;
+        pTexture->m_device            = device;
+        pTexture->m_canBeDestroyed    = true;
+        pTexture->m_pool              = pool;
+        pTexture->m_filter            = filter;
+        pTexture->m_cubeMap           = file.IsCubeMap();
         pTexture->m_cpuUsage          = cpuUsage;
+        pTexture->m_uploadContext     = pUploadContext;
     }
 
-    auto&& stagingBuffer = VmaBuffer::Create(allocator, pTexture->m_width * pTexture->m_height * 4, (void*)pixels);
-    if (!pTexture->Create(stagingBuffer)) {
-        VK_ERROR("Texture::Load() : failed to create!");
+    const std::vector<VkBufferImageCopy> regions = GetCopyRegions(file.GetSubresources(), file.GetLevelsCount(), file.GetLayersCount());
+
+    const auto unpack = [&file, pThreadPool](void* pStaging) -> bool {
+        /// pages of the mapped file are read by this copy
+        return pStaging && file.Unpack(static_cast<uint8_t*>(pStaging), pThreadPool);
+    };
+
+    /// raw payload is copied from the mapped file straight into the image,
+    /// but if the context reads files in background, mapped pages aren't touched by this thread
+    const bool hostCopy = file.GetSupercompression() == Tools::TextureFile::Supercompression::None &&
+        !(pUploadContext && pUploadContext->GetFileReader()) &&
+        IsSupportedByHostCopy(device, file.GetFormat(), file.IsCubeMap(), cpuUsage);
+
+    if (hostCopy) {
+        if (!pTexture->CreateOnHost(regions, GetHostPointers(file.GetPayload(), regions), file.GetLayersCount())) {
+            VK_ERROR("Texture::Load() : failed to create on host!");
+            delete pTexture;
+            return nullptr;
+        }
+
+        return pTexture;
+    }
+
+    if (pUploadContext) {
+        auto&& region = pUploadContext->AllocateStaging(file.GetPayloadSize());
+        if (!region.Valid()) {
+            VK_ERROR("Texture::Load() : failed to allocate staging memory!");
+            delete pTexture;
+            return nullptr;
+        }
+
+        Tools::FileReadTicket readTicket = 0;
+
+        /// raw payload is read in background, mapped pages aren't touched, the read is waited by submission of the batch
+        auto&& pReader = pUploadContext->GetFileReader();
+        if (pReader && file.GetSupercompression() == Tools::TextureFile::Supercompression::None) {
+            Tools::FileReadRequest request;
+            request.m_path        = file.GetPath();
+            request.m_offset      = file.GetPayloadOffset();
+            request.m_size        = file.GetPayloadSize();
+            request.m_destination = region.m_data;
+
+            readTicket = pReader->Submit(std::span<const Tools::FileReadRequest>(&request, 1));
+        }
+
+        if (readTicket != 0) {
+            /// the read is waited by Submit(), the failure is reported by Wait() of the ticket and by IsLoadFailed()
+            pUploadContext->AddFileReads(readTicket, [pTexture]() { pTexture->m_loadFailed = true; });
+        }
+        else if (!unpack(region.m_data)) {
+            VK_ERROR("Texture::Load() : failed to unpack payload!");
+            delete pTexture;
+            return nullptr;
+        }
+
+        if (!pTexture->Create(region.m_buffer, region.m_offset, &regions, file.GetLayersCount())) {
+            VK_ERROR("Texture::Load() : failed to create!");
+            /// commands of the texture could be already recorded, so it's destroyed with the batch
+            pTexture->m_uploadTicket = 0;
+            pUploadContext->OnComplete([pTexture]() { delete pTexture; });
+            return nullptr;
+        }
+    }
+    else {
+        auto&& stagingBuffer = VmaBuffer::Create(allocator, file.GetPayloadSize());
+
+        const bool unpacked = stagingBuffer && unpack(stagingBuffer->MapData());
+        if (stagingBuffer) {
+            stagingBuffer->Flush();
+            stagingBuffer->Unmap();
+        }
+
+        if (!unpacked) {
+            VK_ERROR("Texture::Load() : failed to unpack payload!");
+            delete stagingBuffer;
+            delete pTexture;
+            return nullptr;
+        }
+
+        const bool result = pTexture->Create(*stagingBuffer, 0, &regions, file.GetLayersCount());
+        delete stagingBuffer;
+
+        if (!result) {
+            VK_ERROR("Texture::Load() : failed to create!");
+            delete pTexture;
+            return nullptr;
+        }
+    }
+
+    return pTexture;
+}
+
+EvoVulkan::Types::Texture* EvoVulkan::Types::Texture::Load(
+        EvoVulkan::Types::Device *device,
+        Memory::Allocator *allocator,
+        Core::DescriptorManager* manager,
+        EvoVulkan::Types::CmdPool *pool,
+        const std::string& path,
+        VkFilter filter,
+        bool cpuUsage,
+        UploadContext* pUploadContext,
+        Tools::ThreadPool* pThreadPool)
+{
+    auto&& pFile = Tools::TextureFile::Open(path);
+    if (!pFile) {
+        VK_ERROR("Texture::Load() : failed to open texture file! \n\tPath: " + path);
         return nullptr;
     }
 
+    /// asynchronous reads use the path, so the mapping isn't needed after it
+    auto&& pTexture = Load(device, allocator, manager, pool, *pFile, filter, cpuUsage, pUploadContext, pThreadPool);
+    delete pFile;
+
     return pTexture;
 }
 
-bool EvoVulkan::Types::Texture::Create(EvoVulkan::Types::VmaBuffer *stagingBuffer) {
+EvoVulkan::Types::TextureBatch EvoVulkan::Types::Texture::LoadBatch(
+        EvoVulkan::Types::Device *device,
+        Memory::Allocator *allocator,
+        Core::DescriptorManager* manager,
+        EvoVulkan::Types::CmdPool *pool,
+        std::span<const TextureLoadInfo> infos,
+        UploadContext* pUploadContext)
+{
+    TextureBatch batch;
+
+    if (!pUploadContext) {
+        VK_ERROR("Texture::LoadBatch() : upload context is nullptr!");
+        return batch;
+    }
+
+    VK_LOG("Texture::LoadBatch() : loading " + std::to_string(infos.size()) + " textures...");
+
+    /// offsets are aligned as regions of the staging ring
+    constexpr VkDeviceSize alignment = 16;
+
+    std::vector<VkDeviceSize> offsets(infos.size(), 0);
+    VkDeviceSize stagingSize = 0;
+
+    for (size_t i = 0; i < infos.size(); ++i) {
+        offsets[i] = stagingSize;
+        const VkDeviceSize imageSize = static_cast<VkDeviceSize>(EVK_MAX(infos[i].width, 0)) * EVK_MAX(infos[i].height, 0) * Tools::GetTexelSize(infos[i].format);
+        stagingSize += (imageSize + alignment - 1) / alignment * alignment;
+    }
+
+    if (stagingSize == 0) {
+        VK_ERROR("Texture::LoadBatch() : nothing to load!");
+        return batch;
+    }
+
+    auto&& region = pUploadContext->AllocateStaging(stagingSize, nullptr, alignment);
+    if (!region.Valid()) {
+        VK_ERROR("Texture::LoadBatch() : failed to allocate staging memory!");
+        return batch;
+    }
+
+    batch.m_textures.reserve(infos.size());
+
+    for (size_t i = 0; i < infos.size(); ++i) {
+        auto&& info = infos[i];
+
+        if (info.width <= 0 || info.height <= 0 || !info.pixels || Tools::GetTexelSize(info.format) == 0) {
+            VK_ERROR("Texture::LoadBatch() : invalid texture description! Index: " + std::to_string(i));
+            batch.m_textures.emplace_back(nullptr);
+            continue;
+        }
+
+        if (info.mipLevels != 1 && !device->IsSupportLinearBlitting(info.format) && !IsSupportedByMipGenerator(info.format, pUploadContext)) {
+            VK_ERROR("Texture::LoadBatch() : device does not support linear blitting! Index: " + std::to_string(i));
+            batch.m_textures.emplace_back(nullptr);
+            continue;
+        }
+
+        const VkDeviceSize imageSize = static_cast<VkDeviceSize>(info.width) * info.height * Tools::GetTexelSize(info.format);
+        memcpy(static_cast<uint8_t*>(region.m_data) + offsets[i], info.pixels, imageSize);
+
+        auto&& pTexture = new Texture();
+        {
+            pTexture->m_width             = info.width;
+            pTexture->m_height            = info.height;
+            pTexture->m_mipLevels         = info.mipLevels == 0 ?
+                static_cast<uint32_t>(std::floor(std::log2(EVK_MAX(info.width, info.height)))) + 1 : info.mipLevels;
+            pTexture->m_format            = info.format;
+            pTexture->m_descriptorManager = manager;
+            pTexture->m_allocator         = allocator;
+            pTexture->m_device            = device;
+            pTexture->m_canBeDestroyed    = true;
+            pTexture->m_pool              = pool;
+            pTexture->m_filter            = info.filter;
+            pTexture->m_cubeMap           = false;
+            pTexture->m_cpuUsage          = info.cpuUsage;
+            pTexture->m_uploadContext     = pUploadContext;
+        }
+
+        if (!pTexture->Create(region.m_buffer, region.m_offset + offsets[i])) {
+            VK_ERROR("Texture::LoadBatch() : failed to create texture! Index: " + std::to_string(i));
+            /// commands of the texture could be already recorded, so it's destroyed with the batch
+            pTexture->m_uploadTicket = 0;
+            pUploadContext->OnComplete([pTexture]() { delete pTexture; });
+            pTexture = nullptr;
+        }
+
+        batch.m_textures.emplace_back(pTexture);
+    }
+
+    batch.m_ticket = pUploadContext->Submit();
+
+    return batch;
+}
+
+bool EvoVulkan::Types::Texture::Create(VkBuffer stagingBuffer, VkDeviceSize stagingOffset, const std::vector<VkBufferImageCopy>* pRegions, uint32_t layers) {
+    Complexes::MipGenerator* pMipGenerator = nullptr;
+    if (!pRegions && m_mipLevels > 1 && m_uploadContext && m_uploadContext->GetMipGenerator()) {
+        if (m_uploadContext->GetMipGenerator()->IsSupported(m_format)) {
+            pMipGenerator = m_uploadContext->GetMipGenerator();
+        }
+    }
+
+    VkImageUsageFlags usage = VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+    if (pMipGenerator) {
+        usage |= Complexes::MipGenerator::GetImageUsage(m_format);
+    }
+
     auto&& imageCI = Types::ImageCreateInfo(
         m_allocator, m_pool,
         m_width, m_height, 1,
         VK_IMAGE_ASPECT_COLOR_BIT,
         m_format,
-        VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT /** usage */,
+        usage,
         1 /** sample count */,
         m_cpuUsage /** cpu usage */,
         m_mipLevels,
-        1 /** layers count */
+        layers
     );
 
+    if (m_cubeMap) {
+        imageCI.createFlagBits = VK_IMAGE_CREATE_CUBE_COMPATIBLE_BIT;
+    }
+    else if (pMipGenerator && Complexes::MipGenerator::GetImageFlags(m_format) != 0) {
+        imageCI.createFlagBits = static_cast<VkImageCreateFlagBits>(Complexes::MipGenerator::GetImageFlags(m_format));
+    }
+
     if (!(m_image = Types::Image::Create(imageCI)).Valid()) {
         VK_ERROR("Texture::Create() : failed to create image!");
         return false;
     }
 
-    auto&& copyCmd = Types::CmdBuffer::BeginSingleTime(m_device, m_pool);
+    auto&& copyCmd = m_uploadContext ? m_uploadContext->GetCmd() : Types::CmdBuffer::BeginSingleTime(m_device, m_pool);
 
     m_image.TransitionImageLayout(VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, copyCmd);
 
-    Tools::CopyBufferToImage(copyCmd, *stagingBuffer, m_image, m_width, m_height);
+    if (pRegions) {
+        std::vector<VkBufferImageCopy> bufferCopyRegions = *pRegions;
+        for (auto&& bufferCopyRegion : bufferCopyRegions) {
+            bufferCopyRegion.bufferOffset += stagingOffset;
+        }
+
+        if (!copyCmd->IsBegin()) {
+            copyCmd->Begin(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
+        }
+
+        vkCmdCopyBufferToImage(
+            *copyCmd,
+            stagingBuffer,
+            m_image,
+            VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+            static_cast<uint32_t>(bufferCopyRegions.size()),
+            bufferCopyRegions.data()
+        );
+
+        copyCmd->End();
+    }
+    else {
+        Tools::CopyBufferToImage(copyCmd, stagingBuffer, m_image, m_width, m_height, stagingOffset);
+    }
+
+    if (m_uploadContext && m_uploadContext->IsAsync()) {
+        /// blits and shader stages aren't available on upload queue, mips are generated on graphics queue
+        m_image.TransferOwnership(m_uploadContext);
+        copyCmd = m_uploadContext->GetGraphicsCmd();
+    }
+
+    bool mipsGenerated = true;
 
-    if (m_mipLevels == 1) {
+    if (m_mipLevels == 1 || pRegions) {
         m_image.TransitionImageLayout(VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, copyCmd);
     }
-    else if (!GenerateMipmaps(this, copyCmd)) {
+    else if (pMipGenerator) {
+        if (!(mipsGenerated = pMipGenerator->Generate(copyCmd, m_image, m_width, m_height, m_mipLevels, m_uploadContext))) {
+            VK_ERROR("Texture::Create() : failed to generate mip maps by compute shader!");
+        }
+    }
+    else if (!(mipsGenerated = GenerateMipmaps(this, copyCmd))) {
         VK_ERROR("Texture::Create() : failed to generate mip maps!");
-        return false;
     }
 
     //!=================================================================================================================
 
-    delete copyCmd;
-    delete stagingBuffer;
+    /// single time command buffer is freed on failure too
+    if (m_uploadContext) {
+        m_uploadTicket = m_uploadContext->GetCurrentTicket();
+    }
+    else {
+        delete copyCmd;
+    }
+
+    if (!mipsGenerated) {
+        return false;
+    }
 
     //!=================================================================================================================
 
+    return CreateSampledView(VK_SAMPLER_ADDRESS_MODE_MIRRORED_REPEAT);
+}
+
+EvoVulkan::Types::Texture* EvoVulkan::Types::Texture::LoadStreamed(
+        EvoVulkan::Types::Device *device,
+        Memory::Allocator *allocator,
+        Core::DescriptorManager* manager,
+        EvoVulkan::Types::CmdPool *pool,
+        const std::string& path,
+        VkFilter filter,
+        Complexes::TextureStreamer* pStreamer)
+{
+    if (!pStreamer) {
+        VK_ERROR("Texture::LoadStreamed() : streamer is nullptr!");
+        return nullptr;
+    }
+
+    auto&& pFile = Tools::TextureFile::Open(path);
+    if (!pFile) {
+        VK_ERROR("Texture::LoadStreamed() : failed to open texture file! \n\tPath: " + path);
+        return nullptr;
+    }
+
+    if (pFile->IsCubeMap() ? pFile->GetLayersCount() != 6 : pFile->GetLayersCount() != 1) {
+        VK_ERROR("Texture::LoadStreamed() : texture arrays aren't supported! Layers: " + std::to_string(pFile->GetLayersCount()));
+        delete pFile;
+        return nullptr;
+    }
+
+    VkFormatProperties formatProperties;
+    vkGetPhysicalDeviceFormatProperties(*device, pFile->GetFormat(), &formatProperties);
+
+    if (!(formatProperties.optimalTilingFeatures & VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT)) {
+        VK_ERROR("Texture::LoadStreamed() : format isn't supported by device! Format: " + std::to_string(static_cast<int32_t>(pFile->GetFormat())));
+        delete pFile;
+        return nullptr;
+    }
+
+    VK_LOG("Texture::LoadStreamed() : loading new streamed texture... \n\tWidth: " +
+           std::to_string(pFile->GetWidth()) + "\n\tHeight: " +
+           std::to_string(pFile->GetHeight()) + "\n\tMip levels: " +
+           std::to_string(pFile->GetLevelsCount()) + "\n\tPath: " + path);
+
+    auto&& pTexture = new Texture();
+    {
+        pTexture->m_width             = pFile->GetWidth();
+        pTexture->m_height            = pFile->GetHeight();
+        pTexture->m_mipLevels         = pFile->GetLevelsCount();
+        pTexture->m_format            = pFile->GetFormat();
+        pTexture->m_descriptorManager = manager;
+        pTexture->m_allocator         = allocator;
+        pTexture->m_device            = device;
+        pTexture->m_canBeDestroyed    = true;
+        pTexture->m_pool              = pool;
+        pTexture->m_filter            = filter;
+        pTexture->m_cubeMap           = pFile->IsCubeMap();
+        pTexture->m_cpuUsage          = false;
+        pTexture->m_uploadContext     = pStreamer->GetUploadContext();
+        pTexture->m_streamSource      = pFile;
+    }
+
+    /// sampler covers all levels, sampled ones are limited by the view of resident levels
+    pTexture->m_sampler = Tools::CreateSampler(
+        device,
+        pTexture->m_mipLevels,
+        filter /** min filter */,
+        filter /** mag filter */,
+        VK_SAMPLER_ADDRESS_MODE_MIRRORED_REPEAT,
+        VK_COMPARE_OP_NEVER
+    );
+
+    if (pTexture->m_sampler == VK_NULL_HANDLE) {
+        VK_ERROR("Texture::LoadStreamed() : failed to create sampler!");
+        delete pTexture;
+        return nullptr;
+    }
+
+    if (!pStreamer->Add(pTexture)) {
+        VK_ERROR("Texture::LoadStreamed() : failed to add texture to streamer!");
+        delete pTexture;
+        return nullptr;
+    }
+
+    return pTexture;
+}
+
+bool EvoVulkan::Types::Texture::CreateOnHost(
+    std::span<const VkBufferImageCopy> regions,
+    std::span<const void* const> data,
+    uint32_t layers,
+    VkSamplerAddressMode addressMode)
+{
+#ifdef VK_EXT_host_image_copy
+    auto&& imageCI = Types::ImageCreateInfo(
+        m_allocator, m_pool,
+        m_width, m_height, 1,
+        VK_IMAGE_ASPECT_COLOR_BIT,
+        m_format,
+        HostCopyUsage | VK_IMAGE_USAGE_HOST_TRANSFER_BIT_EXT,
+        1 /** sample count */,
+        m_cpuUsage /** cpu usage */,
+        m_mipLevels,
+        layers
+    );
+
+    if (m_cubeMap) {
+        imageCI.createFlagBits = VK_IMAGE_CREATE_CUBE_COMPATIBLE_BIT;
+    }
+
+    if (!(m_image = Types::Image::Create(imageCI)).Valid()) {
+        VK_ERROR("Texture::CreateOnHost() : failed to create image!");
+        return false;
+    }
+
+    /// the image isn't known by device yet, so host operations don't need any synchronization
+    const VkImageLayout copyLayout = m_device->GetHostCopyLayout();
+
+    if (!m_image.TransitionImageLayoutOnHost(copyLayout, VK_IMAGE_ASPECT_COLOR_BIT)) {
+        VK_ERROR("Texture::CreateOnHost() : failed to transition image layout!");
+        return false;
+    }
+
+    if (!m_device->CopyMemoryToImage(m_image, copyLayout, regions, data)) {
+        VK_ERROR("Texture::CreateOnHost() : failed to copy memory to image!");
+        return false;
+    }
+
+    if (copyLayout != VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL) {
+        if (!m_image.TransitionImageLayoutOnHost(VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_IMAGE_ASPECT_COLOR_BIT)) {
+            VK_ERROR("Texture::CreateOnHost() : failed to transition image layout!");
+            return false;
+        }
+    }
+
+    /// there is nothing to wait, the image is ready after the copy
+    m_uploadTicket = 0;
+
+    return CreateSampledView(addressMode);
+#else
+    VK_ERROR("Texture::CreateOnHost() : host image copy is not supported by vulkan headers!");
+    return false;
+#endif
+}
+
+bool EvoVulkan::Types::Texture::CreateSampledView(VkSamplerAddressMode addressMode) {
     m_view = Tools::CreateImageView(m_image, m_cubeMap ? VK_IMAGE_VIEW_TYPE_CUBE : VK_IMAGE_VIEW_TYPE_2D, 0);
 
     if (m_view == VK_NULL_HANDLE) {
@@ -329,7 +1318,7 @@ bool EvoVulkan::Types::Texture::Create(EvoVulkan::Types::VmaBuffer *stagingBuffe
         m_mipLevels,
         m_filter /** min filter */,
         m_filter /** mag filter */,
-        VK_SAMPLER_ADDRESS_MODE_MIRRORED_REPEAT,
+        addressMode,
         VK_COMPARE_OP_NEVER
     );
 
@@ -347,9 +1336,27 @@ bool EvoVulkan::Types::Texture::Create(EvoVulkan::Types::VmaBuffer *stagingBuffe
         m_image.GetLayout()
     };
 
+    UpdateBindless();
+
     return true;
 }
 
+void EvoVulkan::Types::Texture::UpdateBindless() {
+    auto&& pBindless = m_descriptorManager ? m_descriptorManager->GetBindlessTextures() : nullptr;
+    if (!pBindless) {
+        return;
+    }
+
+    /// the slot is rewritten in place (update-after-bind), so indices in materials stay valid,
+    /// objects of the old descriptor are retired by the owner after frames in flight
+    if (m_bindlessIndex != Core::BindlessTextures::InvalidIndex) {
+        pBindless->Update(m_bindlessIndex, m_descriptor);
+        return;
+    }
+
+    m_bindlessIndex = pBindless->Add(m_descriptor);
+}
+
 bool EvoVulkan::Types::Texture::GenerateMipmaps(
     EvoVulkan::Types::Texture *texture,
     EvoVulkan::Types::CmdBuffer *singleBuffer)
@@ -433,24 +1440,29 @@ bool EvoVulkan::Types::Texture::GenerateMipmaps(
 }
 
 EvoVulkan::Types::DescriptorSet EvoVulkan::Types::Texture::GetDescriptorSet(VkDescriptorSetLayout layout) {
+    Core::DescriptorWriter writer(m_device);
+    auto&& descriptorSet = GetDescriptorSet(layout, writer);
+    writer.Flush();
+    return descriptorSet;
+}
+
+EvoVulkan::Types::DescriptorSet EvoVulkan::Types::Texture::GetDescriptorSet(VkDescriptorSetLayout layout, Core::DescriptorWriter& writer) {
     if (!m_descriptorManager) {
         VK_HALT("Texture::GetDescriptorSet() : texture have not descriptor manager!");
         return Types::DescriptorSet();
     }
 
-    if (m_descriptorSet == VK_NULL_HANDLE) {
+    if (!m_descriptorSet.Valid()) {
         static const DescriptorPool::RequestTypes type = {
                 VkDescriptorType::VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER
         };
 
         m_descriptorSet = m_descriptorManager->AllocateDescriptorSet(layout, type);
 
-        auto writer = EvoVulkan::Tools::Initializers::WriteDescriptorSet(
-                m_descriptorSet,
-                VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
-                0, this->GetDescriptorRef());
-
-        vkUpdateDescriptorSets(*m_device, 1, &writer, 0, nullptr);
+        /// descriptor buffer is written immediately by the writer
+        if (m_descriptorSet.Valid()) {
+            writer.WriteImage(m_descriptorSet, 0, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, m_descriptor);
+        }
     }
 
     return m_descriptorSet;
@@ -475,6 +1487,11 @@ EvoVulkan::Types::Texture::RGBAPixel EvoVulkan::Types::Texture::GetPixel(uint32_
         return {};
     }
 
+    /// single time buffer would be executed before the batch with the image contents
+    if (m_uploadContext && m_uploadTicket != 0) {
+        m_uploadContext->Wait(m_uploadTicket);
+    }
+
     auto&& copyCmd = EvoVulkan::Types::CmdBuffer::BeginSingleTime(m_device, m_pool);
 
     auto&& pBuffer = EvoVulkan::Types::Buffer::Create(
@@ -0,0 +1,699 @@
+//
+// Created by Monika on 18.10.2026.
+//
+
+#include <EvoVulkan/Types/UploadContext.h>
+
+#include <EvoVulkan/Types/Device.h>
+#include <EvoVulkan/Types/VmaBuffer.h>
+#include <EvoVulkan/Tools/VulkanDebug.h>
+#include <EvoVulkan/Tools/VulkanConverter.h>
+
+namespace EvoVulkan::Types {
+    UploadContext::~UploadContext() {
+        WaitIdle();
+
+        for (auto&& pBatch : m_free) {
+            delete pBatch->m_cmd;
+            delete pBatch->m_graphicsCmd;
+            vkDestroyFence(*m_device, pBatch->m_fence, nullptr);
+            delete pBatch;
+        }
+        m_free.clear();
+
+        if (!m_detachedSpills.empty()) {
+            VK_WARN("UploadContext::~UploadContext() : detached staging regions weren't released! Count: " + std::to_string(m_detachedSpills.size()));
+        }
+
+        for (auto&& pSpill : m_detachedSpills) {
+            pSpill->Unmap();
+            delete pSpill;
+        }
+        m_detachedSpills.clear();
+
+        if (m_timeline != VK_NULL_HANDLE) {
+            vkDestroySemaphore(*m_device, m_timeline, nullptr);
+            m_timeline = VK_NULL_HANDLE;
+        }
+
+        EVSafeFreeObject(m_staging);
+        EVSafeFreeObject(m_graphicsPool);
+        EVSafeFreeObject(m_pool);
+
+        m_device = nullptr;
+        m_queue = VK_NULL_HANDLE;
+    }
+
+    UploadContext* UploadContext::Create(Device* device) {
+        return Create(device, device->GetQueues()->GetGraphicsIndex(), device->GetQueues()->GetGraphicsQueue());
+    }
+
+    UploadContext* UploadContext::Create(Device* device, uint32_t queueFamilyIndex, VkQueue queue) {
+        return Create(device, queueFamilyIndex, queue, queueFamilyIndex, queue);
+    }
+
+    UploadContext* UploadContext::Create(Device* device, uint32_t queueFamilyIndex, VkQueue queue, uint32_t graphicsFamilyIndex, VkQueue graphicsQueue) {
+        VK_GRAPH("UploadContext::Create() : creating upload context...");
+
+        if (!device || !device->IsReady()) {
+            VK_ERROR("UploadContext::Create() : device isn't ready!");
+            return nullptr;
+        }
+
+        if (queue == VK_NULL_HANDLE || graphicsQueue == VK_NULL_HANDLE) {
+            VK_ERROR("UploadContext::Create() : queue is invalid!");
+            return nullptr;
+        }
+
+        const bool async = queueFamilyIndex != graphicsFamilyIndex;
+
+        if (async && !device->IsTimelineSemaphoreSupported()) {
+            VK_ERROR("UploadContext::Create() : asynchronous upload requires timeline semaphores!");
+            return nullptr;
+        }
+
+        auto&& pContext = new UploadContext();
+        {
+            pContext->m_device              = device;
+            pContext->m_queue               = queue;
+            pContext->m_queueFamilyIndex    = queueFamilyIndex;
+            pContext->m_graphicsQueue       = graphicsQueue;
+            pContext->m_graphicsFamilyIndex = graphicsFamilyIndex;
+        }
+
+        if (!(pContext->m_pool = CmdPool::Create(device, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT, queueFamilyIndex))) {
+            VK_ERROR("UploadContext::Create() : failed to create command pool!");
+            delete pContext;
+            return nullptr;
+        }
+
+        if (!async) {
+            return pContext;
+        }
+
+        if (!(pContext->m_graphicsPool = CmdPool::Create(device, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT, graphicsFamilyIndex))) {
+            VK_ERROR("UploadContext::Create() : failed to create graphics command pool!");
+            delete pContext;
+            return nullptr;
+        }
+
+        VkSemaphoreTypeCreateInfo typeCreateInfo = {};
+        typeCreateInfo.sType         = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+        typeCreateInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+        typeCreateInfo.initialValue  = 0;
+
+        VkSemaphoreCreateInfo semaphoreCreateInfo = Tools::Initializers::SemaphoreCreateInfo();
+        semaphoreCreateInfo.pNext = &typeCreateInfo;
+
+        auto&& result = vkCreateSemaphore(*device, &semaphoreCreateInfo, nullptr, &pContext->m_timeline);
+        if (result != VK_SUCCESS) {
+            VK_ERROR("UploadContext::Create() : failed to create timeline semaphore! Reason: " + Tools::Convert::result_to_description(result));
+            delete pContext;
+            return nullptr;
+        }
+
+        VK_LOG("UploadContext::Create() : uploads will be executed on queue family " + std::to_string(queueFamilyIndex));
+
+        return pContext;
+    }
+
+    bool UploadContext::InitStaging(Memory::Allocator* pAllocator, VkDeviceSize size) {
+        std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+        if (m_staging) {
+            VK_ERROR("UploadContext::InitStaging() : staging is already initialized!");
+            return false;
+        }
+
+        m_allocator = pAllocator;
+
+        if (!(m_staging = Memory::StagingRing::Create(pAllocator, size))) {
+            VK_ERROR("UploadContext::InitStaging() : failed to create staging ring!");
+            return false;
+        }
+
+        return true;
+    }
+
+    Memory::StagingRegion UploadContext::AllocateStaging(VkDeviceSize size, const void* pData, VkDeviceSize alignment, bool detached) {
+        std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+        Memory::StagingRegion region;
+
+        while (m_staging && size <= m_staging->GetSize()) {
+            if (!GetCmd()) {
+                VK_ERROR("UploadContext::AllocateStaging() : failed to get command buffer!");
+                return region;
+            }
+
+            if (m_staging->Allocate(size, alignment, region)) {
+                if (!detached) {
+                    m_current->m_regions.emplace_back(region);
+                }
+                break;
+            }
+
+            if (m_pending.empty() && m_current->m_regions.empty()) {
+                /// nothing can be reclaimed, the ring is empty
+                break;
+            }
+
+            {
+                std::lock_guard<std::mutex> stagingLock(m_staging->m_mutex);
+                ++m_staging->m_stalls;
+            }
+
+            /// regions of the current batch can be reclaimed only after its submission
+            if (m_pending.empty()) {
+                Submit();
+            }
+
+            if (!m_pending.empty()) {
+                WaitBatch(m_pending.front());
+            }
+
+            Collect();
+        }
+
+        if (!region.Valid()) {
+            if (!m_allocator) {
+                VK_ERROR("UploadContext::AllocateStaging() : staging isn't initialized!");
+                return region;
+            }
+
+            if (m_staging) {
+                std::lock_guard<std::mutex> stagingLock(m_staging->m_mutex);
+                ++m_staging->m_spills;
+            }
+
+            auto&& pSpill = VmaBuffer::Create(m_allocator, size);
+            if (!pSpill || !(region.m_data = pSpill->MapData())) {
+                VK_ERROR("UploadContext::AllocateStaging() : failed to allocate temporary buffer!");
+                delete pSpill;
+                return Memory::StagingRegion();
+            }
+
+            region.m_buffer = *pSpill;
+            region.m_offset = 0;
+            region.m_size   = size;
+
+            if (!GetCmd()) {
+                VK_ERROR("UploadContext::AllocateStaging() : failed to get command buffer!");
+                pSpill->Unmap();
+                delete pSpill;
+                return Memory::StagingRegion();
+            }
+
+            if (detached) {
+                m_detachedSpills.emplace_back(pSpill);
+            }
+            else {
+                m_current->m_spills.emplace_back(pSpill);
+            }
+        }
+
+        if (pData) {
+            memcpy(region.m_data, pData, size);
+        }
+
+        return region;
+    }
+
+    void UploadContext::ReleaseStaging(const Memory::StagingRegion& region) {
+        std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+        if (!region.Valid()) {
+            return;
+        }
+
+        if (!GetCmd()) {
+            VK_ERROR("UploadContext::ReleaseStaging() : failed to get command buffer!");
+            return;
+        }
+
+        if (region.m_id != 0) {
+            m_current->m_regions.emplace_back(region);
+            return;
+        }
+
+        auto&& pIt = std::find_if(m_detachedSpills.begin(), m_detachedSpills.end(), [&region](VmaBuffer* pSpill) {
+            return static_cast<VkBuffer>(*pSpill) == region.m_buffer;
+        });
+
+        if (pIt == m_detachedSpills.end()) {
+            VK_ERROR("UploadContext::ReleaseStaging() : region isn't detached!");
+            return;
+        }
+
+        m_current->m_spills.emplace_back(*pIt);
+        m_detachedSpills.erase(pIt);
+    }
+
+    CmdBuffer* UploadContext::GetCmd() {
+        std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+        if (m_current) {
+            return m_current->m_cmd;
+        }
+
+        if (!(m_current = AcquireBatch())) {
+            VK_ERROR("UploadContext::GetCmd() : failed to acquire batch!");
+            return nullptr;
+        }
+
+        m_current->m_ticket = m_nextTicket++;
+
+        if (!m_current->m_cmd->Begin(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT)) {
+            VK_ERROR("UploadContext::GetCmd() : failed to begin command buffer!");
+            ReleaseBatch(m_current);
+            m_current = nullptr;
+            return nullptr;
+        }
+
+        return m_current->m_cmd;
+    }
+
+    CmdBuffer* UploadContext::GetGraphicsCmd() {
+        std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+        if (!GetCmd()) {
+            return nullptr;
+        }
+
+        if (!IsAsync()) {
+            return m_current->m_cmd;
+        }
+
+        if (!m_current->m_graphicsUsed) {
+            if (!m_current->m_graphicsCmd->Begin(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT)) {
+                VK_ERROR("UploadContext::GetGraphicsCmd() : failed to begin command buffer!");
+                return nullptr;
+            }
+
+            m_current->m_graphicsUsed = true;
+        }
+
+        return m_current->m_graphicsCmd;
+    }
+
+    void UploadContext::TransferOwnership(VkImage image, VkImageLayout layout, const VkImageSubresourceRange& range) {
+        std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+        if (!IsAsync()) {
+            return;
+        }
+
+        auto&& pCmd = GetCmd();
+        auto&& pGraphicsCmd = GetGraphicsCmd();
+
+        if (!pCmd || !pGraphicsCmd) {
+            VK_ERROR("UploadContext::TransferOwnership() : failed to get command buffers!");
+            return;
+        }
+
+        VkImageMemoryBarrier barrier = Tools::Initializers::ImageMemoryBarrier();
+        barrier.oldLayout           = layout;
+        barrier.newLayout           = layout;
+        barrier.srcQueueFamilyIndex = m_queueFamilyIndex;
+        barrier.dstQueueFamilyIndex = m_graphicsFamilyIndex;
+        barrier.image               = image;
+        barrier.subresourceRange    = range;
+
+        /// release, dst access is ignored by the spec
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask = 0;
+
+        vkCmdPipelineBarrier(*pCmd,
+            VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+            0, 0, nullptr, 0, nullptr, 1, &barrier);
+
+        /// acquire, src access is ignored, visibility is provided by the timeline semaphore
+        barrier.srcAccessMask = 0;
+        barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT | VK_ACCESS_SHADER_READ_BIT;
+
+        vkCmdPipelineBarrier(*pGraphicsCmd,
+            VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+            0, 0, nullptr, 0, nullptr, 1, &barrier);
+    }
+
+    UploadTicket UploadContext::GetCurrentTicket() {
+        std::lock_guard<std::recursive_mutex> lock(m_mutex);
+        return m_current ? m_current->m_ticket : m_lastSubmitted;
+    }
+
+    void UploadContext::OnComplete(std::function<void()> callback) {
+        std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+        if (!m_current) {
+            /// nothing is recorded, so nothing can use the resource
+            callback();
+            return;
+        }
+
+        m_current->m_onComplete.emplace_back(std::move(callback));
+    }
+
+    void UploadContext::AddFileReads(Tools::FileReadTicket ticket, std::function<void()> onFailed) {
+        std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+        if (!GetCmd()) {
+            VK_ERROR("UploadContext::AddFileReads() : failed to get command buffer!");
+            return;
+        }
+
+        m_current->m_fileReads.emplace_back(FileRead { ticket, std::move(onFailed) });
+    }
+
+    void UploadContext::SetFileReader(Tools::AsyncFileReader* pReader) {
+        std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+        m_fileReader = pReader;
+
+        if (m_fileReader && m_staging) {
+            m_fileReader->RegisterBuffer(m_staging->GetMappedData(), m_staging->GetSize());
+        }
+    }
+
+    UploadTicket UploadContext::Submit() {
+        std::unique_lock<std::recursive_mutex> lock(m_mutex);
+
+        if (!m_current) {
+            return m_lastSubmitted;
+        }
+
+        Batch* pBatch = m_current;
+        m_current = nullptr;
+
+        const UploadTicket ticket = pBatch->m_ticket;
+
+        /// the batch isn't recorded anymore, but it can't be submitted before the previous ones
+        m_submitting.emplace_back(pBatch);
+
+        if (!pBatch->m_fileReads.empty()) {
+            const std::vector<FileRead> fileReads = std::move(pBatch->m_fileReads);
+            pBatch->m_fileReads.clear();
+
+            /// staging memory has to be written before it's flushed, reads are waited without the lock,
+            /// so other threads can record and submit meanwhile (it's still held if the caller has locked the context)
+            lock.unlock();
+
+            bool failed = false;
+
+            for (auto&& read : fileReads) {
+                if (m_fileReader->Wait(read.m_ticket)) {
+                    continue;
+                }
+
+                VK_ERROR("UploadContext::Submit() : failed to read file into staging memory! Ticket: " + std::to_string(read.m_ticket));
+
+                failed = true;
+
+                if (read.m_onFailed) {
+                    read.m_onFailed();
+                }
+            }
+
+            lock.lock();
+
+            pBatch->m_failed = failed;
+        }
+
+        pBatch->m_ready = true;
+
+        const bool submitted = SubmitReady(ticket);
+
+        Collect();
+
+        return submitted ? ticket : 0;
+    }
+
+    bool UploadContext::SubmitReady(UploadTicket ticket) {
+        bool result = true;
+
+        while (!m_submitting.empty() && m_submitting.front()->m_ready) {
+            Batch* pBatch = m_submitting.front();
+            m_submitting.pop_front();
+
+            const UploadTicket batchTicket = pBatch->m_ticket;
+
+            if (!SubmitBatch(pBatch) && batchTicket == ticket) {
+                result = false;
+            }
+        }
+
+        m_submitCondition.notify_all();
+
+        return result;
+    }
+
+    bool UploadContext::SubmitBatch(Batch* pBatch) {
+        if (!pBatch->m_regions.empty()) {
+            m_staging->Flush();
+        }
+
+        for (auto&& pSpill : pBatch->m_spills) {
+            pSpill->Flush();
+        }
+
+        vkEndCommandBuffer(*pBatch->m_cmd);
+        pBatch->m_cmd->m_isBegin = false;
+
+        if (pBatch->m_graphicsUsed) {
+            vkEndCommandBuffer(*pBatch->m_graphicsCmd);
+            pBatch->m_graphicsCmd->m_isBegin = false;
+        }
+
+        VkSubmitInfo submitInfo = Tools::Initializers::SubmitInfo();
+        submitInfo.commandBufferCount = 1;
+        submitInfo.pCommandBuffers = pBatch->m_cmd->GetCmdRef();
+
+        /// upload part signals timeline with value of the ticket
+        VkTimelineSemaphoreSubmitInfo timelineInfo = {};
+        timelineInfo.sType                     = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+        timelineInfo.signalSemaphoreValueCount = 1;
+        timelineInfo.pSignalSemaphoreValues    = &pBatch->m_ticket;
+
+        if (IsAsync()) {
+            submitInfo.pNext                = &timelineInfo;
+            submitInfo.signalSemaphoreCount = 1;
+            submitInfo.pSignalSemaphores    = &m_timeline;
+        }
+
+        /// if there is graphics part, it's the last one and signals the fence
+        auto&& result = m_device->GetQueues()->Submit(m_queue, 1, &submitInfo, pBatch->m_graphicsUsed ? VK_NULL_HANDLE : pBatch->m_fence);
+        if (result != VK_SUCCESS) {
+            VK_ERROR("UploadContext::SubmitBatch() : failed to submit batch! Reason: " + Tools::Convert::result_to_description(result));
+            ReleaseBatch(pBatch);
+            return false;
+        }
+
+        if (pBatch->m_graphicsUsed) {
+            const VkPipelineStageFlags waitStage = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+
+            VkTimelineSemaphoreSubmitInfo graphicsTimelineInfo = {};
+            graphicsTimelineInfo.sType                   = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+            graphicsTimelineInfo.waitSemaphoreValueCount = 1;
+            graphicsTimelineInfo.pWaitSemaphoreValues    = &pBatch->m_ticket;
+
+            VkSubmitInfo graphicsSubmitInfo = Tools::Initializers::SubmitInfo();
+            graphicsSubmitInfo.pNext              = &graphicsTimelineInfo;
+            graphicsSubmitInfo.waitSemaphoreCount = 1;
+            graphicsSubmitInfo.pWaitSemaphores    = &m_timeline;
+            graphicsSubmitInfo.pWaitDstStageMask  = &waitStage;
+            graphicsSubmitInfo.commandBufferCount = 1;
+            graphicsSubmitInfo.pCommandBuffers    = pBatch->m_graphicsCmd->GetCmdRef();
+
+            if ((result = m_device->GetQueues()->Submit(m_graphicsQueue, 1, &graphicsSubmitInfo, pBatch->m_fence)) != VK_SUCCESS) {
+                VK_ERROR("UploadContext::SubmitBatch() : failed to submit graphics part of batch! Reason: " + Tools::Convert::result_to_description(result));
+                /// upload part is already in queue, staging data can't be released before it's complete
+                WaitTimeline(pBatch->m_ticket);
+                ReleaseBatch(pBatch);
+                return false;
+            }
+        }
+
+        m_lastSubmitted = pBatch->m_ticket;
+        m_pending.emplace_back(pBatch);
+
+        return true;
+    }
+
+    bool UploadContext::IsSubmitting(UploadTicket ticket) const {
+        return std::any_of(m_submitting.begin(), m_submitting.end(), [ticket](Batch* pBatch) {
+            return pBatch->m_ticket == ticket;
+        });
+    }
+
+    bool UploadContext::Wait(UploadTicket ticket) {
+        std::unique_lock<std::recursive_mutex> lock(m_mutex);
+
+        if (ticket == 0) {
+            return true;
+        }
+
+        if (m_current && m_current->m_ticket == ticket) {
+            Submit();
+        }
+
+        /// reads of the batch or of the previous ones are waited by other threads
+        m_submitCondition.wait(lock, [this, ticket]() { return !IsSubmitting(ticket); });
+
+        bool result = true;
+
+        for (auto&& pBatch : m_pending) {
+            if (pBatch->m_ticket == ticket) {
+                result = WaitBatch(pBatch) && !pBatch->m_failed;
+                break;
+            }
+        }
+
+        Collect();
+
+        return result;
+    }
+
+    bool UploadContext::WaitIdle() {
+        std::unique_lock<std::recursive_mutex> lock(m_mutex);
+
+        Submit();
+
+        m_submitCondition.wait(lock, [this]() { return m_submitting.empty(); });
+
+        bool result = true;
+
+        for (auto&& pBatch : m_pending) {
+            result &= WaitBatch(pBatch) && !pBatch->m_failed;
+        }
+
+        Collect();
+
+        return result;
+    }
+
+    bool UploadContext::IsComplete(UploadTicket ticket) {
+        std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+        if (ticket == 0) {
+            return true;
+        }
+
+        if ((m_current && m_current->m_ticket == ticket) || IsSubmitting(ticket)) {
+            return false;
+        }
+
+        for (auto&& pBatch : m_pending) {
+            if (pBatch->m_ticket == ticket) {
+                return vkGetFenceStatus(*m_device, pBatch->m_fence) == VK_SUCCESS;
+            }
+        }
+
+        return true;
+    }
+
+    void UploadContext::Collect() {
+        std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+        for (auto pIt = m_pending.begin(); pIt != m_pending.end(); ) {
+            if (vkGetFenceStatus(*m_device, (*pIt)->m_fence) != VK_SUCCESS) {
+                ++pIt;
+                continue;
+            }
+
+            ReleaseBatch(*pIt);
+            pIt = m_pending.erase(pIt);
+        }
+    }
+
+    UploadContext::Batch* UploadContext::AcquireBatch() {
+        if (!m_free.empty()) {
+            Batch* pBatch = m_free.back();
+            m_free.pop_back();
+            return pBatch;
+        }
+
+        auto&& pBatch = new Batch();
+
+        if (!(pBatch->m_cmd = CmdBuffer::Create(m_device, m_pool, VK_COMMAND_BUFFER_LEVEL_PRIMARY))) {
+            VK_ERROR("UploadContext::AcquireBatch() : failed to create command buffer!");
+            delete pBatch;
+            return nullptr;
+        }
+
+        pBatch->m_cmd->m_batched = true;
+
+        if (IsAsync()) {
+            if (!(pBatch->m_graphicsCmd = CmdBuffer::Create(m_device, m_graphicsPool, VK_COMMAND_BUFFER_LEVEL_PRIMARY))) {
+                VK_ERROR("UploadContext::AcquireBatch() : failed to create graphics command buffer!");
+                delete pBatch->m_cmd;
+                delete pBatch;
+                return nullptr;
+            }
+
+            pBatch->m_graphicsCmd->m_batched = true;
+        }
+
+        VkFenceCreateInfo fenceCreateInfo = Tools::Initializers::FenceCreateInfo();
+        if (vkCreateFence(*m_device, &fenceCreateInfo, nullptr, &pBatch->m_fence) != VK_SUCCESS) {
+            VK_ERROR("UploadContext::AcquireBatch() : failed to create fence!");
+            delete pBatch->m_cmd;
+            delete pBatch->m_graphicsCmd;
+            delete pBatch;
+            return nullptr;
+        }
+
+        return pBatch;
+    }
+
+    void UploadContext::ReleaseBatch(Batch* pBatch) {
+        for (auto&& callback : pBatch->m_onComplete) {
+            callback();
+        }
+        pBatch->m_onComplete.clear();
+
+        for (auto&& region : pBatch->m_regions) {
+            m_staging->Free(region);
+        }
+        pBatch->m_regions.clear();
+
+        for (auto&& pSpill : pBatch->m_spills) {
+            pSpill->Unmap();
+            delete pSpill;
+        }
+        pBatch->m_spills.clear();
+
+        vkResetFences(*m_device, 1, &pBatch->m_fence);
+        pBatch->m_ticket = 0;
+        pBatch->m_graphicsUsed = false;
+        pBatch->m_ready = false;
+        pBatch->m_failed = false;
+        pBatch->m_fileReads.clear();
+
+        m_free.emplace_back(pBatch);
+    }
+
+    bool UploadContext::WaitBatch(Batch* pBatch) {
+        auto&& result = vkWaitForFences(*m_device, 1, &pBatch->m_fence, VK_TRUE, UINT64_MAX);
+        if (result != VK_SUCCESS) {
+            VK_ERROR("UploadContext::WaitBatch() : failed to wait fence! Reason: " + Tools::Convert::result_to_description(result));
+            return false;
+        }
+
+        return true;
+    }
+
+    bool UploadContext::WaitTimeline(UploadTicket ticket) {
+        VkSemaphoreWaitInfo waitInfo = {};
+        waitInfo.sType          = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+        waitInfo.semaphoreCount = 1;
+        waitInfo.pSemaphores    = &m_timeline;
+        waitInfo.pValues        = &ticket;
+
+        auto&& result = vkWaitSemaphores(*m_device, &waitInfo, UINT64_MAX);
+        if (result != VK_SUCCESS) {
+            VK_ERROR("UploadContext::WaitTimeline() : failed to wait semaphore! Reason: " + Tools::Convert::result_to_description(result));
+            return false;
+        }
+
+        return true;
+    }
+}
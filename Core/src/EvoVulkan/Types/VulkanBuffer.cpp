@@ -142,6 +142,9 @@ namespace EvoVulkan::Types {
         buffer->m_device = device;
         buffer->m_allocator = allocator;
 
+        /// device address of the buffer is written into descriptor buffer
+        usageFlags = allocator->GetBufferUsage(usageFlags);
+
         // Create the buffer handle
         VkBufferCreateInfo bufferCreateInfo = Tools::Initializers::BufferCreateInfo(usageFlags, size);
         auto result = vkCreateBuffer(*device, &bufferCreateInfo, nullptr, &buffer->m_buffer);
@@ -192,6 +192,30 @@ bool EvoVulkan::Core::VulkanKernel::Init(
         return false;
     }
 
+    //!==========================================[Create upload context]================================================
+
+    if (auto&& pQueues = m_device->GetQueues(); pQueues->HasDedicatedTransfer() && m_device->IsTimelineSemaphoreSupported()) {
+        /// copies are overlapped with rendering, graphics queue only acquires uploaded resources
+        m_uploadContext = Types::UploadContext::Create(m_device,
+            pQueues->GetTransferIndex(), pQueues->GetTransferQueue(),
+            pQueues->GetGraphicsIndex(), pQueues->GetGraphicsQueue()
+        );
+    }
+
+    if (!m_uploadContext) {
+        m_uploadContext = Types::UploadContext::Create(m_device);
+    }
+
+    if (!m_uploadContext) {
+        VK_ERROR("VulkanKernel::Init() : failed to create upload context!");
+        return false;
+    }
+
+    if (!m_uploadContext->InitStaging(m_allocator, m_stagingSize)) {
+        VK_ERROR("VulkanKernel::Init() : failed to initialize staging memory!");
+        return false;
+    }
+
     //!=============================================[Create swapchain]==================================================
 
     VK_GRAPH("VulkanKernel::Init() : creating vulkan swapchain with sizes: width = " +
@@ -243,35 +267,40 @@ bool EvoVulkan::Core::VulkanKernel::PostInit() {
 
     VK_GRAPH("VulkanKernel::PostInit() : allocate draw command buffers...");
 
-    m_countDCB = m_swapchain ? m_swapchain->GetCountImages() : 0;
-
-    if (m_countDCB > 0) {
-        m_drawCmdBuffs = Tools::AllocateCommandBuffers(
-            *m_device,
-            Tools::Initializers::CommandBufferAllocateInfo(
-                *m_cmdPool,
-                VK_COMMAND_BUFFER_LEVEL_PRIMARY,
-                m_countDCB
-            )
-        );
-
-        if (!m_drawCmdBuffs) {
-            VK_ERROR("Vulkan::PostInit() : failed to allocate draw command buffers!");
-            return false;
-        }
+    if (!AllocateDrawCmdBuffers()) {
+        VK_ERROR("Vulkan::PostInit() : failed to allocate draw command buffers!");
+        return false;
     }
 
     //!=================================================================================================================
 
-    if (m_countDCB > 0) {
-        VK_GRAPH("VulkanKernel::PostInit() : creating wait fences...");
-        m_waitFences = Tools::CreateFences(*m_device, m_countDCB);
-        if (m_waitFences.empty()) {
-            VK_ERROR("VulkanKernel::PostInit() : failed to create wait fences!");
+    VK_GRAPH("VulkanKernel::PostInit() : allocate frame command buffers... Frames in flight: " + std::to_string(m_framesInFlight));
+
+    m_frameCmdBuffs = Tools::AllocateCommandBuffers(
+        *m_device,
+        Tools::Initializers::CommandBufferAllocateInfo(
+            *m_cmdPool,
+            VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+            m_framesInFlight
+        )
+    );
+
+    if (!m_frameCmdBuffs) {
+        VK_ERROR("VulkanKernel::PostInit() : failed to allocate frame command buffers!");
+        return false;
+    }
+
+    /// sets of descriptor buffer layouts can't be allocated from pools
+    if (!m_device->IsDescriptorBufferEnabled()) {
+        m_frameDescriptors = Core::FrameDescriptorAllocator::Create(m_device, m_framesInFlight);
+        if (!m_frameDescriptors) {
+            VK_ERROR("VulkanKernel::PostInit() : failed to create frame descriptor allocator!");
             return false;
         }
     }
 
+    m_descriptorManager->SetFramesInFlight(m_framesInFlight);
+
     //!=================================================================================================================
 
     if (m_swapchain) {
@@ -362,11 +391,15 @@ bool EvoVulkan::Core::VulkanKernel::Destroy() {
         m_device->WaitQueuesIdle();
     }
 
+    DestroyRetired(true /** force */);
+
     if (m_multisample) {
         m_multisample->Destroy();
         m_multisample->Free();
     }
 
+    EVSafeFreeObject(m_frameDescriptors);
+
     if (m_descriptorManager)
         m_descriptorManager->Free();
 
@@ -376,24 +409,22 @@ bool EvoVulkan::Core::VulkanKernel::Destroy() {
     if (m_pipelineCache)
         Tools::DestroyPipelineCache(*m_device, &m_pipelineCache);
 
-    if (m_syncs.IsReady()) {
-        Tools::DestroySynchronization(*m_device, &m_syncs);
-    }
+    DestroySynchronizations();
 
     if (m_renderPass.IsReady())
         Types::DestroyRenderPass(m_device, &m_renderPass);
 
-    if (!m_waitFences.empty()) {
-        Tools::DestroyFences(*m_device, m_waitFences);
-        m_waitFences.clear();
-    }
-
     if (m_drawCmdBuffs) {
         Tools::FreeCommandBuffers(*m_device, *m_cmdPool, &m_drawCmdBuffs, m_countDCB);
     }
 
+    if (m_frameCmdBuffs) {
+        Tools::FreeCommandBuffers(*m_device, *m_cmdPool, &m_frameCmdBuffs, m_framesInFlight);
+    }
+
     EVSafeFreeObject(m_swapchain);
     EVSafeFreeObject(m_surface);
+    EVSafeFreeObject(m_uploadContext);
     EVSafeFreeObject(m_cmdPool);
     EVSafeFreeObject(m_allocator);
     EVSafeFreeObject(m_device);
@@ -417,20 +448,40 @@ bool EvoVulkan::Core::VulkanKernel::ReCreateFrameBuffers() {
 
     VK_GRAPH("VulkanKernel::ReCreateFrameBuffers() : re-creating vulkan frame buffers...");
 
-    if (!m_renderPass.IsReady()) {
-        VK_ERROR("VulkanKernel::ReCreateFrameBuffers() : render pass is nullptr!");
-        return false;
-    }
-
     const uint32_t width = m_swapchain->GetSurfaceWidth();
     const uint32_t height = m_swapchain->GetSurfaceHeight();
 
-    m_multisample->SetSampleCount(GetSampleCount());
-    m_multisample->ReCreate(width, height);
+    /// after ReCreate the previous target is retired, so a new one is created
+    if (m_multisample) {
+        m_multisample->SetSampleCount(GetSampleCount());
+        m_multisample->ReCreate(width, height);
+    }
+    else {
+        m_multisample = Types::MultisampleTarget::Create(
+            m_device,
+            m_allocator,
+            m_cmdPool,
+            m_swapchain,
+            width,
+            height,
+            { m_swapchain->GetColorFormat() },
+            GetSampleCount(),
+            1 /** layers count */,
+            VK_IMAGE_ASPECT_STENCIL_BIT | VK_IMAGE_ASPECT_DEPTH_BIT,
+            m_device->GetDepthFormat()
+        );
+
+        if (!m_multisample) {
+            VK_ERROR("VulkanKernel::ReCreateFrameBuffers() : failed to create multisample!");
+            return false;
+        }
+    }
 
     DestroyFrameBuffers();
 
-    Types::DestroyRenderPass(m_device, &m_renderPass);
+    if (m_renderPass.IsReady()) {
+        Types::DestroyRenderPass(m_device, &m_renderPass);
+    }
 
     m_renderPass = Types::CreateRenderPass(
         m_device,
@@ -442,6 +493,11 @@ bool EvoVulkan::Core::VulkanKernel::ReCreateFrameBuffers() {
         m_device->GetDepthFormat()
     );
 
+    if (!m_renderPass.IsReady()) {
+        VK_ERROR("VulkanKernel::ReCreateFrameBuffers() : failed to create render pass!");
+        return false;
+    }
+
     /// -----------------------------------------------------------------
 
     std::vector<VkImageView> attachments = {};
@@ -504,33 +560,80 @@ EvoVulkan::Core::FrameResult EvoVulkan::Core::VulkanKernel::PrepareFrame() {
         return FrameResult::Dirty;
     }
 
+    /// uploads recorded since the previous frame are submitted before the frame which can use them
+    m_uploadContext->Submit();
+
+    if (m_resizePending) {
+        VK_LOG("VulkanKernel::PrepareFrame() : surface has been resized, swapchain can be re-created!");
+        /// nothing is acquired, the frame mustn't be submitted
+        return FrameResult::Skip;
+    }
+
+    /// Wait only for the frame slot we are going to reuse, other frames can still be in flight
+    VkResult result = vkWaitForFences(*m_device, 1, &m_syncs.m_inFlight, VK_TRUE, UINT64_MAX);
+    if (result != VK_SUCCESS) {
+        VK_ERROR("VulkanKernel::PrepareFrame() : failed to wait frame fence! Reason: " +
+            Tools::Convert::result_to_description(result));
+        return result == VK_ERROR_DEVICE_LOST ? FrameResult::DeviceLost : FrameResult::Error;
+    }
+
+    /// transient sets of the slot aren't used by GPU anymore
+    if (m_frameDescriptors) {
+        m_frameDescriptors->BeginFrame(m_currentFrame);
+    }
+
+    /// the same for indices of removed bindless textures
+    if (auto&& pBindless = m_descriptorManager->GetBindlessTextures()) {
+        pBindless->NextFrame();
+    }
+
+    /// frames which used resources of the previous swapchains can be complete now
+    DestroyRetired(false /** force */);
+
     /// Acquire the next image from the swap chain
-    VkResult result = m_swapchain->AcquireNextImage(m_syncs.m_presentComplete, &m_currentBuffer);
+    result = m_swapchain->AcquireNextImage(m_syncs.m_presentComplete, &m_currentBuffer);
     /// Recreate the swapchain if it's no longer compatible with the surface (OUT_OF_DATE) or no longer optimal for presentation (SUBOPTIMAL)
     if (result == VK_ERROR_OUT_OF_DATE_KHR) {
         VK_LOG("VulkanKernel::PrepareFrame() : window has been resized!");
         return FrameResult::OutOfDate;
     }
-    else if (result == VK_SUBOPTIMAL_KHR) {
-        VK_LOG("VulkanKernel::PrepareFrame() : window has been suboptimal!");
-        return FrameResult::Suboptimal;
-    }
-    else if (result != VK_SUCCESS) {
+    else if (result != VK_SUCCESS && result != VK_SUBOPTIMAL_KHR) {
         VK_ERROR("VulkanKernel::PrepareFrame() : failed to acquire next image! Reason: " +
             Tools::Convert::result_to_description(result));
 
         return FrameResult::Error;
     }
 
+    /// Image can be acquired before the frame that rendered into it is complete (when images count > frames in flight)
+    if (m_currentBuffer < m_imageFences.size()) {
+        VkFence& imageFence = m_imageFences[m_currentBuffer];
+        if (imageFence != VK_NULL_HANDLE && imageFence != m_syncs.m_inFlight) {
+            vkWaitForFences(*m_device, 1, &imageFence, VK_TRUE, UINT64_MAX);
+        }
+        imageFence = m_syncs.m_inFlight;
+    }
+
+    /// Reset only after a successful acquire, otherwise the next wait would block forever
+    vkResetFences(*m_device, 1, &m_syncs.m_inFlight);
+
+    m_imageAcquired = true;
+
+    /// suboptimal image is acquired, so the frame has to be submitted and presented as usual
+    if (result == VK_SUBOPTIMAL_KHR) {
+        VK_LOG("VulkanKernel::PrepareFrame() : window has been suboptimal!");
+        return FrameResult::Suboptimal;
+    }
+
     return FrameResult::Success;
 }
 
 EvoVulkan::Core::FrameResult EvoVulkan::Core::VulkanKernel::QueuePresent() {
-    /// TODO: здесь может зависнуть, нужно придумать способ перехвата
-    VkResult result = vkQueueWaitIdle(m_device->GetQueues()->GetGraphicsQueue());
+    /// Empty submission signals the fence when all previously submitted work of the frame is complete,
+    /// so the client can submit frame without knowledge about the frame fence
+    VkResult result = m_device->GetQueues()->Submit(m_device->GetQueues()->GetGraphicsQueue(), 0, nullptr, m_syncs.m_inFlight);
 
     if (result != VK_SUCCESS) {
-        VK_ERROR("VulkanKernel::SubmitFrame() : failed to queue wait idle! Reason: " +
+        VK_ERROR("VulkanKernel::QueuePresent() : failed to submit frame fence! Reason: " +
                  Tools::Convert::result_to_description(result));
 
         if (result == VK_ERROR_DEVICE_LOST)
@@ -544,6 +647,11 @@ EvoVulkan::Core::FrameResult EvoVulkan::Core::VulkanKernel::QueuePresent() {
 
 EvoVulkan::Core::FrameResult EvoVulkan::Core::VulkanKernel::WaitIdle() {
     VkResult result = m_swapchain->QueuePresent(m_device->GetQueues()->GetGraphicsQueue(), m_currentBuffer, m_syncs.m_renderComplete);
+    m_imageAcquired = false;
+
+    /// the frame is submitted in any case, go to the next slot
+    SelectFrame((m_currentFrame + 1) % m_framesInFlight);
+    ++m_frameNumber;
 
     if (!((result == VK_SUCCESS) || (result == VK_SUBOPTIMAL_KHR))) {
         if (result == VK_ERROR_OUT_OF_DATE_KHR) {
@@ -577,56 +685,62 @@ EvoVulkan::Core::FrameResult EvoVulkan::Core::VulkanKernel::SubmitFrame() {
 bool EvoVulkan::Core::VulkanKernel::ReCreate(FrameResult reason) {
     VK_LOG("VulkanKernel::ReCreate() : re-creating vulkan kernel...");
 
-    if (reason == FrameResult::OutOfDate || reason == FrameResult::Suboptimal) {
-        VK_INFO("VulkanKernel::ReCreate() : waiting for a change in the size of the client window...");
-
-        /// ждем пока управляющая сторона передаст размеры окна, иначе будет рассинхрон
-        while (true) {
-            std::lock_guard<std::recursive_mutex> lock(m_mutex);
-
-            PollWindowEvents();
-
-            if (!IsWindowValid()) {
-                VK_LOG("VulkanKernel::ReCreate() : window was closed.");
-                break;
-            }
-
-            if (m_newWidth != -1 && m_newHeight != -1) {
-                break;
-            }
-        }
+    if (!m_isPostInitialized) {
+        VK_ERROR("VulkanKernel::ReCreate() : kernel is not ready!");
+        return false;
+    }
 
+    if (reason == FrameResult::OutOfDate || reason == FrameResult::Suboptimal || reason == FrameResult::Skip) {
         std::lock_guard<std::recursive_mutex> lock(m_mutex);
 
-        VK_LOG("VulkanKernel::ReCreate() : set new sizes: width = " +
-               std::to_string(m_newWidth) + "; height = " + std::to_string(m_newHeight));
+        /// sizes of the window event are used if they are received,
+        /// otherwise the surface reports its new extent by itself
+        if (m_newWidth != -1 && m_newHeight != -1) {
+            VK_LOG("VulkanKernel::ReCreate() : set new sizes: width = " +
+                   std::to_string(m_newWidth) + "; height = " + std::to_string(m_newHeight));
 
-        if (!m_isPostInitialized) {
-            VK_ERROR("VulkanKernel::ReCreate() : kernel is not ready!");
-            return false;
-        }
-
-        vkDeviceWaitIdle(*m_device);
+            m_width = m_newWidth;
+            m_height = m_newHeight;
 
-        m_width = m_newWidth;
-        m_height = m_newHeight;
+            m_newWidth = -1;
+            m_newHeight = -1;
+        }
 
-        m_newWidth = -1;
-        m_newHeight = -1;
+        m_resizePending = false;
     }
-    else {
-        vkDeviceWaitIdle(*m_device);
+
+    /// image acquired by this frame won't be presented, its semaphore mustn't stay signaled
+    if (m_imageAcquired && !ReleaseAcquiredImage()) {
+        VK_ERROR("VulkanKernel::ReCreate() : failed to release acquired image!");
+        return false;
     }
 
     if (!m_swapchain->SurfaceIsAvailable()) {
+        /// window is collapsed, the next frame is skipped and re-creation is tried again
+        m_resizePending = true;
         return true;
     }
 
+    /// old swapchain is passed as oldSwapchain and retired, frames in flight can still present its images
     if (!m_swapchain->ReSetup(m_width, m_height, m_swapchainImages)) {
         VK_ERROR("VulkanKernel::ReCreate() : failed to re-setup swapchain!");
         return false;
     }
 
+    m_width = m_swapchain->GetSurfaceWidth();
+    m_height = m_swapchain->GetSurfaceHeight();
+
+    /// resources of the old swapchain are destroyed by PrepareFrame when the slot fences of its frames are signaled
+    RetireFrameResources();
+
+    if (!AllocateDrawCmdBuffers()) {
+        VK_ERROR("VulkanKernel::ReCreate() : failed to allocate draw command buffers!");
+        return false;
+    }
+
+    /// images of the new swapchain weren't used by any frame, sync objects of the frame slots are kept
+    m_imageFences.assign(m_countDCB, VK_NULL_HANDLE);
+
     if (!ReCreateFrameBuffers()) {
         VK_ERROR("VulkanKernel::ReCreate() : failed to re-create frame buffers!");
         return false;
@@ -638,12 +752,6 @@ bool EvoVulkan::Core::VulkanKernel::ReCreate(FrameResult reason) {
         return false;
     }
 
-    VK_GRAPH("VulkanKernel::ReCreate() : re-creating synchronizations...");
-    if (!ReCreateSynchronizations()) {
-        VK_ERROR("VulkanKernel::ReCreate() : failed to re-create synchronizations!");
-        return false;
-    }
-
     if (!BuildCmdBuffers()) {
         VK_ERROR("VulkanKernel::ReCreate() : failed to build command buffer!");
         return false;
@@ -681,6 +789,11 @@ void EvoVulkan::Core::VulkanKernel::SetSize(uint32_t width, uint32_t height)  {
     m_newWidth  = width;
     m_newHeight = height;
 
+    /// window event drives the re-creation, the next frame is skipped instead of waiting for out of date
+    if (m_isPostInitialized && (width != m_width || height != m_height)) {
+        m_resizePending = true;
+    }
+
     bool oldPause = m_paused;
     m_paused = m_newHeight == 0 || m_newWidth == 0;
     if (oldPause != m_paused) {
@@ -712,16 +825,22 @@ void EvoVulkan::Core::VulkanKernel::SetGUIEnabled(bool enabled)
 }
 
 bool EvoVulkan::Core::VulkanKernel::ReCreateSynchronizations() {
-    if (m_syncs.IsReady()) {
-        Tools::DestroySynchronization(*m_device, &m_syncs);
-    }
+    DestroySynchronizations();
 
-    m_syncs = Tools::CreateSynchronization(*m_device);
-    if (!m_syncs.IsReady()) {
-        VK_ERROR("VulkanKernel::ReCreateSynchronizations() : failed to create synchronizations!");
-        return false;
+    for (uint32_t i = 0; i < m_framesInFlight; ++i) {
+        auto&& sync = Tools::CreateSynchronization(*m_device);
+        if (!sync.IsReady()) {
+            VK_ERROR("VulkanKernel::ReCreateSynchronizations() : failed to create synchronizations!");
+            return false;
+        }
+        m_frameSyncs.emplace_back(sync);
     }
 
+    m_imageFences.assign(m_countDCB, VK_NULL_HANDLE);
+
+    m_currentFrame = 0;
+    m_syncs = m_frameSyncs.front();
+
     /// Set up submit info structure
     /// Semaphores will stay the same during application lifetime
     /// Command buffer submission info is set by each example
@@ -732,6 +851,173 @@ bool EvoVulkan::Core::VulkanKernel::ReCreateSynchronizations() {
     return true;
 }
 
+void EvoVulkan::Core::VulkanKernel::DestroySynchronizations() {
+    for (auto&& sync : m_frameSyncs) {
+        if (sync.IsReady()) {
+            Tools::DestroySynchronization(*m_device, &sync);
+        }
+    }
+
+    m_frameSyncs.clear();
+    m_imageFences.clear();
+
+    m_syncs = Types::Synchronization();
+}
+
+void EvoVulkan::Core::VulkanKernel::SelectFrame(uint32_t frame) {
+    const Types::Synchronization previous = m_syncs;
+
+    m_currentFrame = frame;
+    m_syncs = m_frameSyncs[m_currentFrame];
+
+    /// submit infos was built with semaphores of the previous slot, move them to the new one
+    auto&& remap = [&previous, this](std::vector<VkSemaphore>& semaphores) {
+        for (auto&& semaphore : semaphores) {
+            if (semaphore == previous.m_presentComplete) {
+                semaphore = m_syncs.m_presentComplete;
+            }
+            else if (semaphore == previous.m_renderComplete) {
+                semaphore = m_syncs.m_renderComplete;
+            }
+        }
+    };
+
+    for (auto&& submitInfo : m_submitQueue) {
+        remap(submitInfo.waitSemaphores);
+        remap(submitInfo.signalSemaphores);
+    }
+
+    remap(m_submitInfo.waitSemaphores);
+    remap(m_submitInfo.signalSemaphores);
+}
+
+bool EvoVulkan::Core::VulkanKernel::ReleaseAcquiredImage() {
+    const VkPipelineStageFlags waitStage = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+
+    /// empty submission waits the semaphore and signals the fence which was reset by PrepareFrame
+    VkSubmitInfo submitInfo = {};
+    submitInfo.sType              = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submitInfo.waitSemaphoreCount = 1;
+    submitInfo.pWaitSemaphores    = &m_syncs.m_presentComplete;
+    submitInfo.pWaitDstStageMask  = &waitStage;
+
+    VkResult result = m_device->GetQueues()->Submit(m_device->GetQueues()->GetGraphicsQueue(), 1, &submitInfo, m_syncs.m_inFlight);
+    if (result != VK_SUCCESS) {
+        VK_ERROR("VulkanKernel::ReleaseAcquiredImage() : failed to submit! Reason: " +
+            Tools::Convert::result_to_description(result));
+        return false;
+    }
+
+    m_imageAcquired = false;
+
+    return true;
+}
+
+bool EvoVulkan::Core::VulkanKernel::AllocateDrawCmdBuffers() {
+    m_countDCB = m_swapchain ? m_swapchain->GetCountImages() : 0;
+
+    if (m_countDCB == 0) {
+        return true;
+    }
+
+    m_drawCmdBuffs = Tools::AllocateCommandBuffers(
+        *m_device,
+        Tools::Initializers::CommandBufferAllocateInfo(
+            *m_cmdPool,
+            VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+            m_countDCB
+        )
+    );
+
+    return m_drawCmdBuffs != nullptr;
+}
+
+void EvoVulkan::Core::VulkanKernel::RetireFrameResources() {
+    RetiredFrameResources retired;
+
+    retired.m_frame        = m_frameNumber;
+    retired.m_frameBuffers = std::move(m_frameBuffers);
+    retired.m_renderPass   = m_renderPass;
+    retired.m_multisample  = m_multisample;
+    retired.m_drawCmdBuffs = m_drawCmdBuffs;
+    retired.m_countDCB     = m_countDCB;
+
+    m_frameBuffers.clear();
+    m_renderPass   = { };
+    m_multisample  = nullptr;
+    m_drawCmdBuffs = nullptr;
+    m_countDCB     = 0;
+
+    m_retired.emplace_back(std::move(retired));
+}
+
+void EvoVulkan::Core::VulkanKernel::DestroyRetired(bool force) {
+    while (!m_retired.empty()) {
+        auto&& retired = m_retired.front();
+
+        /// slot fence of the current frame is waited, so all frames before (m_frameNumber - m_framesInFlight) are complete
+        if (!force && m_frameNumber < retired.m_frame + m_framesInFlight) {
+            break;
+        }
+
+        for (auto&& frameBuffer : retired.m_frameBuffers) {
+            vkDestroyFramebuffer(*m_device, frameBuffer, nullptr);
+        }
+
+        if (retired.m_renderPass.IsReady()) {
+            Types::DestroyRenderPass(m_device, &retired.m_renderPass);
+        }
+
+        if (retired.m_multisample) {
+            retired.m_multisample->Destroy();
+            retired.m_multisample->Free();
+        }
+
+        if (retired.m_drawCmdBuffs) {
+            Tools::FreeCommandBuffers(*m_device, *m_cmdPool, &retired.m_drawCmdBuffs, retired.m_countDCB);
+        }
+
+        /// every re-creation retires exactly one swapchain
+        if (m_swapchain) {
+            m_swapchain->DestroyRetired(1);
+        }
+
+        m_retired.erase(m_retired.begin());
+    }
+}
+
+bool EvoVulkan::Core::VulkanKernel::SetFramesInFlight(uint32_t count) {
+    if (m_isPostInitialized) {
+        VK_ERROR("VulkanKernel::SetFramesInFlight() : at this stage it is not possible to set this parameter!");
+        return false;
+    }
+
+    if (count == 0) {
+        VK_ERROR("VulkanKernel::SetFramesInFlight() : frames count must be greater than zero!");
+        return false;
+    }
+
+    m_framesInFlight = count;
+
+    return true;
+}
+
+bool EvoVulkan::Core::VulkanKernel::SetStagingSize(VkDeviceSize size) {
+    if (m_uploadContext) {
+        VK_ERROR("VulkanKernel::SetStagingSize() : at this stage it is not possible to set this parameter!");
+        return false;
+    }
+
+    if (size == 0) {
+        VK_ERROR("VulkanKernel::SetStagingSize() : size must be greater than zero!");
+        return false;
+    }
+
+    m_stagingSize = size;
+
+    return true;
+}
+
 bool EvoVulkan::Core::VulkanKernel::SetValidationLayersEnabled(bool value) {
     if (m_isPreInitialized) {
         VK_ERROR("VulkanKernel::SetValidationLayersEnabled() : at this stage it is not possible to set this parameter!");
@@ -768,6 +1054,19 @@ EvoVulkan::Types::CmdBuffer *EvoVulkan::Core::VulkanKernel::CreateCmd() const {
     return Types::CmdBuffer::Create(m_device, m_cmdPool, VK_COMMAND_BUFFER_LEVEL_PRIMARY);
 }
 
+EvoVulkan::Types::CmdRecorder* EvoVulkan::Core::VulkanKernel::CreateCmdRecorder(uint32_t threadsCount) const {
+    return Types::CmdRecorder::Create(m_device, threadsCount);
+}
+
+VkCommandBufferInheritanceInfo EvoVulkan::Core::VulkanKernel::GetInheritanceInfo(uint32_t imageIndex) const {
+    VkCommandBufferInheritanceInfo inheritanceInfo = {};
+    inheritanceInfo.sType       = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+    inheritanceInfo.renderPass  = m_renderPass.m_self;
+    inheritanceInfo.subpass     = 0;
+    inheritanceInfo.framebuffer = imageIndex < m_frameBuffers.size() ? m_frameBuffers[imageIndex] : VK_NULL_HANDLE;
+    return inheritanceInfo;
+}
+
 EvoVulkan::Types::CmdBuffer* EvoVulkan::Core::VulkanKernel::CreateSingleTimeCmd() const {
     return EvoVulkan::Types::CmdBuffer::BeginSingleTime(m_device, m_cmdPool);
 }
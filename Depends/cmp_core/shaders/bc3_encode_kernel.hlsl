@@ -38,9 +38,10 @@ cbuffer cbCS : register( b0 )
     uint  g_num_total_blocks;
     float g_alpha_weight;
     float g_quality;
+    uint  g_tex_height;
 };
 
-#include "BCn_Common_Kernel.h"
+#include "bcn_common_kernel.h"
 
 // Source Data
 Texture2D g_Input : register( t0 ); 
@@ -78,7 +79,7 @@ void EncodeBlocks(uint GI : SV_GroupIndex, uint3 groupID : SV_GroupID)
     if (pixelInBlock < 16)
     {
            // load pixels (0..1)
-           shared_temp[GI] = float4(g_Input.Load( uint3( base_x + pixelInBlock % 4, base_y + pixelInBlock / 4, 0 ) ));
+           shared_temp[GI] = float4(g_Input.Load( uint3( min(base_x + pixelInBlock % 4, g_tex_width - 1), min(base_y + pixelInBlock / 4, g_tex_height - 1), 0 ) ));
     }
 
     GroupMemoryBarrierWithGroupSync();
@@ -0,0 +1,158 @@
+//
+// Created by Monika on 18.10.2026.
+//
+
+#ifndef EVOVULKAN_DESCRIPTORSTRESSTEST_H
+#define EVOVULKAN_DESCRIPTORSTRESSTEST_H
+
+#include <EvoVulkan/DescriptorManager.h>
+#include <EvoVulkan/Types/Device.h>
+#include <EvoVulkan/Types/VmaBuffer.h>
+#include <EvoVulkan/Tools/VulkanDebug.h>
+
+#include <thread>
+#include <random>
+
+/**
+ * Allocates and frees descriptor sets of several layouts (so all shards are touched) and vma buffers
+ * from many threads at once, then checks that every set was valid and every pool was released.
+ * A part of sets is freed by other threads, so pools cached by a thread are freed concurrently with its allocations.
+ * Runs by "--test-descriptors" argument of EvoVulkanTest.
+ */
+inline bool RunDescriptorStressTest(
+        EvoVulkan::Types::Device* pDevice,
+        EvoVulkan::Memory::Allocator* pAllocator,
+        EvoVulkan::Core::DescriptorManager* pManager,
+        uint32_t threadsCount = 8,
+        uint32_t iterations = 200,
+        uint32_t setsPerIteration = 64)
+{
+    using namespace EvoVulkan;
+
+    constexpr uint32_t layoutsCount = 32;
+
+    std::vector<VkDescriptorSetLayout> layouts;
+
+    for (uint32_t i = 0; i < layoutsCount; ++i) {
+        VkDescriptorSetLayoutBinding binding = {};
+        binding.binding         = 0;
+        binding.descriptorType  = i % 2 == 0 ? VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER : VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        binding.descriptorCount = 1 + i % 4;
+        binding.stageFlags      = VK_SHADER_STAGE_ALL;
+
+        auto&& layout = pDevice->CreateDescriptorSetLayout({ binding });
+        if (layout == VK_NULL_HANDLE) {
+            VK_ERROR("RunDescriptorStressTest() : failed to create descriptor set layout!");
+            for (auto&& created : layouts) {
+                pDevice->DestroyDescriptorSetLayout(created);
+            }
+            return false;
+        }
+
+        layouts.emplace_back(layout);
+    }
+
+    const size_t poolsBefore = pManager->GetPoolsCount();
+
+    std::atomic<uint64_t> failures = 0;
+    std::atomic<uint64_t> allocated = 0;
+
+    /// sets passed between threads
+    std::vector<Types::DescriptorSet> exchange;
+    std::mutex exchangeMutex;
+
+    auto&& worker = [&](uint32_t seed) {
+        std::mt19937 random(seed);
+        std::vector<Types::DescriptorSet> sets;
+        sets.reserve(setsPerIteration);
+
+        for (uint32_t iteration = 0; iteration < iterations; ++iteration) {
+            for (uint32_t i = 0; i < setsPerIteration; ++i) {
+                const uint32_t index = random() % layoutsCount;
+
+                const Core::DescriptorManager::RequestTypes types = {
+                    index % 2 == 0 ? VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER : VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER
+                };
+
+                auto&& descriptorSet = pManager->AllocateDescriptorSet(layouts[index], types);
+                if (!descriptorSet.Valid()) {
+                    ++failures;
+                    continue;
+                }
+
+                sets.emplace_back(descriptorSet);
+                ++allocated;
+            }
+
+            /// buffers are created by loader threads alongside the render thread
+            if (iteration % 8 == 0) {
+                auto&& pBuffer = Types::VmaBuffer::Create(pAllocator, 256 + random() % 4096);
+                if (!pBuffer) {
+                    ++failures;
+                }
+                delete pBuffer;
+            }
+
+            /// sets are freed out of order, so pools are partially used and reused by other threads
+            std::shuffle(sets.begin(), sets.end(), random);
+
+            {
+                std::lock_guard<std::mutex> lock(exchangeMutex);
+                exchange.swap(sets);
+                sets.insert(sets.end(), exchange.begin() + (long)(exchange.size() / 2), exchange.end());
+                exchange.resize(exchange.size() / 2);
+            }
+
+            for (auto&& descriptorSet : sets) {
+                if (!pManager->FreeDescriptorSet(&descriptorSet)) {
+                    ++failures;
+                }
+            }
+
+            sets.clear();
+        }
+    };
+
+    std::vector<std::thread> threads;
+
+    for (uint32_t i = 0; i < threadsCount; ++i) {
+        threads.emplace_back(worker, i + 1);
+    }
+
+    for (auto&& thread : threads) {
+        thread.join();
+    }
+
+    for (auto&& descriptorSet : exchange) {
+        if (!pManager->FreeDescriptorSet(&descriptorSet)) {
+            ++failures;
+        }
+    }
+
+    pManager->TrimEmptyPools();
+
+    const size_t poolsAfter = pManager->GetPoolsCount();
+
+    for (auto&& layout : layouts) {
+        pDevice->DestroyDescriptorSetLayout(layout);
+    }
+
+    VK_LOG("RunDescriptorStressTest() : complete. \n\tThreads: " + std::to_string(threadsCount) +
+        "\n\tAllocated sets: " + std::to_string(allocated.load()) +
+        "\n\tFailures: " + std::to_string(failures.load()) +
+        "\n\tPools before: " + std::to_string(poolsBefore) + ", after: " + std::to_string(poolsAfter));
+
+    if (failures != 0) {
+        VK_ERROR("RunDescriptorStressTest() : some allocations or frees failed!");
+        return false;
+    }
+
+    if (poolsAfter > poolsBefore) {
+        VK_ERROR("RunDescriptorStressTest() : empty pools weren't released!");
+        return false;
+    }
+
+    return true;
+}
+
+#endif //EVOVULKAN_DESCRIPTORSTRESSTEST_H
@@ -138,33 +138,53 @@ public:
 
 public:
     Core::RenderResult Render() override {
-        if (PrepareFrame() == Core::FrameResult::OutOfDate) {
-            m_hasErrors = !ResizeWindow();
-            return Core::RenderResult::Success;
+        const auto prepareResult = PrepareFrame();
+
+        switch (prepareResult) {
+            case Core::FrameResult::Success:
+            case Core::FrameResult::Suboptimal:
+                break;
+            case Core::FrameResult::OutOfDate:
+            case Core::FrameResult::Skip:
+            case Core::FrameResult::Dirty:
+                /// image isn't acquired, nothing can be submitted
+                m_hasErrors = !ReCreate(prepareResult);
+                return Core::RenderResult::Success;
+            case Core::FrameResult::DeviceLost:
+                return Core::RenderResult::DeviceLost;
+            default:
+                return Core::RenderResult::Fatal;
         }
 
         m_submitInfo.commandBufferCount = 1;
 
+        /// offscreen pass has a command buffer and a semaphore per frame slot
+        m_offscreen->SetFrame(GetCurrentFrame());
+
         m_submitInfo.pWaitSemaphores    = &m_syncs.m_presentComplete;
-        m_submitInfo.pSignalSemaphores  = &m_offscreen->m_semaphore;
-        m_submitInfo.pCommandBuffers    = &m_offscreen->m_cmdBuff;
-        auto result = vkQueueSubmit(m_device->GetGraphicsQueue(), 1, &m_submitInfo, VK_NULL_HANDLE);
+        m_submitInfo.pSignalSemaphores  = m_offscreen->GetSemaphoreRef();
+        m_submitInfo.pCommandBuffers    = m_offscreen->GetCmdRef();
+        auto result = m_device->GetQueues()->Submit(m_device->GetQueues()->GetGraphicsQueue(), 1, &m_submitInfo, VK_NULL_HANDLE);
         if (result != VK_SUCCESS) {
             VK_ERROR("renderFunction() : failed to submit first queue!");
             return Core::RenderResult::Fatal;
         }
 
-        m_submitInfo.pWaitSemaphores    = &m_offscreen->m_semaphore;
+        m_submitInfo.pWaitSemaphores    = m_offscreen->GetSemaphoreRef();
         m_submitInfo.pSignalSemaphores  = &m_syncs.m_renderComplete;
         m_submitInfo.pCommandBuffers    = &m_drawCmdBuffs[m_currentBuffer];
-        result = vkQueueSubmit(m_device->GetGraphicsQueue(), 1, &m_submitInfo, VK_NULL_HANDLE);
+        result = m_device->GetQueues()->Submit(m_device->GetQueues()->GetGraphicsQueue(), 1, &m_submitInfo, VK_NULL_HANDLE);
         if (result != VK_SUCCESS) {
             VK_ERROR("renderFunction() : failed to submit second queue!");
             return Core::RenderResult::Fatal;
         }
 
         if (SubmitFrame() == Core::FrameResult::OutOfDate) {
-            m_hasErrors = !ResizeWindow();
+            m_hasErrors = !ReCreate(Core::FrameResult::OutOfDate);
+        }
+        else if (prepareResult == Core::FrameResult::Suboptimal) {
+            /// suboptimal image is presented, now swapchain can be re-created
+            m_hasErrors = !ReCreate(Core::FrameResult::Suboptimal);
         }
 
         return Core::RenderResult::Success;
@@ -754,11 +774,6 @@ public:
 
         VkRenderPassBeginInfo renderPassBeginInfo = m_offscreen->BeginRenderPass(&clearValues[0], clearValues.size());
 
-        m_offscreen->BeginCmd();
-        vkCmdBeginRenderPass(m_offscreen->GetCmd(), &renderPassBeginInfo, VK_SUBPASS_CONTENTS_INLINE);
-
-        m_offscreen->SetViewportAndScissor();
-
         for (auto & _mesh : meshes) {
             std::vector<VkWriteDescriptorSet> writeDescriptorSets = {
                     Tools::Initializers::WriteDescriptorSet(_mesh.m_descriptorSet.m_self, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 2,
@@ -767,20 +782,26 @@ public:
             vkUpdateDescriptorSets(*m_device, writeDescriptorSets.size(), writeDescriptorSets.data(), 0, NULL);
         }
 
-        {
+        /// commands are the same every frame, so every slot is recorded once
+        for (uint32_t frame = 0; frame < m_offscreen->GetFramesInFlight(); ++frame) {
+            m_offscreen->SetFrame(frame);
+
+            m_offscreen->BeginCmd();
+            vkCmdBeginRenderPass(m_offscreen->GetCmd(), &renderPassBeginInfo, VK_SUBPASS_CONTENTS_INLINE);
+
+            m_offscreen->SetViewportAndScissor();
+
             vkCmdBindPipeline(m_offscreen->GetCmd(), VK_PIPELINE_BIND_POINT_GRAPHICS, *m_geometry);
 
             for (auto & _mesh : meshes)
                 _mesh.Draw(m_offscreen->GetCmd(), m_geometry->GetPipelineLayout());
-        }
 
-        {
-            vkCmdBindPipeline(m_offscreen->m_cmdBuff, VK_PIPELINE_BIND_POINT_GRAPHICS, *m_skyboxShader);
+            vkCmdBindPipeline(m_offscreen->GetCmd(), VK_PIPELINE_BIND_POINT_GRAPHICS, *m_skyboxShader);
 
-            skybox.Draw(m_offscreen->m_cmdBuff, m_skyboxShader->GetPipelineLayout());
-        }
+            skybox.Draw(m_offscreen->GetCmd(), m_skyboxShader->GetPipelineLayout());
 
-        m_offscreen->End();
+            m_offscreen->End();
+        }
 
         UpdatePP();
 
@@ -884,8 +905,8 @@ public:
     }
 
     bool OnResize() override {
-        vkQueueWaitIdle(m_device->GetGraphicsQueue());
-        vkDeviceWaitIdle(*m_device);
+        /// offscreen frame buffer is re-created in place, so frames in flight which use it have to be complete
+        m_device->GetQueues()->WaitIdle(m_device->GetQueues()->GetGraphicsQueue());
 
         return m_offscreen ? (m_offscreen->ReCreate(m_width, m_height) && UpdatePP()) : true;
     }
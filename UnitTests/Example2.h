@@ -96,22 +96,38 @@ private:
     mesh meshes[3];
 public:
     Core::RenderResult Render() override {
-        if (this->PrepareFrame() == Core::FrameResult::OutOfDate)
-            this->m_hasErrors = !this->ResizeWindow();
+        const auto prepareResult = this->PrepareFrame();
+
+        switch (prepareResult) {
+            case Core::FrameResult::Success:
+            case Core::FrameResult::Suboptimal:
+                break;
+            case Core::FrameResult::OutOfDate:
+            case Core::FrameResult::Skip:
+            case Core::FrameResult::Dirty:
+                this->m_hasErrors = !this->ReCreate(prepareResult);
+                return Core::RenderResult::Success;
+            default:
+                return Core::RenderResult::Fatal;
+        }
 
         // Command buffer to be submitted to the queue
         m_submitInfo.commandBufferCount = 1;
         m_submitInfo.pCommandBuffers    = &m_drawCmdBuffs[m_currentBuffer];
 
         // Submit to queue
-        auto result = vkQueueSubmit(m_device->GetGraphicsQueue(), 1, &m_submitInfo, VK_NULL_HANDLE);
+        auto result = m_device->GetQueues()->Submit(m_device->GetQueues()->GetGraphicsQueue(), 1, &m_submitInfo, VK_NULL_HANDLE);
         if (result != VK_SUCCESS) {
             VK_ERROR("renderFunction() : failed to queue submit!");
-            return;
+            return Core::RenderResult::Fatal;
         }
 
         if (this->SubmitFrame() == Core::FrameResult::OutOfDate)
-            this->m_hasErrors = !this->ResizeWindow();
+            this->m_hasErrors = !this->ReCreate(Core::FrameResult::OutOfDate);
+        else if (prepareResult == Core::FrameResult::Suboptimal)
+            this->m_hasErrors = !this->ReCreate(Core::FrameResult::Suboptimal);
+
+        return Core::RenderResult::Success;
     }
 
     void UpdateUBO() {
@@ -414,9 +430,7 @@ public:
     }
 
     bool OnResize() override {
-        vkQueueWaitIdle(m_device->GetGraphicsQueue());
-        vkDeviceWaitIdle(*m_device);
-
+        /// nothing depends on the surface size, resources of the kernel are retired by itself
         return true;
     }
 };
@@ -0,0 +1,125 @@
+//
+// Created by Monika on 18.10.2026.
+//
+
+#ifndef EVOVULKAN_TEXTURELOADBENCHMARK_H
+#define EVOVULKAN_TEXTURELOADBENCHMARK_H
+
+#include <EvoVulkan/VulkanKernel.h>
+#include <EvoVulkan/Types/Texture.h>
+#include <EvoVulkan/Tools/TextureFile.h>
+#include <EvoVulkan/Tools/ThreadPool.h>
+#include <EvoVulkan/Tools/MipChain.h>
+
+#include <stbi.h>
+
+#include <chrono>
+#include <filesystem>
+
+/**
+ * Bakes the image into raw and LZ4 containers and compares their load time:
+ * decompression alone (TextureFile::Unpack into memory) and the whole Texture::Load
+ * through the upload context of the kernel until the batch is complete.
+ * Runs by "--bench-texture-load <image>" argument of EvoVulkanTest.
+ */
+inline bool RunTextureLoadBenchmark(EvoVulkan::Core::VulkanKernel* pKernel, const std::string& imagePath, uint32_t iterations = 20) {
+    using namespace EvoVulkan;
+    using Clock = std::chrono::steady_clock;
+
+    int width = 0, height = 0, channels = 0;
+    uint8_t* pixels = stbi_load(imagePath.c_str(), &width, &height, &channels, STBI_rgb_alpha);
+    if (!pixels) {
+        VK_ERROR("RunTextureLoadBenchmark() : failed to load image! \n\tPath: " + imagePath);
+        return false;
+    }
+
+    auto&& pThreadPool = Tools::ThreadPool::Create();
+
+    Tools::MipChain mipChain;
+    const bool generated = mipChain.Generate(pixels, VK_FORMAT_R8G8B8A8_UNORM, width, height, 0, pThreadPool);
+    stbi_image_free(pixels);
+
+    if (!generated) {
+        VK_ERROR("RunTextureLoadBenchmark() : failed to generate mip chain!");
+        delete pThreadPool;
+        return false;
+    }
+
+    const std::pair<Tools::TextureFile::Supercompression, std::string> variants[] = {
+        { Tools::TextureFile::Supercompression::None, "raw" },
+        { Tools::TextureFile::Supercompression::LZ4,  "lz4" },
+    };
+
+    bool result = true;
+
+    for (auto&& [compression, name] : variants) {
+        const std::string path = (std::filesystem::temp_directory_path() / ("EvoVulkanBenchmark." + name + ".evkt")).string();
+
+        if (!Tools::TextureFile::Save(path, mipChain, compression)) {
+            result = false;
+            break;
+        }
+
+        double unpackTime = 0.0;
+        double loadTime = 0.0;
+        VkDeviceSize storedSize = 0;
+        VkDeviceSize payloadSize = 0;
+
+        for (uint32_t i = 0; i < iterations && result; ++i) {
+            auto&& pFile = Tools::TextureFile::Open(path);
+            if (!pFile) {
+                result = false;
+                break;
+            }
+
+            storedSize = pFile->GetStoredSize();
+            payloadSize = pFile->GetPayloadSize();
+
+            std::vector<uint8_t> payload(payloadSize);
+
+            auto begin = Clock::now();
+            result &= pFile->Unpack(payload.data(), pThreadPool);
+            unpackTime += std::chrono::duration<double, std::milli>(Clock::now() - begin).count();
+
+            begin = Clock::now();
+
+            auto&& pTexture = Types::Texture::Load(pKernel->GetDevice(), pKernel->GetAllocator(), pKernel->GetDescriptorManager(),
+                pKernel->GetCmdPool(), *pFile, VK_FILTER_LINEAR, false, pKernel->GetUploadContext(), pThreadPool);
+
+            bool loaded = pTexture != nullptr;
+
+            if (pTexture && pKernel->GetUploadContext()) {
+                pKernel->GetUploadContext()->Submit();
+                /// background reads report failures only when the batch is waited
+                loaded &= pKernel->GetUploadContext()->WaitIdle() && !pTexture->IsLoadFailed();
+            }
+
+            loadTime += std::chrono::duration<double, std::milli>(Clock::now() - begin).count();
+
+            result &= loaded;
+
+            delete pTexture;
+            delete pFile;
+        }
+
+        std::filesystem::remove(path);
+
+        if (!result) {
+            VK_ERROR("RunTextureLoadBenchmark() : failed to load " + name + " container!");
+            break;
+        }
+
+        const double megabytes = static_cast<double>(payloadSize) / (1024.0 * 1024.0);
+
+        VK_LOG("RunTextureLoadBenchmark() : " + name + " container. \n\tStored size: " + std::to_string(storedSize) +
+            "\n\tPayload size: " + std::to_string(payloadSize) +
+            "\n\tUnpack: " + std::to_string(unpackTime / iterations) + " ms (" + std::to_string(megabytes * iterations * 1000.0 / unpackTime) + " MB/s)" +
+            "\n\tLoad: " + std::to_string(loadTime / iterations) + " ms (" + std::to_string(megabytes * iterations * 1000.0 / loadTime) + " MB/s)");
+    }
+
+    delete pThreadPool;
+
+    return result;
+}
+
+#endif //EVOVULKAN_TEXTURELOADBENCHMARK_H
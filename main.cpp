@@ -3,8 +3,20 @@
 //
 
 #include "UnitTests/Example.h"
+#include "UnitTests/DescriptorStressTest.h"
+#include "UnitTests/TextureLoadBenchmark.h"
 
-int main() {
+static bool HasArgument(int argc, char** argv, const std::string& argument) {
+    for (int i = 1; i < argc; ++i) {
+        if (argument == argv[i]) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+int main(int argc, char** argv) {
     auto* kernel = new VulkanExample();
 
     auto printMemory = [kernel]() -> std::string {
@@ -106,6 +118,20 @@ int main() {
         return -1;
     }
 
+    if (HasArgument(argc, argv, "--test-descriptors")) {
+        const bool result = RunDescriptorStressTest(kernel->GetDevice(), kernel->GetAllocator(), kernel->GetDescriptorManager());
+        std::cout << "Descriptor stress test " << (result ? "passed" : "failed") << std::endl;
+        return result ? 0 : -1;
+    }
+
+    for (int i = 1; i + 1 < argc; ++i) {
+        if (std::string(argv[i]) == "--bench-texture-load") {
+            const bool result = RunTextureLoadBenchmark(kernel, argv[i + 1]);
+            std::cout << "Texture load benchmark " << (result ? "complete" : "failed") << std::endl;
+            return result ? 0 : -1;
+        }
+    }
+
     //!=================================================================================================================
 
     if (!kernel->LoadTexture())